@@ -23,6 +23,7 @@
 #include "singleton.h"
 
 #include "napi_call_manager_types.h"
+#include "napi_call_property_template.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -110,14 +111,11 @@ private:
     static void ReportCallStateWork(uv_work_t *work, int32_t status);
     static void ReportMeeTimeStateWork(uv_work_t *work, int32_t status);
     static int32_t ReportCallState(CallAttributeInfo &info, EventCallback stateCallback);
-    static void SetBaseCallStateProperties(napi_env env, napi_value &callStateObj, const CallAttributeInfo &info);
-    static void ReportCallAttribute(napi_env &env, napi_value callbackValues[],
-        const size_t callbackValuesCount, CallAttributeInfo &info);
+    static void SetBaseCallStateProperties(NapiObjectBuilder &builder, const CallAttributeInfo &info);
+    static void ReportCallAttribute(napi_env &env, NapiObjectBuilder &builder, CallAttributeInfo &info);
     static void CreateVoipNapiValue(napi_env &env, napi_value &voipObject, CallAttributeInfo &info);
     static void CreateMarkInfoNapiValue(napi_env &env, napi_value &markInfoObject, CallAttributeInfo &info);
-    static void ReportCallEventWork(uv_work_t *work, int32_t status);
     static int32_t ReportCallEvent(CallEventInfo &info, EventCallback stateCallback);
-    static void ReportCallDisconnectedCauseWork(uv_work_t *work, int32_t status);
     static int32_t ReportDisconnectedCause(const DisconnectedDetails &details, EventCallback eventCallback);
     int32_t ReportGetWaitingInfo(AppExecFwk::PacMap &resultInfo);
     int32_t ReportSetWaitingInfo(AppExecFwk::PacMap &resultInfo);
@@ -143,7 +141,6 @@ private:
     static void ReportCallOttWork(uv_work_t *work, int32_t status);
     static int32_t ReportCallOtt(
         EventCallback &settingInfo, AppExecFwk::PacMap &resultInfo, OttCallRequestId requestId);
-    static void ReportMmiCodeWork(uv_work_t *work, int32_t status);
     static int32_t ReportMmiCode(MmiCodeInfo &info, EventCallback eventCallback);
     int32_t ReportCloseUnFinishedUssdInfo(AppExecFwk::PacMap &resultInfo);
     static void ReportAudioDeviceInfoWork(uv_work_t *work, int32_t status);
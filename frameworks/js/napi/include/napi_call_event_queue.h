@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NAPI_CALL_EVENT_QUEUE_H
+#define NAPI_CALL_EVENT_QUEUE_H
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "napi/native_api.h"
+#include "napi/native_node_api.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace Telephony {
+enum class NapiCallEventType : int32_t {
+    CALL_STATE = 0,
+    MEETIME_STATE,
+    CALL_EVENT,
+    DISCONNECTED_CAUSE,
+    MMI_CODE,
+};
+
+/**
+ * Identifies events that may replace each other while still pending.
+ * Events with an invalid callId are never collapsed.
+ */
+struct NapiCallEventKey {
+    NapiCallEventType type = NapiCallEventType::CALL_STATE;
+    int32_t callId = -1;
+    int32_t state = -1;
+};
+
+/**
+ * Per-env ring of events waiting for the JS thread. Native threads append to it and a single scheduled JS task
+ * drains everything queued so far in order, so a burst of reports costs one loop task instead of one per event.
+ * A pending call state update is replaced by a newer update of the same call in the same state; state
+ * transitions themselves are always delivered.
+ */
+class NapiCallEventQueue {
+    DECLARE_DELAYED_SINGLETON(NapiCallEventQueue)
+
+public:
+    int32_t Post(napi_env env, const NapiCallEventKey &key, std::function<void()> task);
+
+private:
+    struct PendingEvent {
+        NapiCallEventKey key;
+        std::function<void()> task;
+    };
+    struct EnvQueue {
+        std::deque<PendingEvent> events;
+        bool drainScheduled = false;
+    };
+    bool TryCollapse(EnvQueue &queue, const NapiCallEventKey &key, std::function<void()> &task);
+    void Drain(napi_env env);
+    static void RemoveEnv(void *data);
+
+private:
+    std::mutex mutex_;
+    std::map<napi_env, EnvQueue> queues_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // NAPI_CALL_EVENT_QUEUE_H
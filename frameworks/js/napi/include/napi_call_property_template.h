@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NAPI_CALL_PROPERTY_TEMPLATE_H
+#define NAPI_CALL_PROPERTY_TEMPLATE_H
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "napi/native_api.h"
+#include "napi/native_node_api.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Fixed list of property names shared by every JS object of one report type.
+ * The name strings are created once per napi_env and kept alive through napi_ref handles,
+ * so building an object does not re-create its keys.
+ */
+class NapiPropertyTemplate {
+public:
+    explicit NapiPropertyTemplate(std::vector<const char *> names);
+    ~NapiPropertyTemplate() = default;
+
+    size_t Size() const;
+    const char *GetName(size_t index) const;
+    napi_value GetKey(napi_env env, size_t index);
+
+private:
+    bool InitKeys(napi_env env, std::vector<napi_ref> &keyRefs);
+    static void ReleaseKeys(void *data);
+
+private:
+    struct EnvCleanupData {
+        NapiPropertyTemplate *propertyTemplate = nullptr;
+        napi_env env = nullptr;
+    };
+    const std::vector<const char *> names_;
+    std::mutex mutex_;
+    std::map<napi_env, std::vector<napi_ref>> keyRefs_;
+};
+
+/**
+ * Collects the values of one object described by a NapiPropertyTemplate and attaches them with a single
+ * napi_define_properties call. Slots which were never set are left out of the object.
+ */
+class NapiObjectBuilder {
+public:
+    NapiObjectBuilder(napi_env env, NapiPropertyTemplate &propertyTemplate);
+    ~NapiObjectBuilder() = default;
+
+    void SetInt32(size_t index, int32_t value);
+    void SetInt64(size_t index, int64_t value);
+    void SetBoolean(size_t index, bool value);
+    void SetStringUtf8(size_t index, const std::string &value);
+    void SetStringUtf8(size_t index, const char *value);
+    void SetValue(size_t index, napi_value value);
+    napi_status DefineOn(napi_value object);
+    napi_value Build();
+
+private:
+    napi_env env_ = nullptr;
+    NapiPropertyTemplate &template_;
+    std::vector<napi_property_descriptor> descriptors_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // NAPI_CALL_PROPERTY_TEMPLATE_H
@@ -19,7 +19,9 @@
 #include <ctime>
 
 #include "call_manager_errors.h"
+#include "napi_call_event_queue.h"
 #include "napi_call_manager_utils.h"
+#include "napi_call_property_template.h"
 #include "napi_util.h"
 #include "pixel_map.h"
 #include "pixel_map_napi.h"
@@ -29,6 +31,91 @@
 
 namespace OHOS {
 namespace Telephony {
+namespace {
+enum CallStateProperty : size_t {
+    CALL_STATE_ACCOUNT_NUMBER = 0,
+    CALL_STATE_ACCOUNT_ID,
+    CALL_STATE_VIDEO_STATE,
+    CALL_STATE_START_TIME,
+    CALL_STATE_IS_ECC,
+    CALL_STATE_CALL_TYPE,
+    CALL_STATE_CALL_ID,
+    CALL_STATE_CALL_STATE,
+    CALL_STATE_CONFERENCE_STATE,
+    CALL_STATE_CRS_TYPE,
+    CALL_STATE_ORIGINAL_CALL_TYPE,
+    CALL_STATE_PHONE_OR_WATCH,
+    CALL_STATE_IS_CUSTOM_ACCESSIBILITY,
+    CALL_STATE_RTT_STATE,
+    CALL_STATE_EXTRA_PARAMS,
+    CALL_STATE_NUMBER_LOCATION,
+    CALL_STATE_VOIP_CALL_ATTRIBUTE,
+    CALL_STATE_NUMBER_MARK_INFO,
+    CALL_STATE_DISTRIBUTED_CONTACT_NAME,
+};
+
+enum VoipProperty : size_t {
+    VOIP_USER_NAME = 0,
+    VOIP_ABILITY_NAME,
+    VOIP_EXTENSION_ID,
+    VOIP_BUNDLE_NAME,
+    VOIP_CALL_ID,
+    VOIP_SHOW_BANNER_FOR_INCOMING_CALL,
+    VOIP_IS_CONFERENCE_CALL,
+    VOIP_IS_VOICE_ANSWER_SUPPORTED,
+    VOIP_HAS_MIC_PERMISSION,
+    VOIP_IS_CAPSULE_STICKY,
+    VOIP_UID,
+    VOIP_USER_PROFILE,
+};
+
+enum MarkInfoProperty : size_t {
+    MARK_INFO_MARK_TYPE = 0,
+    MARK_INFO_MARK_CONTENT,
+    MARK_INFO_MARK_COUNT,
+    MARK_INFO_MARK_SOURCE,
+    MARK_INFO_IS_CLOUD,
+    MARK_INFO_MARK_DETAILS,
+};
+
+enum CallEventProperty : size_t {
+    CALL_EVENT_EVENT_ID = 0,
+    CALL_EVENT_ACCOUNT_NUMBER,
+    CALL_EVENT_BUNDLE_NAME,
+};
+
+enum DisconnectedCauseProperty : size_t {
+    DISCONNECTED_REASON = 0,
+    DISCONNECTED_MESSAGE,
+};
+
+enum MmiCodeProperty : size_t {
+    MMI_CODE_RESULT = 0,
+    MMI_CODE_MESSAGE,
+    MMI_CODE_TYPE,
+    MMI_CODE_ACTION,
+    MMI_CODE_STATUS,
+    MMI_CODE_CLASS_CW,
+    MMI_CODE_REASON,
+    MMI_CODE_TIME,
+    MMI_CODE_NUMBER,
+};
+
+NapiPropertyTemplate g_callStateTemplate({ "accountNumber", "accountId", "videoState", "startTime", "isEcc",
+    "callType", "callId", "callState", "conferenceState", "crsType", "originalCallType", "phoneOrWatch",
+    "isCustomAccessibility", "rttState", "extraParams", "numberLocation", "voipCallAttribute", "numberMarkInfo",
+    "distributedContactName" });
+NapiPropertyTemplate g_voipTemplate({ "userName", "abilityName", "extensionId", "voipBundleName", "voipCallId",
+    "showBannerForIncomingCall", "isConferenceCall", "isVoiceAnswerSupported", "hasMicPermission",
+    "isCapsuleSticky", "uid", "userProfile" });
+NapiPropertyTemplate g_markInfoTemplate({ "markType", "markContent", "markCount", "markSource", "isCloud",
+    "markDetails" });
+NapiPropertyTemplate g_callEventTemplate({ "eventId", "accountNumber", "bundleName" });
+NapiPropertyTemplate g_disconnectedCauseTemplate({ "reason", "message" });
+NapiPropertyTemplate g_mmiCodeTemplate({ "result", "message", "mmiCodeType", "action", "status", "classCw",
+    "reason", "time", "number" });
+} // namespace
+
 EventCallback NapiCallAbilityCallback::audioDeviceCallback_;
 std::mutex NapiCallAbilityCallback::audioDeviceCallbackMutex_;
 NapiCallAbilityCallback::NapiCallAbilityCallback()
@@ -539,7 +626,9 @@ int32_t NapiCallAbilityCallback::UpdateCallStateInfo(const CallAttributeInfo &in
     auto task = [callStateWorker]() {
         ReportCallState(callStateWorker->info, callStateWorker->callback);
     };
-    if (napi_status::napi_ok != napi_send_event(stateCallback_.env, task, napi_eprio_high)) {
+    NapiCallEventKey key = { NapiCallEventType::CALL_STATE, info.callId, static_cast<int32_t>(info.callState) };
+    if (DelayedSingleton<NapiCallEventQueue>::GetInstance()->Post(stateCallback_.env, key, task) !=
+        TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("napi_send_event: Failed to Send UpdateCallStateInfo Event");
         return TELEPHONY_ERROR;
     }
@@ -557,31 +646,31 @@ int32_t NapiCallAbilityCallback::UpdateMeeTimeStateInfo(const CallAttributeInfo
     auto task = [meeTimeStateWorker]() {
         ReportCallState(meeTimeStateWorker->info, meeTimeStateWorker->callback);
     };
-    if (napi_status::napi_ok != napi_send_event(meeTimeStateCallback_.env, task, napi_eprio_high)) {
+    NapiCallEventKey key = { NapiCallEventType::MEETIME_STATE, info.callId, static_cast<int32_t>(info.callState) };
+    if (DelayedSingleton<NapiCallEventQueue>::GetInstance()->Post(meeTimeStateCallback_.env, key, task) !=
+        TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("napi_send_event: Failed to Send UpdateMeeTimeStateInfo Event");
         return TELEPHONY_ERROR;
     }
     return TELEPHONY_SUCCESS;
 }
 
-void NapiCallAbilityCallback::SetBaseCallStateProperties(
-    napi_env env, napi_value &callStateObj, const CallAttributeInfo &info)
+void NapiCallAbilityCallback::SetBaseCallStateProperties(NapiObjectBuilder &builder, const CallAttributeInfo &info)
 {
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, callStateObj, "accountNumber", info.accountNumber);
-    NapiCallManagerUtils::SetPropertyInt32(env, callStateObj, "accountId", info.accountId);
-    NapiCallManagerUtils::SetPropertyInt32(env, callStateObj, "videoState", static_cast<int32_t>(info.videoState));
-    NapiCallManagerUtils::SetPropertyInt64(env, callStateObj, "startTime", info.startTime);
-    NapiCallManagerUtils::SetPropertyBoolean(env, callStateObj, "isEcc", info.isEcc);
-    NapiCallManagerUtils::SetPropertyInt32(env, callStateObj, "callType", static_cast<int32_t>(info.callType));
-    NapiCallManagerUtils::SetPropertyInt32(env, callStateObj, "callId", info.callId);
-    NapiCallManagerUtils::SetPropertyInt32(env, callStateObj, "callState", static_cast<int32_t>(info.callState));
-    NapiCallManagerUtils::SetPropertyInt32(
-        env, callStateObj, "conferenceState", static_cast<int32_t>(info.conferenceState));
-    NapiCallManagerUtils::SetPropertyInt32(env, callStateObj, "crsType", info.crsType);
-    NapiCallManagerUtils::SetPropertyInt32(env, callStateObj, "originalCallType", info.originalCallType);
-    NapiCallManagerUtils::SetPropertyInt32(env, callStateObj, "phoneOrWatch", info.phoneOrWatch);
-    NapiCallManagerUtils::SetPropertyBoolean(env, callStateObj, "isCustomAccessibility", info.isCustomAccessibility);
-    NapiCallManagerUtils::SetPropertyInt32(env, callStateObj, "rttState", static_cast<int32_t>(info.rttState));
+    builder.SetStringUtf8(CALL_STATE_ACCOUNT_NUMBER, info.accountNumber);
+    builder.SetInt32(CALL_STATE_ACCOUNT_ID, info.accountId);
+    builder.SetInt32(CALL_STATE_VIDEO_STATE, static_cast<int32_t>(info.videoState));
+    builder.SetInt64(CALL_STATE_START_TIME, info.startTime);
+    builder.SetBoolean(CALL_STATE_IS_ECC, info.isEcc);
+    builder.SetInt32(CALL_STATE_CALL_TYPE, static_cast<int32_t>(info.callType));
+    builder.SetInt32(CALL_STATE_CALL_ID, info.callId);
+    builder.SetInt32(CALL_STATE_CALL_STATE, static_cast<int32_t>(info.callState));
+    builder.SetInt32(CALL_STATE_CONFERENCE_STATE, static_cast<int32_t>(info.conferenceState));
+    builder.SetInt32(CALL_STATE_CRS_TYPE, info.crsType);
+    builder.SetInt32(CALL_STATE_ORIGINAL_CALL_TYPE, info.originalCallType);
+    builder.SetInt32(CALL_STATE_PHONE_OR_WATCH, info.phoneOrWatch);
+    builder.SetBoolean(CALL_STATE_IS_CUSTOM_ACCESSIBILITY, info.isCustomAccessibility);
+    builder.SetInt32(CALL_STATE_RTT_STATE, static_cast<int32_t>(info.rttState));
 }
 
 /**
@@ -599,11 +688,12 @@ int32_t NapiCallAbilityCallback::ReportCallState(CallAttributeInfo &info, EventC
     }
     napi_value callbackFunc = nullptr;
     napi_value callbackValues[ARRAY_INDEX_THIRD] = { 0 };
-    napi_create_object(env, &callbackValues[ARRAY_INDEX_FIRST]);
-    SetBaseCallStateProperties(env, callbackValues[ARRAY_INDEX_FIRST], info);
-    napi_set_named_property(env, callbackValues[ARRAY_INDEX_FIRST], std::string("extraParams").c_str(),
+    NapiObjectBuilder builder(env, g_callStateTemplate);
+    SetBaseCallStateProperties(builder, info);
+    builder.SetValue(CALL_STATE_EXTRA_PARAMS,
         AppExecFwk::WrapWantParams(env, AAFwk::WantParamWrapper::ParseWantParamsWithBrackets(info.extraParamsString)));
-    ReportCallAttribute(env, callbackValues, ARRAY_INDEX_THIRD, info);
+    ReportCallAttribute(env, builder, info);
+    callbackValues[ARRAY_INDEX_FIRST] = builder.Build();
     napi_get_reference_value(env, stateCallback.callbackRef, &callbackFunc);
     if (callbackFunc == nullptr) {
         TELEPHONY_LOGE("callbackFunc is null!");
@@ -618,63 +708,57 @@ int32_t NapiCallAbilityCallback::ReportCallState(CallAttributeInfo &info, EventC
     return TELEPHONY_SUCCESS;
 }
 
-void NapiCallAbilityCallback::ReportCallAttribute(napi_env &env, napi_value callbackValues[],
-    const size_t callbackValuesCount, CallAttributeInfo &info)
+void NapiCallAbilityCallback::ReportCallAttribute(napi_env &env, NapiObjectBuilder &builder, CallAttributeInfo &info)
 {
     std::string str(info.numberLocation);
     if (str == "default") {
         TELEPHONY_LOGE("numberLocation is default");
         (void)memset_s(info.numberLocation, kMaxNumberLen, 0, kMaxNumberLen);
     }
-    NapiCallManagerUtils::SetPropertyStringUtf8(
-        env, callbackValues[ARRAY_INDEX_FIRST], "numberLocation", info.numberLocation);
+    builder.SetStringUtf8(CALL_STATE_NUMBER_LOCATION, info.numberLocation);
     TELEPHONY_LOGI("ReportCallState crsType = %{public}d", info.crsType);
     if (info.callType == CallType::TYPE_VOIP) {
         napi_value voipObject = nullptr;
         CreateVoipNapiValue(env, voipObject, info);
-        napi_set_named_property(env, callbackValues[ARRAY_INDEX_FIRST], "voipCallAttribute", voipObject);
+        builder.SetValue(CALL_STATE_VOIP_CALL_ATTRIBUTE, voipObject);
     }
     napi_value markInfoObject = nullptr;
     CreateMarkInfoNapiValue(env, markInfoObject, info);
-    napi_set_named_property(env, callbackValues[ARRAY_INDEX_FIRST], "numberMarkInfo", markInfoObject);
-    NapiCallManagerUtils::SetPropertyStringUtf8(
-        env, callbackValues[ARRAY_INDEX_FIRST], "distributedContactName", info.contactName);
+    builder.SetValue(CALL_STATE_NUMBER_MARK_INFO, markInfoObject);
+    builder.SetStringUtf8(CALL_STATE_DISTRIBUTED_CONTACT_NAME, info.contactName);
 }
 
 void NapiCallAbilityCallback::CreateVoipNapiValue(napi_env &env, napi_value &voipObject, CallAttributeInfo &info)
 {
-    napi_create_object(env, &voipObject);
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, voipObject, "userName", info.voipCallInfo.userName);
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, voipObject, "abilityName", info.voipCallInfo.abilityName);
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, voipObject, "extensionId", info.voipCallInfo.extensionId);
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, voipObject, "voipBundleName", info.voipCallInfo.voipBundleName);
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, voipObject, "voipCallId", info.voipCallInfo.voipCallId);
-    NapiCallManagerUtils::SetPropertyBoolean(env, voipObject, "showBannerForIncomingCall",
-        info.voipCallInfo.showBannerForIncomingCall);
-    NapiCallManagerUtils::SetPropertyBoolean(env, voipObject, "isConferenceCall", info.voipCallInfo.isConferenceCall);
-    NapiCallManagerUtils::SetPropertyBoolean(
-        env, voipObject, "isVoiceAnswerSupported", info.voipCallInfo.isVoiceAnswerSupported);
-    NapiCallManagerUtils::SetPropertyBoolean(env, voipObject, "hasMicPermission", info.voipCallInfo.hasMicPermission);
-    NapiCallManagerUtils::SetPropertyBoolean(env, voipObject, "isCapsuleSticky", info.voipCallInfo.isCapsuleSticky);
-    NapiCallManagerUtils::SetPropertyInt32(env, voipObject, "uid", info.voipCallInfo.uid);
+    NapiObjectBuilder builder(env, g_voipTemplate);
+    builder.SetStringUtf8(VOIP_USER_NAME, info.voipCallInfo.userName);
+    builder.SetStringUtf8(VOIP_ABILITY_NAME, info.voipCallInfo.abilityName);
+    builder.SetStringUtf8(VOIP_EXTENSION_ID, info.voipCallInfo.extensionId);
+    builder.SetStringUtf8(VOIP_BUNDLE_NAME, info.voipCallInfo.voipBundleName);
+    builder.SetStringUtf8(VOIP_CALL_ID, info.voipCallInfo.voipCallId);
+    builder.SetBoolean(VOIP_SHOW_BANNER_FOR_INCOMING_CALL, info.voipCallInfo.showBannerForIncomingCall);
+    builder.SetBoolean(VOIP_IS_CONFERENCE_CALL, info.voipCallInfo.isConferenceCall);
+    builder.SetBoolean(VOIP_IS_VOICE_ANSWER_SUPPORTED, info.voipCallInfo.isVoiceAnswerSupported);
+    builder.SetBoolean(VOIP_HAS_MIC_PERMISSION, info.voipCallInfo.hasMicPermission);
+    builder.SetBoolean(VOIP_IS_CAPSULE_STICKY, info.voipCallInfo.isCapsuleSticky);
+    builder.SetInt32(VOIP_UID, info.voipCallInfo.uid);
     std::shared_ptr<Media::PixelMap> userProfile =
         std::shared_ptr<Media::PixelMap>(Media::PixelMap::DecodeTlv(info.voipCallInfo.userProfile));
-    napi_value pixelMapObject = Media::PixelMapNapi::CreatePixelMap(env, userProfile);
-    napi_set_named_property(env, voipObject, "userProfile", pixelMapObject);
+    builder.SetValue(VOIP_USER_PROFILE, Media::PixelMapNapi::CreatePixelMap(env, userProfile));
+    voipObject = builder.Build();
 }
 
 void NapiCallAbilityCallback::CreateMarkInfoNapiValue(napi_env &env,
     napi_value &markInfoObject, CallAttributeInfo &info)
 {
-    napi_create_object(env, &markInfoObject);
-    NapiCallManagerUtils::SetPropertyInt32(env, markInfoObject, "markType",
-        static_cast<int32_t>(info.numberMarkInfo.markType));
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, markInfoObject, "markContent", info.numberMarkInfo.markContent);
-    NapiCallManagerUtils::SetPropertyInt32(env, markInfoObject, "markCount",
-        static_cast<int32_t>(info.numberMarkInfo.markCount));
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, markInfoObject, "markSource", info.numberMarkInfo.markSource);
-    NapiCallManagerUtils::SetPropertyBoolean(env, markInfoObject, "isCloud", info.numberMarkInfo.isCloud);
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, markInfoObject, "markDetails", info.numberMarkInfo.markDetails);
+    NapiObjectBuilder builder(env, g_markInfoTemplate);
+    builder.SetInt32(MARK_INFO_MARK_TYPE, static_cast<int32_t>(info.numberMarkInfo.markType));
+    builder.SetStringUtf8(MARK_INFO_MARK_CONTENT, info.numberMarkInfo.markContent);
+    builder.SetInt32(MARK_INFO_MARK_COUNT, static_cast<int32_t>(info.numberMarkInfo.markCount));
+    builder.SetStringUtf8(MARK_INFO_MARK_SOURCE, info.numberMarkInfo.markSource);
+    builder.SetBoolean(MARK_INFO_IS_CLOUD, info.numberMarkInfo.isCloud);
+    builder.SetStringUtf8(MARK_INFO_MARK_DETAILS, info.numberMarkInfo.markDetails);
+    markInfoObject = builder.Build();
 }
 
 int32_t NapiCallAbilityCallback::UpdateCallEvent(const CallEventInfo &info)
@@ -683,57 +767,22 @@ int32_t NapiCallAbilityCallback::UpdateCallEvent(const CallEventInfo &info)
         TELEPHONY_LOGE("eventCallback is null!");
         return CALL_ERR_CALLBACK_NOT_EXIST;
     }
-    uv_loop_s *loop = nullptr;
-#if defined(NAPI_VERSION) && NAPI_VERSION >= 2
-    napi_get_uv_event_loop(eventCallback_.env, &loop);
-#endif
-    if (loop == nullptr) {
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    CallEventWorker *callEventWorker = std::make_unique<CallEventWorker>().release();
-    if (callEventWorker == nullptr) {
-        TELEPHONY_LOGE("callEventWorker is nullptr!");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
+    auto callEventWorker = std::make_shared<CallEventWorker>();
     callEventWorker->info = info;
     callEventWorker->callback = eventCallback_;
-    uv_work_t *work = std::make_unique<uv_work_t>().release();
-    if (work == nullptr) {
-        delete callEventWorker;
-        callEventWorker = nullptr;
-        TELEPHONY_LOGE("work is nullptr!");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    work->data = (void *)callEventWorker;
-    int32_t errCode = uv_queue_work_with_qos(loop, work, [](uv_work_t *work) {
-        TELEPHONY_LOGD("UpdateCallEvent uv_queue_work_with_qos");
-    }, ReportCallEventWork, uv_qos_default);
-    if (errCode != 0) {
-        TELEPHONY_LOGE("failed to uv_queue_work_with_qos, errCode: %{public}d", errCode);
-        delete callEventWorker;
-        callEventWorker = nullptr;
-        delete work;
-        work = nullptr;
+    auto task = [callEventWorker]() {
+        int32_t ret = ReportCallEvent(callEventWorker->info, callEventWorker->callback);
+        TELEPHONY_LOGI("ReportCallEvent results %{public}d", ret);
+    };
+    NapiCallEventKey key = { NapiCallEventType::CALL_EVENT };
+    if (DelayedSingleton<NapiCallEventQueue>::GetInstance()->Post(eventCallback_.env, key, task) !=
+        TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("Failed to post UpdateCallEvent");
         return TELEPHONY_ERROR;
     }
     return TELEPHONY_SUCCESS;
 }
 
-void NapiCallAbilityCallback::ReportCallEventWork(uv_work_t *work, int32_t status)
-{
-    CallEventWorker *dataWorkerData = (CallEventWorker *)work->data;
-    if (dataWorkerData == nullptr) {
-        TELEPHONY_LOGE("dataWorkerData is nullptr!");
-        return;
-    }
-    int32_t ret = ReportCallEvent(dataWorkerData->info, dataWorkerData->callback);
-    TELEPHONY_LOGI("ReportCallEvent results %{public}d", ret);
-    delete dataWorkerData;
-    dataWorkerData = nullptr;
-    delete work;
-    work = nullptr;
-}
-
 int32_t NapiCallAbilityCallback::ReportCallEvent(CallEventInfo &info, EventCallback eventCallback)
 {
     napi_env env = eventCallback.env;
@@ -746,13 +795,11 @@ int32_t NapiCallAbilityCallback::ReportCallEvent(CallEventInfo &info, EventCallb
     }
     napi_value callEventCallbackFunc = nullptr;
     napi_value callEventCallbackValues[ARRAY_INDEX_THIRD] = { 0 };
-    napi_create_object(env, &callEventCallbackValues[ARRAY_INDEX_FIRST]);
-    NapiCallManagerUtils::SetPropertyInt32(
-        env, callEventCallbackValues[ARRAY_INDEX_FIRST], "eventId", static_cast<int32_t>(info.eventId));
-    NapiCallManagerUtils::SetPropertyStringUtf8(
-        env, callEventCallbackValues[ARRAY_INDEX_FIRST], "accountNumber", info.phoneNum);
-    NapiCallManagerUtils::SetPropertyStringUtf8(
-        env, callEventCallbackValues[ARRAY_INDEX_FIRST], "bundleName", info.bundleName);
+    NapiObjectBuilder builder(env, g_callEventTemplate);
+    builder.SetInt32(CALL_EVENT_EVENT_ID, static_cast<int32_t>(info.eventId));
+    builder.SetStringUtf8(CALL_EVENT_ACCOUNT_NUMBER, info.phoneNum);
+    builder.SetStringUtf8(CALL_EVENT_BUNDLE_NAME, info.bundleName);
+    callEventCallbackValues[ARRAY_INDEX_FIRST] = builder.Build();
     napi_get_reference_value(env, eventCallback.callbackRef, &callEventCallbackFunc);
     if (callEventCallbackFunc == nullptr) {
         TELEPHONY_LOGE("callEventCallbackFunc is null!");
@@ -773,39 +820,18 @@ int32_t NapiCallAbilityCallback::UpdateCallDisconnectedCause(const DisconnectedD
         TELEPHONY_LOGE("callDisconnectCauseCallback_ is null!");
         return CALL_ERR_CALLBACK_NOT_EXIST;
     }
-    uv_loop_s *loop = nullptr;
-#if defined(NAPI_VERSION) && NAPI_VERSION >= 2
-    napi_get_uv_event_loop(callDisconnectCauseCallback_.env, &loop);
-#endif
-    if (loop == nullptr) {
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    CallDisconnectedCauseWorker *callDisconnectedCauseWorker =
-        std::make_unique<CallDisconnectedCauseWorker>().release();
-    if (callDisconnectedCauseWorker == nullptr) {
-        TELEPHONY_LOGE("callDisconnectedCauseWorker is nullptr!");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
+    auto callDisconnectedCauseWorker = std::make_shared<CallDisconnectedCauseWorker>();
     callDisconnectedCauseWorker->details = details;
     callDisconnectedCauseWorker->callback = callDisconnectCauseCallback_;
-    uv_work_t *work = std::make_unique<uv_work_t>().release();
-    if (work == nullptr) {
-        delete callDisconnectedCauseWorker;
-        callDisconnectedCauseWorker = nullptr;
-        TELEPHONY_LOGE("work is nullptr!");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    work->data = (void *)callDisconnectedCauseWorker;
-    int32_t errCode = uv_queue_work_with_qos(
-        loop, work, [](uv_work_t *work) {
-            TELEPHONY_LOGD("UpdateCallDisconnectedCause uv_queue_work_with_qos");
-        }, ReportCallDisconnectedCauseWork, uv_qos_default);
-    if (errCode != 0) {
-        delete callDisconnectedCauseWorker;
-        callDisconnectedCauseWorker = nullptr;
-        TELEPHONY_LOGE("failed to add uv_queue_work_with_qos, errCode: %{public}d", errCode);
-        delete work;
-        work = nullptr;
+    auto task = [callDisconnectedCauseWorker]() {
+        int32_t ret = ReportDisconnectedCause(
+            callDisconnectedCauseWorker->details, callDisconnectedCauseWorker->callback);
+        TELEPHONY_LOGI("ReportDisconnectedCause results %{public}d", ret);
+    };
+    NapiCallEventKey key = { NapiCallEventType::DISCONNECTED_CAUSE };
+    if (DelayedSingleton<NapiCallEventQueue>::GetInstance()->Post(callDisconnectCauseCallback_.env, key, task) !=
+        TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("Failed to post UpdateCallDisconnectedCause");
         return TELEPHONY_ERROR;
     }
     if (callDisconnectCauseCallback_.thisVar) {
@@ -814,21 +840,6 @@ int32_t NapiCallAbilityCallback::UpdateCallDisconnectedCause(const DisconnectedD
     return TELEPHONY_SUCCESS;
 }
 
-void NapiCallAbilityCallback::ReportCallDisconnectedCauseWork(uv_work_t *work, int32_t status)
-{
-    CallDisconnectedCauseWorker *dataWorkerData = (CallDisconnectedCauseWorker *)work->data;
-    if (dataWorkerData == nullptr) {
-        TELEPHONY_LOGE("dataWorkerData is nullptr!");
-        return;
-    }
-    int32_t ret = ReportDisconnectedCause(dataWorkerData->details, dataWorkerData->callback);
-    TELEPHONY_LOGI("ReportDisconnectedCause results %{public}d", ret);
-    delete dataWorkerData;
-    dataWorkerData = nullptr;
-    delete work;
-    work = nullptr;
-}
-
 int32_t NapiCallAbilityCallback::ReportDisconnectedCause(
     const DisconnectedDetails &details, EventCallback eventCallback)
 {
@@ -842,10 +853,10 @@ int32_t NapiCallAbilityCallback::ReportDisconnectedCause(
     }
     napi_value callbackFunc = nullptr;
     napi_value callbackValues[ARRAY_INDEX_THIRD] = { 0 };
-    napi_create_object(env, &callbackValues[ARRAY_INDEX_FIRST]);
-    NapiCallManagerUtils::SetPropertyInt32(
-        env, callbackValues[ARRAY_INDEX_FIRST], "reason", static_cast<int32_t>(details.reason));
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, callbackValues[ARRAY_INDEX_FIRST], "message", details.message);
+    NapiObjectBuilder builder(env, g_disconnectedCauseTemplate);
+    builder.SetInt32(DISCONNECTED_REASON, static_cast<int32_t>(details.reason));
+    builder.SetStringUtf8(DISCONNECTED_MESSAGE, details.message);
+    callbackValues[ARRAY_INDEX_FIRST] = builder.Build();
     napi_get_reference_value(env, eventCallback.callbackRef, &callbackFunc);
     if (callbackFunc == nullptr) {
         TELEPHONY_LOGE("callbackFunc is null!");
@@ -880,58 +891,23 @@ int32_t NapiCallAbilityCallback::UpdateMmiCodeResultsInfo(const MmiCodeInfo &inf
         TELEPHONY_LOGE("mmiCodeCallback is null!");
         return CALL_ERR_CALLBACK_NOT_EXIST;
     }
-    uv_loop_s *loop = nullptr;
-#if defined(NAPI_VERSION) && NAPI_VERSION >= 2
-    napi_get_uv_event_loop(mmiCodeCallback_.env, &loop);
-#endif
-    if (loop == nullptr) {
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    MmiCodeWorker *mmiCodeWorker = std::make_unique<MmiCodeWorker>().release();
-    if (mmiCodeWorker == nullptr) {
-        TELEPHONY_LOGE("mmiCodeWorker is nullptr!");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
+    auto mmiCodeWorker = std::make_shared<MmiCodeWorker>();
     mmiCodeWorker->info = info;
     mmiCodeWorker->callback = mmiCodeCallback_;
     lock.unlock();
-    uv_work_t *work = std::make_unique<uv_work_t>().release();
-    if (work == nullptr) {
-        delete mmiCodeWorker;
-        mmiCodeWorker = nullptr;
-        TELEPHONY_LOGE("work is nullptr!");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    work->data = (void *)mmiCodeWorker;
-    int32_t errCode = uv_queue_work_with_qos(loop, work, [](uv_work_t *work) {
-        TELEPHONY_LOGD("UpdateMmiCodeResultsInfo uv_queue_work_with_qos");
-    }, ReportMmiCodeWork, uv_qos_default);
-    if (errCode != 0) {
-        TELEPHONY_LOGE("failed to uv_queue_work_with_qos, errCode: %{public}d", errCode);
-        delete mmiCodeWorker;
-        mmiCodeWorker = nullptr;
-        delete work;
-        work = nullptr;
+    auto task = [mmiCodeWorker]() {
+        int32_t ret = ReportMmiCode(mmiCodeWorker->info, mmiCodeWorker->callback);
+        TELEPHONY_LOGI("ReportMmiCode result = %{public}d", ret);
+    };
+    NapiCallEventKey key = { NapiCallEventType::MMI_CODE };
+    if (DelayedSingleton<NapiCallEventQueue>::GetInstance()->Post(mmiCodeWorker->callback.env, key, task) !=
+        TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("Failed to post UpdateMmiCodeResultsInfo");
         return TELEPHONY_ERROR;
     }
     return TELEPHONY_SUCCESS;
 }
 
-void NapiCallAbilityCallback::ReportMmiCodeWork(uv_work_t *work, int32_t status)
-{
-    MmiCodeWorker *dataWorkerData = (MmiCodeWorker *)work->data;
-    if (dataWorkerData == nullptr) {
-        TELEPHONY_LOGE("dataWorkerData is nullptr!");
-        return;
-    }
-    int32_t ret = ReportMmiCode(dataWorkerData->info, dataWorkerData->callback);
-    TELEPHONY_LOGI("ReportMmiCode result = %{public}d", ret);
-    delete dataWorkerData;
-    dataWorkerData = nullptr;
-    delete work;
-    work = nullptr;
-}
-
 /**
  * To notify an application of MMI code result, register a callback with on() first.
  */
@@ -947,23 +923,17 @@ int32_t NapiCallAbilityCallback::ReportMmiCode(MmiCodeInfo &info, EventCallback
     }
     napi_value callbackFunc = nullptr;
     napi_value callbackValues[ARRAY_INDEX_FOURTH] = { 0 };
-    napi_create_object(env, &callbackValues[ARRAY_INDEX_FIRST]);
-    NapiCallManagerUtils::SetPropertyInt32(
-        env, callbackValues[ARRAY_INDEX_FIRST], "result", static_cast<int32_t>(info.result));
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, callbackValues[ARRAY_INDEX_FIRST], "message", info.message);
-    NapiCallManagerUtils::SetPropertyInt32(env, callbackValues[ARRAY_INDEX_FIRST], "mmiCodeType",
-        static_cast<int32_t>(info.mmiCodeType));
-    NapiCallManagerUtils::SetPropertyInt32(env, callbackValues[ARRAY_INDEX_FIRST], "action",
-        static_cast<int32_t>(info.action));
-    NapiCallManagerUtils::SetPropertyInt32(env, callbackValues[ARRAY_INDEX_FIRST], "status",
-        static_cast<int32_t>(info.status));
-    NapiCallManagerUtils::SetPropertyInt32(env, callbackValues[ARRAY_INDEX_FIRST], "classCw",
-        static_cast<int32_t>(info.classCw));
-    NapiCallManagerUtils::SetPropertyInt32(env, callbackValues[ARRAY_INDEX_FIRST], "reason",
-        static_cast<int32_t>(info.reason));
-    NapiCallManagerUtils::SetPropertyInt32(env, callbackValues[ARRAY_INDEX_FIRST], "time",
-        static_cast<int32_t>(info.time));
-    NapiCallManagerUtils::SetPropertyStringUtf8(env, callbackValues[ARRAY_INDEX_FIRST], "number", info.number);
+    NapiObjectBuilder builder(env, g_mmiCodeTemplate);
+    builder.SetInt32(MMI_CODE_RESULT, static_cast<int32_t>(info.result));
+    builder.SetStringUtf8(MMI_CODE_MESSAGE, info.message);
+    builder.SetInt32(MMI_CODE_TYPE, static_cast<int32_t>(info.mmiCodeType));
+    builder.SetInt32(MMI_CODE_ACTION, static_cast<int32_t>(info.action));
+    builder.SetInt32(MMI_CODE_STATUS, static_cast<int32_t>(info.status));
+    builder.SetInt32(MMI_CODE_CLASS_CW, static_cast<int32_t>(info.classCw));
+    builder.SetInt32(MMI_CODE_REASON, static_cast<int32_t>(info.reason));
+    builder.SetInt32(MMI_CODE_TIME, static_cast<int32_t>(info.time));
+    builder.SetStringUtf8(MMI_CODE_NUMBER, info.number);
+    callbackValues[ARRAY_INDEX_FIRST] = builder.Build();
     napi_get_reference_value(env, eventCallback.callbackRef, &callbackFunc);
     if (callbackFunc == nullptr) {
         TELEPHONY_LOGE("callbackFunc is null!");
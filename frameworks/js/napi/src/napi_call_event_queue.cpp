@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "napi_call_event_queue.h"
+
+#include "telephony_errors.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr int32_t INVALID_CALL_ID = -1;
+} // namespace
+
+NapiCallEventQueue::NapiCallEventQueue() {}
+
+NapiCallEventQueue::~NapiCallEventQueue() {}
+
+int32_t NapiCallEventQueue::Post(napi_env env, const NapiCallEventKey &key, std::function<void()> task)
+{
+    if (env == nullptr || task == nullptr) {
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = queues_.find(env);
+    if (it == queues_.end()) {
+        it = queues_.emplace(env, EnvQueue()).first;
+        if (napi_add_env_cleanup_hook(env, RemoveEnv, env) != napi_ok) {
+            TELEPHONY_LOGW("add env cleanup hook failed");
+        }
+    }
+    EnvQueue &queue = it->second;
+    if (TryCollapse(queue, key, task)) {
+        return TELEPHONY_SUCCESS;
+    }
+    queue.events.push_back({ key, std::move(task) });
+    if (queue.drainScheduled) {
+        return TELEPHONY_SUCCESS;
+    }
+    auto drainTask = [env]() {
+        auto eventQueue = DelayedSingleton<NapiCallEventQueue>::GetInstance();
+        if (eventQueue != nullptr) {
+            eventQueue->Drain(env);
+        }
+    };
+    if (napi_send_event(env, drainTask, napi_eprio_high) != napi_status::napi_ok) {
+        TELEPHONY_LOGE("napi_send_event: Failed to schedule call event drain");
+        queue.events.pop_back();
+        return TELEPHONY_ERROR;
+    }
+    queue.drainScheduled = true;
+    return TELEPHONY_SUCCESS;
+}
+
+bool NapiCallEventQueue::TryCollapse(EnvQueue &queue, const NapiCallEventKey &key, std::function<void()> &task)
+{
+    if (key.callId == INVALID_CALL_ID ||
+        (key.type != NapiCallEventType::CALL_STATE && key.type != NapiCallEventType::MEETIME_STATE)) {
+        return false;
+    }
+    for (auto it = queue.events.rbegin(); it != queue.events.rend(); ++it) {
+        if (it->key.type != key.type || it->key.callId != key.callId) {
+            continue;
+        }
+        // only the newest pending update of this call may be replaced, and only if the state is unchanged
+        if (it->key.state != key.state) {
+            return false;
+        }
+        it->task = std::move(task);
+        return true;
+    }
+    return false;
+}
+
+void NapiCallEventQueue::Drain(napi_env env)
+{
+    std::deque<PendingEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = queues_.find(env);
+        if (it == queues_.end()) {
+            return;
+        }
+        events.swap(it->second.events);
+        it->second.drainScheduled = false;
+    }
+    for (auto &event : events) {
+        event.task();
+    }
+    TELEPHONY_LOGD("drained %{public}zu call events", events.size());
+}
+
+void NapiCallEventQueue::RemoveEnv(void *data)
+{
+    auto eventQueue = DelayedSingleton<NapiCallEventQueue>::GetInstance();
+    if (eventQueue == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(eventQueue->mutex_);
+    eventQueue->queues_.erase(static_cast<napi_env>(data));
+}
+} // namespace Telephony
+} // namespace OHOS
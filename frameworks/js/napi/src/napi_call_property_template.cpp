@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "napi_call_property_template.h"
+
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+// Same attributes as napi_set_named_property, so the JS side sees no difference.
+constexpr napi_property_attributes JS_PROPERTY_ATTRIBUTES =
+    static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable);
+constexpr uint32_t KEY_REF_COUNT = 1;
+} // namespace
+
+NapiPropertyTemplate::NapiPropertyTemplate(std::vector<const char *> names) : names_(std::move(names)) {}
+
+size_t NapiPropertyTemplate::Size() const
+{
+    return names_.size();
+}
+
+const char *NapiPropertyTemplate::GetName(size_t index) const
+{
+    if (index >= names_.size()) {
+        return nullptr;
+    }
+    return names_[index];
+}
+
+napi_value NapiPropertyTemplate::GetKey(napi_env env, size_t index)
+{
+    if (env == nullptr || index >= names_.size()) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = keyRefs_.find(env);
+    if (it == keyRefs_.end()) {
+        std::vector<napi_ref> keyRefs;
+        if (!InitKeys(env, keyRefs)) {
+            return nullptr;
+        }
+        it = keyRefs_.emplace(env, std::move(keyRefs)).first;
+    }
+    napi_value key = nullptr;
+    if (it->second[index] == nullptr || napi_get_reference_value(env, it->second[index], &key) != napi_ok) {
+        return nullptr;
+    }
+    return key;
+}
+
+bool NapiPropertyTemplate::InitKeys(napi_env env, std::vector<napi_ref> &keyRefs)
+{
+    keyRefs.assign(names_.size(), nullptr);
+    for (size_t i = 0; i < names_.size(); i++) {
+        napi_value key = nullptr;
+        if (napi_create_string_utf8(env, names_[i], NAPI_AUTO_LENGTH, &key) != napi_ok ||
+            napi_create_reference(env, key, KEY_REF_COUNT, &keyRefs[i]) != napi_ok) {
+            TELEPHONY_LOGW("create key reference failed, fall back to utf8 names");
+            keyRefs[i] = nullptr;
+        }
+    }
+    EnvCleanupData *cleanupData = new (std::nothrow) EnvCleanupData();
+    if (cleanupData == nullptr) {
+        for (napi_ref keyRef : keyRefs) {
+            if (keyRef != nullptr) {
+                napi_delete_reference(env, keyRef);
+            }
+        }
+        return false;
+    }
+    cleanupData->propertyTemplate = this;
+    cleanupData->env = env;
+    if (napi_add_env_cleanup_hook(env, ReleaseKeys, cleanupData) != napi_ok) {
+        TELEPHONY_LOGW("add env cleanup hook failed");
+    }
+    return true;
+}
+
+void NapiPropertyTemplate::ReleaseKeys(void *data)
+{
+    EnvCleanupData *cleanupData = static_cast<EnvCleanupData *>(data);
+    if (cleanupData == nullptr || cleanupData->propertyTemplate == nullptr) {
+        delete cleanupData;
+        return;
+    }
+    NapiPropertyTemplate *propertyTemplate = cleanupData->propertyTemplate;
+    std::lock_guard<std::mutex> lock(propertyTemplate->mutex_);
+    auto it = propertyTemplate->keyRefs_.find(cleanupData->env);
+    if (it != propertyTemplate->keyRefs_.end()) {
+        for (napi_ref keyRef : it->second) {
+            if (keyRef != nullptr) {
+                napi_delete_reference(cleanupData->env, keyRef);
+            }
+        }
+        propertyTemplate->keyRefs_.erase(it);
+    }
+    delete cleanupData;
+}
+
+NapiObjectBuilder::NapiObjectBuilder(napi_env env, NapiPropertyTemplate &propertyTemplate)
+    : env_(env), template_(propertyTemplate)
+{
+    descriptors_.resize(template_.Size());
+    for (size_t i = 0; i < descriptors_.size(); i++) {
+        descriptors_[i] = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, JS_PROPERTY_ATTRIBUTES, nullptr };
+    }
+}
+
+void NapiObjectBuilder::SetInt32(size_t index, int32_t value)
+{
+    napi_value propertyValue = nullptr;
+    napi_create_int32(env_, value, &propertyValue);
+    SetValue(index, propertyValue);
+}
+
+void NapiObjectBuilder::SetInt64(size_t index, int64_t value)
+{
+    napi_value propertyValue = nullptr;
+    napi_create_int64(env_, value, &propertyValue);
+    SetValue(index, propertyValue);
+}
+
+void NapiObjectBuilder::SetBoolean(size_t index, bool value)
+{
+    napi_value propertyValue = nullptr;
+    napi_get_boolean(env_, value, &propertyValue);
+    SetValue(index, propertyValue);
+}
+
+void NapiObjectBuilder::SetStringUtf8(size_t index, const std::string &value)
+{
+    napi_value propertyValue = nullptr;
+    napi_create_string_utf8(env_, value.c_str(), value.length(), &propertyValue);
+    SetValue(index, propertyValue);
+}
+
+void NapiObjectBuilder::SetStringUtf8(size_t index, const char *value)
+{
+    if (value == nullptr) {
+        return;
+    }
+    napi_value propertyValue = nullptr;
+    napi_create_string_utf8(env_, value, strlen(value), &propertyValue);
+    SetValue(index, propertyValue);
+}
+
+void NapiObjectBuilder::SetValue(size_t index, napi_value value)
+{
+    if (index >= descriptors_.size()) {
+        TELEPHONY_LOGE("property index %{public}zu out of range", index);
+        return;
+    }
+    descriptors_[index].value = value;
+}
+
+napi_status NapiObjectBuilder::DefineOn(napi_value object)
+{
+    std::vector<napi_property_descriptor> defined;
+    defined.reserve(descriptors_.size());
+    for (size_t i = 0; i < descriptors_.size(); i++) {
+        if (descriptors_[i].value == nullptr) {
+            continue;
+        }
+        napi_property_descriptor descriptor = descriptors_[i];
+        descriptor.name = template_.GetKey(env_, i);
+        if (descriptor.name == nullptr) {
+            descriptor.utf8name = template_.GetName(i);
+        }
+        defined.push_back(descriptor);
+    }
+    if (defined.empty()) {
+        return napi_ok;
+    }
+    return napi_define_properties(env_, object, defined.size(), defined.data());
+}
+
+napi_value NapiObjectBuilder::Build()
+{
+    napi_value object = nullptr;
+    if (napi_create_object(env_, &object) != napi_ok) {
+        TELEPHONY_LOGE("napi_create_object failed");
+        return nullptr;
+    }
+    if (DefineOn(object) != napi_ok) {
+        TELEPHONY_LOGE("napi_define_properties failed");
+    }
+    return object;
+}
+} // namespace Telephony
+} // namespace OHOS
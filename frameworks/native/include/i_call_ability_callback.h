@@ -23,6 +23,8 @@
 
 namespace OHOS {
 namespace Telephony {
+class CallAttributeInfoParcel;
+
 class ICallAbilityCallback : public IRemoteBroker {
 public:
     ICallAbilityCallback() : bundleInfo_("") {}
@@ -30,6 +32,15 @@ public:
 
     virtual int32_t OnCallDetailsChange(const CallAttributeInfo &info) = 0;
     virtual int32_t OnMeeTimeDetailsChange(const CallAttributeInfo &info) = 0;
+    virtual int32_t OnMarshalledCallDetailsChange(const CallAttributeInfo &info, const CallAttributeInfoParcel &parcel)
+    {
+        return OnCallDetailsChange(info);
+    }
+    virtual int32_t OnMarshalledMeeTimeDetailsChange(
+        const CallAttributeInfo &info, const CallAttributeInfoParcel &parcel)
+    {
+        return OnMeeTimeDetailsChange(info);
+    }
     virtual int32_t OnCallEventChange(const CallEventInfo &info) = 0;
     virtual int32_t OnCallDisconnectedCause(const DisconnectedDetails &details) = 0;
     virtual int32_t OnReportAsyncResults(CallResultReportId reportId, AppExecFwk::PacMap &resultInfo) = 0;
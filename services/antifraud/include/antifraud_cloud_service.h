@@ -29,6 +29,7 @@ class AntiFraudCloudService : public std::enable_shared_from_this<AntiFraudCloud
 public:
     explicit AntiFraudCloudService(const std::string &phoneNum);
     bool UploadPostRequest(const OHOS::AntiFraudService::AntiFraudResult &antiFraudResult);
+    static std::string CalculateDigest(const std::string &payload);
 private:
     bool isSettled_ = false;
     std::string phoneNum_;
@@ -48,7 +49,6 @@ private:
     std::string GetRomVersion();
     std::string GetSubstringBeforeSymbol(const std::string &str, const std::string &symbol);
     std::string GetDeviceSerial();
-    std::string CalculateDigest(const std::string &payload);
     std::string GetOsVersion();
     std::string GenerateRandomString(size_t length);
     std::string ProcessSignResult(const std::string &signResult);
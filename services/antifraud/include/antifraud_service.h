@@ -21,6 +21,7 @@
 #include "call_status_manager.h"
 #include "anti_fraud_service_client_type.h"
 #include "anti_fraud_start_detect_res_listener.h"
+#include "antifraud_session_table.h"
 #include "singleton.h"
 #include "datashare_helper.h"
 
@@ -52,15 +53,17 @@ public:
     int32_t StopAntiFraudDetectByType(const OHOS::AntiFraudService::AfsDetectType &detectType);
     std::shared_ptr<DataShare::DataShareHelper> CreateDataShareHelper(int32_t systemAbilityId, const char *uri);
     void AddRuleToConfig(const std::string rulesName, void *config);
-    int AnonymizeText();
+    int AnonymizeText(std::string &text);
     void UpdateVideoState(VideoStateType priorVideoState, VideoStateType nextVideoState);
+    bool ClaimDetectSession(int32_t slotId, int32_t index);
+    bool IsDetecting(int32_t slotId, int32_t index);
+    std::shared_ptr<const AntiFraudSession> GetSession(int32_t slotId, int32_t index);
+    void ReleaseSession(int32_t slotId, int32_t index);
 
 private:
-    int32_t GetStoppedSlotId();
-    int32_t GetStoppedIndex();
-    void SetStoppedSlotId(int32_t slotId);
-    void SetStoppedIndex(int32_t index);
     int32_t CheckAntiFraudService(const OHOS::AntiFraudService::AfsDetectType &detectType);
+    int InitAnonymizerLocked();
+    void ReleaseAnonymizer();
 
 private:
     class AntiFraudStartDetectResListenerImpl : public OHOS::AntiFraudService::AntiFraudStartDetectResListener {
@@ -77,16 +80,10 @@ private:
     };
 
 private:
-    void InitParams();
-    std::string fraudDetectText_ = "";
-
-    int32_t antiFraudState_ = 0;
-    int32_t stoppedSlotId_ = -1;
-    int32_t stoppedIndex_ = -1;
-    OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt_ {};
-
-    ffrt::mutex mutex_;
-    ffrt::mutex fraudMutex_;
+    AntiFraudSessionTable sessionTable_;
+    ffrt::mutex anonymizeMutex_;
+    void *anonymizeConfig_ = nullptr;
+    void *anonymizer_ = nullptr;
  
 private:
     std::shared_ptr<CallStatusManager> callStatusManagerPtr_ = nullptr;
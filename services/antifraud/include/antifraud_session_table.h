@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANTIFRAUD_SESSION_TABLE_H
+#define ANTIFRAUD_SESSION_TABLE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "anti_fraud_service_client_type.h"
+#include "call_manager_base.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Telephony {
+struct AntiFraudSession {
+    int32_t slotId = -1;
+    int32_t index = -1;
+    int32_t state = static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_DEFAULT);
+    OHOS::AntiFraudService::AntiFraudResultExt resultExt {};
+    std::string detectText;
+
+    bool IsDetecting() const;
+};
+
+/**
+ * @class AntiFraudSessionTable
+ * Keeps one immutable AntiFraudSession per call, keyed by slot id and call index. A session is claimed when the
+ * detection starts and held until the call stops it, independent of the result it records, since the detector keeps
+ * running after the first result. Writers copy the published snapshot under a mutex, change the copy and publish it
+ * atomically, readers only load the snapshot and never wait for a writer, so a slow detection callback can not stall
+ * the call state reports.
+ */
+class AntiFraudSessionTable {
+public:
+    using SessionPtr = std::shared_ptr<const AntiFraudSession>;
+
+    SessionPtr Find(int32_t slotId, int32_t index) const;
+    bool IsDetecting(int32_t slotId, int32_t index) const;
+    bool HasDetectingSession() const;
+    size_t GetSize() const;
+    bool Claim(int32_t slotId, int32_t index);
+    SessionPtr Update(int32_t slotId, int32_t index, int32_t state,
+        const OHOS::AntiFraudService::AntiFraudResultExt &resultExt, const std::string &detectText);
+    SessionPtr Release(int32_t slotId, int32_t index);
+    void Clear();
+
+private:
+    using SessionKey = std::pair<int32_t, int32_t>;
+    using SessionMap = std::map<SessionKey, SessionPtr>;
+
+    std::shared_ptr<const SessionMap> Load() const;
+    void Store(std::shared_ptr<const SessionMap> sessions);
+
+    ffrt::mutex writeMutex_;
+    std::shared_ptr<const SessionMap> sessions_ = std::make_shared<const SessionMap>();
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // ANTIFRAUD_SESSION_TABLE_H
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANTIFRAUD_UPLOADER_H
+#define ANTIFRAUD_UPLOADER_H
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "anti_fraud_service_client_type.h"
+#include "ffrt.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace Telephony {
+struct AntiFraudUploadItem {
+    uint64_t sequence = 0;
+    std::string phoneNum;
+    std::string phoneNumDigest;
+    OHOS::AntiFraudService::AntiFraudResult result {};
+    bool isAnonymized = false;
+    uint32_t attempts = 0;
+};
+
+/**
+ * @class AntiFraudUploader
+ * Uploads fraud detection results to the cloud off the detection callback. Enqueue only copies the result, the
+ * text is anonymized, persisted and uploaded on a serial ffrt queue in batches. A failed upload is retried with
+ * exponential back-off and the pending queue is bounded, only anonymized items are ever written to the el2 queue and
+ * they carry the SHA-256 digest of the caller number instead of the number, so a restored result is uploaded with
+ * the digest.
+ */
+class AntiFraudUploader : public std::enable_shared_from_this<AntiFraudUploader> {
+    DECLARE_DELAYED_SINGLETON(AntiFraudUploader)
+public:
+    using UploadFunc = std::function<bool(const std::string &phoneNum,
+        const OHOS::AntiFraudService::AntiFraudResult &result)>;
+    using AnonymizeFunc = std::function<int(std::string &text)>;
+    using SwitchFunc = std::function<bool()>;
+
+    void Enqueue(const std::string &phoneNum, const OHOS::AntiFraudService::AntiFraudResult &result);
+    size_t GetPendingCount();
+
+private:
+    void PostDrain(int64_t delayMs);
+    void Drain();
+    bool PrepareQueueDir();
+    void LoadQueue();
+    void SaveQueue();
+    bool AnonymizeBatch(std::deque<AntiFraudUploadItem> &batch);
+    int64_t UploadBatch(std::deque<AntiFraudUploadItem> &batch);
+    void EraseItemLocked(uint64_t sequence);
+    int64_t GetRetryDelayMs(uint32_t attempts);
+
+    ffrt::mutex mutex_;
+    std::deque<AntiFraudUploadItem> items_;
+    uint64_t lastSequence_ = 0;
+    bool isDrainPosted_ = false;
+    bool isLoaded_ = false;
+    std::string queuePath_;
+    UploadFunc uploadFunc_ = nullptr;
+    AnonymizeFunc anonymizeFunc_ = nullptr;
+    SwitchFunc switchFunc_ = nullptr;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // ANTIFRAUD_UPLOADER_H
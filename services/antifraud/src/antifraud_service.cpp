@@ -18,7 +18,7 @@
 #include <string>
 #include "antifraud_adapter.h"
 #include "anonymize_adapter.h"
-#include "antifraud_cloud_service.h"
+#include "antifraud_uploader.h"
 #include "common_type.h"
 #include "hitrace/tracechain.h"
 #include "telephony_log_wrapper.h"
@@ -27,11 +27,16 @@
 namespace OHOS {
 namespace Telephony {
 constexpr const int32_t MAX_VOICE_TEXT_LENGTH = 1000;
+constexpr const char *ANONYMIZE_RULES[] = { "PRC", "CHINA_RESIDENT_PASSPORT", "MILITARY_IDENTITY_CARD_NUMBER",
+    "BANK_CARD_NUMBER", "PERMIT_LAND_TO_HM", "PERMIT_LAND_TO_TW", "PERMIT_HM_TO_LAND", "PERMIT_TW_TO_LAND",
+    "BIRTH_CERTIFICATE", "SEAFARER_PASSPORT", "POLICE_OFFICER_CARD" };
 AntiFraudService::AntiFraudService()
 {}
 
 AntiFraudService::~AntiFraudService()
-{}
+{
+    ReleaseAnonymizer();
+}
 
 void AntiFraudService::SetCallStatusManager(std::shared_ptr<CallStatusManager> callStatusManager)
 {
@@ -120,77 +125,65 @@ bool AntiFraudService::IsUserImprovementPlanSwitchOn()
     return IsSwitchOn(USER_IMPROPLAN_SWITCH);
 }
 
-void AntiFraudService::InitParams()
+bool AntiFraudService::ClaimDetectSession(int32_t slotId, int32_t index)
 {
-    fraudDetectText_ = "";
-    antiFraudState_ = static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_DEFAULT);
+    return sessionTable_.Claim(slotId, index);
 }
 
-int32_t AntiFraudService::GetStoppedSlotId()
-{
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    return stoppedSlotId_;
-}
- 
-int32_t AntiFraudService::GetStoppedIndex()
+bool AntiFraudService::IsDetecting(int32_t slotId, int32_t index)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    return stoppedIndex_;
+    return sessionTable_.IsDetecting(slotId, index);
 }
- 
-void AntiFraudService::SetStoppedSlotId(int32_t slotId)
+
+std::shared_ptr<const AntiFraudSession> AntiFraudService::GetSession(int32_t slotId, int32_t index)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    stoppedSlotId_ = slotId;
+    return sessionTable_.Find(slotId, index);
 }
- 
-void AntiFraudService::SetStoppedIndex(int32_t index)
+
+void AntiFraudService::ReleaseSession(int32_t slotId, int32_t index)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    stoppedIndex_ = index;
+    sessionTable_.Release(slotId, index);
 }
 
 void AntiFraudService::RecordDetectResult(const OHOS::AntiFraudService::StartDetectionResult &antiFraudResult,
     std::string resultPhoneNum, int32_t resultSlotId, int32_t resultIndex)
 {
-    if (GetStoppedSlotId() == resultSlotId && GetStoppedIndex() == resultIndex) {
-        TELEPHONY_LOGI("detect stopped, no need to record result");
-        SetStoppedSlotId(-1);
-        SetStoppedIndex(-1);
-        return;
-    }
-
-    std::lock_guard<ffrt::mutex> lock(fraudMutex_);
-    antiFraudResultExt_.isVoiceSemanticFraud = antiFraudResult.voiceDetectionResult.result;
-    antiFraudResultExt_.isSpeechSynthesisFraud = antiFraudResult.speechSynthesisResult.result;
-    antiFraudResultExt_.speechSynthesisProb = antiFraudResult.speechSynthesisResult.pvalue;
-    antiFraudResultExt_.isXoipFraud = antiFraudResult.voipCallTransferResult.result;
+    OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt;
+    antiFraudResultExt.isVoiceSemanticFraud = antiFraudResult.voiceDetectionResult.result;
+    antiFraudResultExt.isSpeechSynthesisFraud = antiFraudResult.speechSynthesisResult.result;
+    antiFraudResultExt.speechSynthesisProb = antiFraudResult.speechSynthesisResult.pvalue;
+    antiFraudResultExt.isXoipFraud = antiFraudResult.voipCallTransferResult.result;
+    std::string detectText;
     if (!antiFraudResult.voiceDetectionResult.voiceText.empty() &&
         antiFraudResult.voiceDetectionResult.voiceText.length() <= MAX_VOICE_TEXT_LENGTH) {
-        fraudDetectText_ = antiFraudResult.voiceDetectionResult.voiceText;
+        detectText = antiFraudResult.voiceDetectionResult.voiceText;
     }
-
-    if (antiFraudResultExt_.isVoiceSemanticFraud || antiFraudResultExt_.isSpeechSynthesisFraud ||
-        antiFraudResultExt_.isXoipFraud) {
+    int32_t antiFraudState = static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED);
+    if (antiFraudResultExt.isVoiceSemanticFraud || antiFraudResultExt.isSpeechSynthesisFraud ||
+        antiFraudResultExt.isXoipFraud) {
+        antiFraudState = static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK);
+    }
+    // a stopped detection has no session left, its late result is dropped
+    auto session = sessionTable_.Update(resultSlotId, resultIndex, antiFraudState, antiFraudResultExt, detectText);
+    if (session == nullptr) {
+        TELEPHONY_LOGI("detect stopped, no need to record result");
+        return;
+    }
+    if (session->state == static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK)) {
         TELEPHONY_LOGI("AntiFraud detect finish, is fraud call");
-        antiFraudState_ = static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK);
     } else {
         TELEPHONY_LOGI("AntiFraud detect finish, is not fraud call");
-        antiFraudState_ = static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED);
     }
     if (callStatusManagerPtr_ != nullptr) {
-        callStatusManagerPtr_->TriggerAntiFraud(antiFraudState_, antiFraudResultExt_);
+        callStatusManagerPtr_->TriggerAntiFraud(resultSlotId, resultIndex, session->state, session->resultExt);
     }
 
-    if (antiFraudResultExt_.isVoiceSemanticFraud && IsUserImprovementPlanSwitchOn()) {
+    if (session->resultExt.isVoiceSemanticFraud) {
+        // the switch query, anonymizing and uploading all run on the uploader, not on the detection callback
         TELEPHONY_LOGI("text reported to the cloud after anonymize");
-        int ret = AnonymizeText();
-        if (ret != 0) {
-            TELEPHONY_LOGE("Anonymize text fail");
-            return;
-        }
         OHOS::AntiFraudService::AntiFraudResult fraudResult = antiFraudResult.voiceDetectionResult;
-        std::make_shared<AntiFraudCloudService>(resultPhoneNum)->UploadPostRequest(fraudResult);
+        fraudResult.voiceText = session->detectText;
+        DelayedSingleton<AntiFraudUploader>::GetInstance()->Enqueue(resultPhoneNum, fraudResult);
     }
 }
 
@@ -212,12 +205,9 @@ int32_t AntiFraudService::StartAntiFraudService(const std::string &phoneNum, int
     if (antiFraudErrCode != 0) {
         return antiFraudErrCode;
     }
-    if (callStatusManagerPtr_ != nullptr) {
-        if (callStatusManagerPtr_->GetAntiFraudSlotId() != slotId ||
-            callStatusManagerPtr_->GetAntiFraudIndex() != index) {
-            TELEPHONY_LOGI("call ending, no need to antifraud detect");
-            return -1;
-        }
+    if (!sessionTable_.IsDetecting(slotId, index)) {
+        TELEPHONY_LOGI("call ending, no need to antifraud detect");
+        return -1;
     }
     OHOS::HiviewDFX::HiTraceId chainId = OHOS::HiviewDFX::HiTraceChain::GetId();
     if (!chainId.IsValid()) {
@@ -232,12 +222,11 @@ int32_t AntiFraudService::StartAntiFraudService(const std::string &phoneNum, int
         return antiFraudErrCode;
     }
     TELEPHONY_LOGI("AntiFraud begin detect, slotId=%{public}d, index=%{public}d", slotId, index);
-    std::lock_guard<ffrt::mutex> lock(fraudMutex_);
-    antiFraudState_ = static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_STARTED);
-    if (callStatusManagerPtr_ != nullptr) {
-        callStatusManagerPtr_->TriggerAntiFraud(antiFraudState_, antiFraudResultExt_);
+    auto session = sessionTable_.Update(slotId, index, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_STARTED),
+        OHOS::AntiFraudService::AntiFraudResultExt(), "");
+    if (session != nullptr && callStatusManagerPtr_ != nullptr) {
+        callStatusManagerPtr_->TriggerAntiFraud(slotId, index, session->state, session->resultExt);
     }
-    InitParams();
     return 0;
 }
 
@@ -252,6 +241,8 @@ void AntiFraudService::UpdateVideoState(VideoStateType priorVideoState, VideoSta
 
 int32_t AntiFraudService::StopAntiFraudService(int32_t slotId, int32_t index)
 {
+    // release first, a result racing with the stop then finds no session and is dropped
+    sessionTable_.Release(slotId, index);
     auto antiFraudAdapter = DelayedSingleton<AntiFraudAdapter>::GetInstance();
     int32_t antiFraudErrCode = antiFraudAdapter->StopAntiFraud();
     if (antiFraudErrCode != 0) {
@@ -259,8 +250,6 @@ int32_t AntiFraudService::StopAntiFraudService(int32_t slotId, int32_t index)
         return antiFraudErrCode;
     }
     TELEPHONY_LOGI("AntiFraud stop detect, slotId=%{public}d, index=%{public}d", slotId, index);
-    SetStoppedSlotId(slotId);
-    SetStoppedIndex(index);
     return 0;
 }
 
@@ -313,8 +302,11 @@ void AntiFraudService::AddRuleToConfig(const std::string rulesName, void *config
     }
 }
 
-int AntiFraudService::AnonymizeText()
+int AntiFraudService::InitAnonymizerLocked()
 {
+    if (anonymizer_ != nullptr) {
+        return 0;
+    }
     void *config = nullptr;
     auto anonymizeAdapter = DelayedSingleton<AnonymizeAdapter>::GetInstance();
     int ret = anonymizeAdapter->InitConfig(&config);
@@ -322,39 +314,56 @@ int AntiFraudService::AnonymizeText()
         TELEPHONY_LOGE("InitConfig fail");
         return ret;
     }
-    AddRuleToConfig("PRC", config);
-    AddRuleToConfig("CHINA_RESIDENT_PASSPORT", config);
-    AddRuleToConfig("MILITARY_IDENTITY_CARD_NUMBER", config);
-    AddRuleToConfig("BANK_CARD_NUMBER", config);
-    AddRuleToConfig("PERMIT_LAND_TO_HM", config);
-    AddRuleToConfig("PERMIT_LAND_TO_TW", config);
-    AddRuleToConfig("PERMIT_HM_TO_LAND", config);
-    AddRuleToConfig("PERMIT_TW_TO_LAND", config);
-    AddRuleToConfig("BIRTH_CERTIFICATE", config);
-    AddRuleToConfig("SEAFARER_PASSPORT", config);
-    AddRuleToConfig("POLICE_OFFICER_CARD", config);
+    for (const char *rule : ANONYMIZE_RULES) {
+        AddRuleToConfig(rule, config);
+    }
 
     void *assistant = nullptr;
     ret = anonymizeAdapter->CreateAnonymize(config, &assistant);
     if (ret != 0) {
         TELEPHONY_LOGE("CreateAnonymize fail");
+        anonymizeAdapter->ReleaseConfig(&config);
+        return ret;
+    }
+    anonymizeConfig_ = config;
+    anonymizer_ = assistant;
+    return 0;
+}
+
+void AntiFraudService::ReleaseAnonymizer()
+{
+    std::lock_guard<ffrt::mutex> lock(anonymizeMutex_);
+    if (anonymizer_ == nullptr) {
+        return;
+    }
+    auto anonymizeAdapter = DelayedSingleton<AnonymizeAdapter>::GetInstance();
+    anonymizeAdapter->ReleaseAnonymize(&anonymizer_);
+    anonymizeAdapter->ReleaseConfig(&anonymizeConfig_);
+    anonymizer_ = nullptr;
+    anonymizeConfig_ = nullptr;
+}
+
+int AntiFraudService::AnonymizeText(std::string &text)
+{
+    // the rule set never changes, the anonymizer is built once and reused for every text
+    std::lock_guard<ffrt::mutex> lock(anonymizeMutex_);
+    int ret = InitAnonymizerLocked();
+    if (ret != 0) {
         return ret;
     }
 
     DIA_String input;
-    std::string fraudDetectText = fraudDetectText_;
+    std::string fraudDetectText = text;
     input.data = fraudDetectText.data();
     input.dataLength = strlen(input.data);
     DIA_String *output = nullptr;
-    ret = anonymizeAdapter->IdentifyAnonymize(assistant, &input, &output);
-    if (ret != 0) {
+    auto anonymizeAdapter = DelayedSingleton<AnonymizeAdapter>::GetInstance();
+    ret = anonymizeAdapter->IdentifyAnonymize(anonymizer_, &input, &output);
+    if (ret != 0 || output == nullptr) {
         TELEPHONY_LOGE("IdentifyAnonymize fail");
-        return ret;
-    } else {
-        fraudDetectText_ = (std::string)output->data;
+        return ret != 0 ? ret : -1;
     }
-    anonymizeAdapter->ReleaseConfig(&config);
-    anonymizeAdapter->ReleaseAnonymize(&assistant);
+    text = (std::string)output->data;
     anonymizeAdapter->ReleaseOutputData(&output);
     return 0;
 }
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "antifraud_session_table.h"
+
+#include <atomic>
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+bool AntiFraudSession::IsDetecting() const
+{
+    return state == static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_DEFAULT) ||
+        state == static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_STARTED);
+}
+
+std::shared_ptr<const AntiFraudSessionTable::SessionMap> AntiFraudSessionTable::Load() const
+{
+    return std::atomic_load(&sessions_);
+}
+
+void AntiFraudSessionTable::Store(std::shared_ptr<const SessionMap> sessions)
+{
+    std::atomic_store(&sessions_, std::move(sessions));
+}
+
+AntiFraudSessionTable::SessionPtr AntiFraudSessionTable::Find(int32_t slotId, int32_t index) const
+{
+    auto sessions = Load();
+    auto iter = sessions->find(SessionKey(slotId, index));
+    if (iter == sessions->end()) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+bool AntiFraudSessionTable::IsDetecting(int32_t slotId, int32_t index) const
+{
+    SessionPtr session = Find(slotId, index);
+    return session != nullptr && session->IsDetecting();
+}
+
+bool AntiFraudSessionTable::HasDetectingSession() const
+{
+    auto sessions = Load();
+    for (const auto &item : *sessions) {
+        if (item.second->IsDetecting()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t AntiFraudSessionTable::GetSize() const
+{
+    return Load()->size();
+}
+
+bool AntiFraudSessionTable::Claim(int32_t slotId, int32_t index)
+{
+    if (slotId < 0) {
+        return false;
+    }
+    std::lock_guard<ffrt::mutex> lock(writeMutex_);
+    auto sessions = Load();
+    // the detector is not per call and keeps running after a result, a call waits until the holder is stopped
+    if (!sessions->empty()) {
+        auto &holder = sessions->begin()->first;
+        TELEPHONY_LOGI("slotId=%{public}d, index=%{public}d holds the detector", holder.first, holder.second);
+        return false;
+    }
+    auto session = std::make_shared<AntiFraudSession>();
+    session->slotId = slotId;
+    session->index = index;
+    auto newSessions = std::make_shared<SessionMap>(*sessions);
+    (*newSessions)[SessionKey(slotId, index)] = std::move(session);
+    Store(std::move(newSessions));
+    return true;
+}
+
+AntiFraudSessionTable::SessionPtr AntiFraudSessionTable::Update(int32_t slotId, int32_t index, int32_t state,
+    const OHOS::AntiFraudService::AntiFraudResultExt &resultExt, const std::string &detectText)
+{
+    std::lock_guard<ffrt::mutex> lock(writeMutex_);
+    auto sessions = Load();
+    auto iter = sessions->find(SessionKey(slotId, index));
+    if (iter == sessions->end()) {
+        return nullptr;
+    }
+    // a call reported as risky stays risky, a later result of the same detection can not clear it
+    int32_t riskState = static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK);
+    if (iter->second->state == riskState && state != riskState) {
+        return nullptr;
+    }
+    auto session = std::make_shared<AntiFraudSession>(*iter->second);
+    session->state = state;
+    session->resultExt = resultExt;
+    session->detectText = detectText;
+    auto newSessions = std::make_shared<SessionMap>(*sessions);
+    (*newSessions)[SessionKey(slotId, index)] = session;
+    Store(std::move(newSessions));
+    return session;
+}
+
+AntiFraudSessionTable::SessionPtr AntiFraudSessionTable::Release(int32_t slotId, int32_t index)
+{
+    std::lock_guard<ffrt::mutex> lock(writeMutex_);
+    auto sessions = Load();
+    auto iter = sessions->find(SessionKey(slotId, index));
+    if (iter == sessions->end()) {
+        return nullptr;
+    }
+    SessionPtr session = iter->second;
+    auto newSessions = std::make_shared<SessionMap>(*sessions);
+    newSessions->erase(SessionKey(slotId, index));
+    Store(std::move(newSessions));
+    return session;
+}
+
+void AntiFraudSessionTable::Clear()
+{
+    std::lock_guard<ffrt::mutex> lock(writeMutex_);
+    Store(std::make_shared<const SessionMap>());
+}
+} // namespace Telephony
+} // namespace OHOS
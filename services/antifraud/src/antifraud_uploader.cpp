@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "antifraud_uploader.h"
+
+#include <algorithm>
+#include <cJSON.h>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "antifraud_cloud_service.h"
+#include "antifraud_service.h"
+#include "call_task_executor.h"
+#include "call_timer_wheel.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+    ffrt::queue antiFraudUploadQueue { "antifraud_uploader" };
+}
+// the queue holds the digest of the caller number, it lives in el2 which is encrypted with the user credential. The
+// directory label comes from the telephony sepolicy in base/security/selinux_adapter, like the other
+// /data/service/el2/public directories of the telephony services.
+constexpr const char *ANTIFRAUD_UPLOAD_QUEUE_PATH =
+    "/data/service/el2/public/call_manager/antifraud_upload_queue.json";
+constexpr const char *UPLOAD_RETRY_TIMER = "antifraud_upload_retry";
+constexpr const char *TEMP_FILE_SUFFIX = ".tmp";
+constexpr size_t MAX_PENDING_UPLOADS = 32;
+constexpr size_t MAX_UPLOAD_BATCH = 8;
+constexpr uint32_t MAX_UPLOAD_ATTEMPTS = 5;
+constexpr int64_t UPLOAD_RETRY_BASE_MS = 30000;
+constexpr int64_t UPLOAD_RETRY_MAX_MS = 1800000;
+
+static double GetJsonNumber(const cJSON *entry, const char *key)
+{
+    cJSON *value = cJSON_GetObjectItem(entry, key);
+    return cJSON_IsNumber(value) ? value->valuedouble : 0;
+}
+
+AntiFraudUploader::AntiFraudUploader() : queuePath_(ANTIFRAUD_UPLOAD_QUEUE_PATH) {}
+
+AntiFraudUploader::~AntiFraudUploader() {}
+
+void AntiFraudUploader::Enqueue(const std::string &phoneNum, const OHOS::AntiFraudService::AntiFraudResult &result)
+{
+    bool shouldPost = false;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (items_.size() >= MAX_PENDING_UPLOADS) {
+            TELEPHONY_LOGW("antifraud upload queue full, drop the oldest result");
+            items_.pop_front();
+        }
+        AntiFraudUploadItem item;
+        item.sequence = ++lastSequence_;
+        item.phoneNum = phoneNum;
+        item.result = result;
+        items_.push_back(std::move(item));
+        if (!isDrainPosted_) {
+            isDrainPosted_ = true;
+            shouldPost = true;
+        }
+    }
+    if (shouldPost) {
+        PostDrain(0);
+    }
+}
+
+size_t AntiFraudUploader::GetPendingCount()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return items_.size();
+}
+
+void AntiFraudUploader::PostDrain(int64_t delayMs)
+{
+    std::weak_ptr<AntiFraudUploader> weakUploader = weak_from_this();
+    auto task = [weakUploader]() {
+        auto uploader = weakUploader.lock();
+        if (uploader != nullptr) {
+            uploader->Drain();
+        }
+    };
+    if (delayMs <= 0) {
+        DelayedSingleton<CallTaskExecutor>::GetInstance()->Submit(antiFraudUploadQueue, task);
+        return;
+    }
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(UPLOAD_RETRY_TIMER, delayMs,
+        [task]() { DelayedSingleton<CallTaskExecutor>::GetInstance()->Submit(antiFraudUploadQueue, task); });
+}
+
+void AntiFraudUploader::Drain()
+{
+    if (!isLoaded_) {
+        LoadQueue();
+    }
+    bool isSwitchOn = switchFunc_ != nullptr ? switchFunc_() :
+        DelayedSingleton<AntiFraudService>::GetInstance()->IsUserImprovementPlanSwitchOn();
+    std::deque<AntiFraudUploadItem> batch;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (!isSwitchOn && !items_.empty()) {
+            TELEPHONY_LOGI("user improvement plan off, drop %{public}zu pending results", items_.size());
+            items_.clear();
+        }
+        for (size_t i = 0; i < items_.size() && batch.size() < MAX_UPLOAD_BATCH; i++) {
+            batch.push_back(items_[i]);
+        }
+    }
+    if (!batch.empty() && AnonymizeBatch(batch)) {
+        SaveQueue();
+    }
+    int64_t retryDelayMs = batch.empty() ? 0 : UploadBatch(batch);
+    SaveQueue();
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (retryDelayMs <= 0 && items_.empty()) {
+            isDrainPosted_ = false;
+            return;
+        }
+    }
+    PostDrain(retryDelayMs);
+}
+
+bool AntiFraudUploader::AnonymizeBatch(std::deque<AntiFraudUploadItem> &batch)
+{
+    bool isChanged = false;
+    auto it = batch.begin();
+    while (it != batch.end()) {
+        if (it->isAnonymized) {
+            ++it;
+            continue;
+        }
+        std::string text = it->result.voiceText;
+        int ret = anonymizeFunc_ != nullptr ? anonymizeFunc_(text) :
+            DelayedSingleton<AntiFraudService>::GetInstance()->AnonymizeText(text);
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto item = std::find_if(items_.begin(), items_.end(),
+            [sequence = it->sequence](const AntiFraudUploadItem &pending) { return pending.sequence == sequence; });
+        if (ret != 0) {
+            // the raw text must never leave the device
+            TELEPHONY_LOGE("Anonymize text fail");
+            if (item != items_.end()) {
+                items_.erase(item);
+            }
+            it = batch.erase(it);
+            continue;
+        }
+        it->result.voiceText = text;
+        it->phoneNumDigest = AntiFraudCloudService::CalculateDigest(it->phoneNum);
+        it->isAnonymized = true;
+        if (item != items_.end()) {
+            item->result.voiceText = text;
+            item->phoneNumDigest = it->phoneNumDigest;
+            item->isAnonymized = true;
+            isChanged = true;
+        }
+        ++it;
+    }
+    return isChanged;
+}
+
+int64_t AntiFraudUploader::UploadBatch(std::deque<AntiFraudUploadItem> &batch)
+{
+    for (auto &item : batch) {
+        bool isUploaded = uploadFunc_ != nullptr ? uploadFunc_(item.phoneNum, item.result) :
+            std::make_shared<AntiFraudCloudService>(item.phoneNum)->UploadPostRequest(item.result);
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (isUploaded) {
+            EraseItemLocked(item.sequence);
+            continue;
+        }
+        auto pending = std::find_if(items_.begin(), items_.end(),
+            [sequence = item.sequence](const AntiFraudUploadItem &it) { return it.sequence == sequence; });
+        if (pending == items_.end()) {
+            continue;
+        }
+        pending->attempts++;
+        if (pending->attempts >= MAX_UPLOAD_ATTEMPTS) {
+            TELEPHONY_LOGE("antifraud upload failed %{public}u times, drop it", pending->attempts);
+            items_.erase(pending);
+            continue;
+        }
+        // the cloud or the network is down, the rest of the batch would fail the same way
+        int64_t delayMs = GetRetryDelayMs(pending->attempts);
+        TELEPHONY_LOGW("antifraud upload failed, retry in %{public}lld ms", static_cast<long long>(delayMs));
+        return delayMs;
+    }
+    return 0;
+}
+
+void AntiFraudUploader::EraseItemLocked(uint64_t sequence)
+{
+    auto it = std::find_if(items_.begin(), items_.end(),
+        [sequence](const AntiFraudUploadItem &item) { return item.sequence == sequence; });
+    if (it != items_.end()) {
+        items_.erase(it);
+    }
+}
+
+int64_t AntiFraudUploader::GetRetryDelayMs(uint32_t attempts)
+{
+    int64_t delayMs = UPLOAD_RETRY_BASE_MS;
+    for (uint32_t i = 1; i < attempts && delayMs < UPLOAD_RETRY_MAX_MS; i++) {
+        delayMs *= 2;
+    }
+    return std::min(delayMs, UPLOAD_RETRY_MAX_MS);
+}
+
+bool AntiFraudUploader::PrepareQueueDir()
+{
+    std::string queueDir = queuePath_.substr(0, queuePath_.find_last_of('/'));
+    if (access(queueDir.c_str(), W_OK) == 0) {
+        return true;
+    }
+    return errno == ENOENT && mkdir(queueDir.c_str(), S_IRWXU) == 0;
+}
+
+void AntiFraudUploader::LoadQueue()
+{
+    if (queuePath_.empty()) {
+        isLoaded_ = true;
+        return;
+    }
+    // el2 is only readable after the first unlock, keep the results in memory and try again on the next drain
+    if (!PrepareQueueDir()) {
+        TELEPHONY_LOGW("antifraud upload queue dir not ready");
+        return;
+    }
+    isLoaded_ = true;
+    std::ifstream file(queuePath_);
+    if (!file.is_open()) {
+        return;
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    cJSON *root = cJSON_Parse(content.str().c_str());
+    if (root == nullptr || !cJSON_IsArray(root)) {
+        TELEPHONY_LOGE("antifraud upload queue is damaged");
+        cJSON_Delete(root);
+        return;
+    }
+    std::deque<AntiFraudUploadItem> loaded;
+    cJSON *entry = nullptr;
+    cJSON_ArrayForEach(entry, root) {
+        cJSON *phoneNumDigest = cJSON_GetObjectItem(entry, "phoneNumDigest");
+        cJSON *voiceText = cJSON_GetObjectItem(entry, "voiceText");
+        if (!cJSON_IsString(phoneNumDigest) || !cJSON_IsString(voiceText)) {
+            continue;
+        }
+        AntiFraudUploadItem item;
+        // the number itself is never stored, a restored result is uploaded with its digest
+        item.phoneNum = phoneNumDigest->valuestring;
+        item.phoneNumDigest = phoneNumDigest->valuestring;
+        item.result.voiceText = voiceText->valuestring;
+        item.result.result = true;
+        item.result.modelVersion = static_cast<int>(GetJsonNumber(entry, "modelVersion"));
+        item.result.fraudType = static_cast<int>(GetJsonNumber(entry, "fraudType"));
+        item.result.pvalue = static_cast<float>(GetJsonNumber(entry, "pvalue"));
+        item.attempts = static_cast<uint32_t>(GetJsonNumber(entry, "attempts"));
+        item.isAnonymized = true;
+        loaded.push_back(std::move(item));
+    }
+    cJSON_Delete(root);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    for (auto it = loaded.rbegin(); it != loaded.rend() && items_.size() < MAX_PENDING_UPLOADS; ++it) {
+        it->sequence = ++lastSequence_;
+        items_.push_front(std::move(*it));
+    }
+    TELEPHONY_LOGI("antifraud upload queue restored, pending %{public}zu", items_.size());
+}
+
+void AntiFraudUploader::SaveQueue()
+{
+    // writing before the stored queue is loaded would overwrite the results saved by the last run
+    if (queuePath_.empty() || !isLoaded_) {
+        return;
+    }
+    cJSON *root = cJSON_CreateArray();
+    if (root == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        for (const auto &item : items_) {
+            if (!item.isAnonymized) {
+                continue;
+            }
+            cJSON *entry = cJSON_CreateObject();
+            if (entry == nullptr) {
+                continue;
+            }
+            cJSON_AddStringToObject(entry, "phoneNumDigest", item.phoneNumDigest.c_str());
+            cJSON_AddStringToObject(entry, "voiceText", item.result.voiceText.c_str());
+            cJSON_AddNumberToObject(entry, "modelVersion", item.result.modelVersion);
+            cJSON_AddNumberToObject(entry, "fraudType", item.result.fraudType);
+            cJSON_AddNumberToObject(entry, "pvalue", item.result.pvalue);
+            cJSON_AddNumberToObject(entry, "attempts", item.attempts);
+            cJSON_AddItemToArray(root, entry);
+        }
+    }
+    char *jsonString = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (jsonString == nullptr) {
+        return;
+    }
+    std::string tempPath = queuePath_ + TEMP_FILE_SUFFIX;
+    std::ofstream file(tempPath, std::ios::trunc);
+    if (!file.is_open()) {
+        TELEPHONY_LOGE("open antifraud upload queue failed");
+        free(jsonString);
+        return;
+    }
+    file << jsonString;
+    file.close();
+    free(jsonString);
+    // write then rename, a crash never leaves a half written queue behind
+    if (std::rename(tempPath.c_str(), queuePath_.c_str()) != 0) {
+        TELEPHONY_LOGE("save antifraud upload queue failed");
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
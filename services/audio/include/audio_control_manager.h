@@ -16,6 +16,8 @@
 #ifndef TELEPHONY_AUDIO_MANAGER_H
 #define TELEPHONY_AUDIO_MANAGER_H
 
+#include <deque>
+#include <functional>
 #include <set>
 
 #include "audio_device_manager.h"
@@ -104,8 +106,15 @@ public:
     bool ShouldPlayRingback();
     void SetCallAudioMode(int32_t mode, int32_t scenarios);
     static void SetIncomingConflict(bool isConflict);
+    void OnRingtoneStreamReleased();
 
 private:
+    struct PendingRing {
+        uint64_t ringId = 0;
+        sptr<CallBase> call = nullptr;
+        CallAttributeInfo info;
+        ContactInfo contactInfo;
+    };
     RingState ringState_ = RingState::STOPPED;
     void HandleNextState(sptr<CallBase> &callObjectPtr, TelCallState nextState);
     void ApplyFocusForBlueToothCall(TelCallState nextState);
@@ -146,6 +155,16 @@ private:
     void PlayRingtone(const sptr<CallBase>& incomingCall,
         const CallAttributeInfo& info, const ContactInfo& contactInfo);
     void PlayRing(const sptr<CallBase>& incomingCall, const CallAttributeInfo& info, const ContactInfo& contactInfo);
+    void DeferRing(const sptr<CallBase> &incomingCall, const CallAttributeInfo &info, const ContactInfo &contactInfo);
+    bool TakePendingRing(uint64_t ringId, PendingRing &pendingRing);
+    void PostPendingRingCheck(uint64_t ringId, int32_t retryCount);
+    void CheckPendingRing(uint64_t ringId, int32_t retryCount);
+    void PlayPendingRing(uint64_t ringId);
+    void StartCallEndedToneTimer();
+    void StopCallEndedTone(uint64_t toneId);
+    int32_t StartDtmfTone(char str);
+    void PlayNextDtmfTone();
+    void PostAudioTimer(std::function<void()> task, int64_t delayUs);
     AudioDeviceType GetInitAudioDeviceTypeOfRemote() const;
 
     ToneState toneState_ = ToneState::STOPPED;
@@ -172,6 +191,13 @@ private:
     bool isPlayForNoRing_ = false;
     static bool isIncomingConflict_;
     static ffrt::mutex incomingMutex_;
+    ffrt::mutex pendingRingMutex_{};
+    PendingRing pendingRing_;
+    uint64_t lastRingId_ = 0;
+    uint64_t callEndedToneId_ = 0;
+    ffrt::mutex dtmfMutex_{};
+    std::deque<char> pendingDtmfChars_;
+    bool isDtmfPlaying_ = false;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -16,9 +16,11 @@
 #ifndef TELEPHONY_AUDIO_DEVICE_MANAGER_H
 #define TELEPHONY_AUDIO_DEVICE_MANAGER_H
 
+#include <atomic>
 #include <map>
 
 #include "audio_base.h"
+#include "audio_device_registry.h"
 #include "call_base.h"
 #include "call_manager_inner_type.h"
 #include "ffrt.h"
@@ -84,6 +86,11 @@ public:
     void SetAudioDeviceByAudioMode(bool isVoipCall, bool isIncomingCall);
     void SetSpeakerDeactive();
     bool IsSpeakerMode();
+    void BeginDeviceBatch();
+    void EndDeviceBatch();
+    uint64_t GetAudioDeviceGeneration();
+    void SetAudioDeviceReportSettleWindow(int32_t windowMs);
+    int32_t FlushAudioDeviceReport();
 private:
     bool EnableBtSco();
     bool EnableNearlink();
@@ -108,6 +115,11 @@ private:
     void UpdateBtHearingAidDevice(std::string &address, std::string &deviceName);
 #endif
     bool UpdateDeviceName(const std::string &macAddress, const std::string &deviceName, AudioDeviceType deviceType);
+    void OnDeviceListChanged(bool isForceReport = false);
+    void FlushDeviceListChange();
+    int32_t SubmitAudioDeviceReport(const AudioDeviceInfo &info);
+    int32_t SendAudioDeviceReport(const AudioDeviceInfo &info, uint64_t sequence);
+    void OnAudioDeviceReportSettled();
     ffrt::mutex mutex_;
     ffrt::mutex infoMutex_;
     AudioDeviceType audioDeviceType_;
@@ -125,9 +137,35 @@ private:
     static bool isDCallDevConnected_;
     bool isAudioActivated_;
     AudioDeviceInfo info_;
+    AudioDeviceRegistry deviceRegistry_ { info_.audioDeviceList };
+    int32_t deviceBatchDepth_ = 0;
+    bool hasPendingDeviceReport_ = false;
+    bool isPendingForceReport_ = false;
+    ffrt::mutex reportMutex_;
+    ffrt::mutex reportSendMutex_;
+    std::atomic<int32_t> reportSettleWindowMs_ { 0 };
+    AudioDeviceInfo pendingReportInfo_;
+    bool hasPendingReport_ = false;
+    bool isReportFlushScheduled_ = false;
+    uint64_t reportSequence_ = 0;
+    uint64_t pendingReportSequence_ = 0;
+    uint64_t lastSentReportSequence_ = 0;
     CallAudioMode callAudioMode_;
     ffrt::mutex audioModeMutex_;
 };
+
+/**
+ * @class AudioDeviceBatch
+ * Groups audio device list mutations so subscribers get a single report when the outermost batch ends.
+ */
+class AudioDeviceBatch {
+public:
+    AudioDeviceBatch();
+    ~AudioDeviceBatch();
+
+private:
+    std::shared_ptr<AudioDeviceManager> audioDeviceManager_;
+};
 } // namespace Telephony
 } // namespace OHOS
 #endif // TELEPHONY_AUDIO_DEVICE_MANAGER_H
\ No newline at end of file
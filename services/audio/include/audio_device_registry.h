@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_AUDIO_DEVICE_REGISTRY_H
+#define TELEPHONY_AUDIO_DEVICE_REGISTRY_H
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "call_manager_inner_type.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @class AudioDeviceRegistry
+ * Keeps an address + type index over the device list that is reported to subscribers. The list itself stays the
+ * storage so the full report is unchanged; the registry is not thread safe and relies on the owner's lock.
+ * The list must only be changed through the registry, or followed by Rebuild(); a stale index is reported as a miss.
+ */
+class AudioDeviceRegistry {
+public:
+    explicit AudioDeviceRegistry(std::vector<AudioDevice> &deviceList);
+    ~AudioDeviceRegistry() = default;
+
+    void Rebuild();
+    bool Add(const AudioDevice &device);
+    bool Remove(const std::string &address, AudioDeviceType deviceType);
+    size_t RemoveIf(const std::function<bool(const AudioDevice &device)> &predicate);
+    bool UpdateDeviceName(const std::string &address, AudioDeviceType deviceType, const std::string &deviceName);
+    const AudioDevice *Find(const std::string &address, AudioDeviceType deviceType);
+    bool HasDeviceType(AudioDeviceType deviceType);
+    uint64_t GetGeneration() const;
+
+private:
+    static std::string GetKey(const std::string &address, AudioDeviceType deviceType);
+    void RebuildIndex();
+    bool IsIndexInSync() const;
+    bool FindPosition(const std::string &key, size_t &position);
+
+    std::vector<AudioDevice> &deviceList_;
+    std::unordered_map<std::string, size_t> index_;
+    std::unordered_map<int32_t, int32_t> typeCount_;
+    uint64_t generation_ = 0;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_AUDIO_DEVICE_REGISTRY_H
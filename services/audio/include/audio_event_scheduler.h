@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_AUDIO_EVENT_SCHEDULER_H
+#define TELEPHONY_AUDIO_EVENT_SCHEDULER_H
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Telephony {
+enum class AudioEventLane : uint32_t {
+    RING = 0,
+    ROUTE,
+    CLEANUP,
+    LANE_BUTT,
+};
+
+/**
+ * @class AudioEventScheduler
+ * Orders audio scene work in prioritized lanes, the caller runs one item per RunNext on its serial queue.
+ * Ring and route items drive the audio state machine and always run in submission order, so events of a call
+ * are never reordered. Cleanup items only carry side effects such as the call ended tone and are held back
+ * while ring work is pending.
+ */
+class AudioEventScheduler {
+public:
+    using Task = std::function<void()>;
+
+    AudioEventScheduler() = default;
+    ~AudioEventScheduler() = default;
+
+    static AudioEventLane GetLane(int32_t event);
+    bool Submit(int32_t event, Task task);
+    bool Submit(AudioEventLane lane, int32_t event, Task task);
+    bool RunNext();
+    size_t GetPendingCount();
+    void Dump(std::string &result);
+    void ResetStats();
+
+private:
+    struct Item {
+        uint64_t sequence = 0;
+        int32_t event = 0;
+        Task task;
+        std::chrono::steady_clock::time_point enqueueTime;
+    };
+    struct LatencyStat {
+        uint64_t count = 0;
+        uint64_t collapsed = 0;
+        int64_t sumUs = 0;
+        int64_t maxUs = 0;
+    };
+    static bool IsStateSwitch(int32_t event);
+    static bool IsCollapsible(int32_t event);
+    bool CollapseLocked(int32_t event);
+    bool PopNextLocked(Item &item);
+    std::deque<Item> &GetLaneQueue(AudioEventLane lane);
+
+    ffrt::mutex mutex_;
+    std::deque<Item> lanes_[static_cast<uint32_t>(AudioEventLane::LANE_BUTT)];
+    uint64_t sequence_ = 0;
+    std::map<int32_t, LatencyStat> latencyStats_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_AUDIO_EVENT_SCHEDULER_H
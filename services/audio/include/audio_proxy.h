@@ -20,6 +20,7 @@
 #include <memory>
 #include "ffrt.h"
 
+#include "audio_stream_manager.h"
 #include "audio_system_manager.h"
 #include "call_manager_errors.h"
 #include "call_manager_inner_type.h"
@@ -59,6 +60,12 @@ public:
     void OnMicStateUpdated(const AudioStandard::MicStateChangeEvent &micStateChangeEvent) override;
 };
 
+class AudioRingtoneStreamChangeCallback : public AudioStandard::AudioRendererStateChangeCallback {
+public:
+    void OnRendererStateChange(
+        const std::vector<std::shared_ptr<AudioStandard::AudioRendererChangeInfo>> &audioRendererChangeInfos) override;
+};
+
 class AudioProxy : public std::enable_shared_from_this<AudioProxy> {
     DECLARE_DELAYED_SINGLETON(AudioProxy)
 public:
@@ -93,6 +100,8 @@ public:
     int32_t UnsetAudioPreferDeviceChangeCallback();
     int32_t SetAudioMicStateChangeCallback();
     int32_t UnsetAudioMicStateChangeCallback();
+    int32_t SetRingtoneStreamChangeCallback();
+    int32_t UnsetRingtoneStreamChangeCallback();
     float GetSystemRingVolumeInDb(int32_t volumeLevel);
     bool SetDeviceActive(AudioStandard::DeviceType deviceType, bool flag, bool isSetAudioDeviceByUser = false);
     static bool IsDistributedPreferredOutputAudioDevice();
@@ -102,6 +111,9 @@ private:
     std::shared_ptr<AudioStandard::AudioManagerDeviceChangeCallback> deviceCallback_;
     std::shared_ptr<AudioStandard::AudioPreferredOutputDeviceChangeCallback> preferredDeviceCallback_;
     std::shared_ptr<AudioStandard::AudioManagerMicStateChangeCallback> audioMicStateChangeCallback_;
+    std::shared_ptr<AudioStandard::AudioRendererStateChangeCallback> ringtoneStreamChangeCallback_;
+    ffrt::mutex ringtoneStreamCallbackMutex_;
+    bool isRingtoneStreamCallbackSet_ = false;
     bool isWiredHeadsetConnected_ = false;
     bool loopFlag_ = false;
     std::atomic<bool> needVibrate_ = false;
@@ -18,9 +18,11 @@
 
 #include "audio_base.h"
 
+#include <atomic>
 #include <map>
 
 #include "singleton.h"
+#include "audio_event_scheduler.h"
 #include "audio_proxy.h"
 
 namespace OHOS {
@@ -45,6 +47,8 @@ class AudioSceneProcessor : public std::enable_shared_from_this<AudioSceneProces
 public:
     int32_t Init();
     bool ProcessEvent(AudioEvent event);
+    void DumpEventLatency(std::string &result);
+    void ResetEventLatency();
 
 private:
     ffrt::mutex mutex_;
@@ -61,7 +65,12 @@ private:
     bool ActivateAudioInterrupt(const AudioStandard::AudioStreamType &streamType);
     bool DeactivateAudioInterrupt();
     void ProcessEventInner(AudioEvent event);
+    void SubmitEndedTone(AudioEvent event, bool isCallEnded);
+    void SubmitToScheduler(AudioEventLane lane, AudioEvent event, AudioEventScheduler::Task task);
     std::unique_ptr<AudioBase> currentState_;
+    AudioEventScheduler eventScheduler_;
+    // bumped whenever ring, alerting or dialing audio starts, ended tones queued before are stale
+    std::atomic<uint64_t> ringEpoch_ { 0 };
     using AudioSceneProcessorFunc = std::function<bool()>;
     std::map<uint32_t, AudioSceneProcessorFunc> memberFuncMap_;
 #ifdef CALL_MANAGER_SOS_NO_RINGBACK_TONE
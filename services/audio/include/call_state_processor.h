@@ -17,8 +17,9 @@
 #define TELEPHONY_CALL_STATE_PROCESSOR_H
 
 #include "ffrt.h"
-#include <set>
+#include <atomic>
 #include <string>
+#include <vector>
 
 #include "call_manager_inner_type.h"
 #include "singleton.h"
@@ -28,11 +29,19 @@ namespace Telephony {
 constexpr uint16_t EMPTY_VALUE = 0;
 constexpr uint16_t EXIST_ONLY_ONE_CALL = 1;
 
+/**
+ * @class CallStateProcessor
+ * Tracks which calls are in each audio relevant state. Writers serialize on mutex_ and keep a small sorted
+ * vector per state, then publish the per state counters packed into one atomic word, and the foreground and
+ * active call ids in two more, so the checks made on every audio event read without locking. Each getter reads
+ * a single atomic: the counters are consistent with each other, but not with the two ids.
+ */
 class CallStateProcessor : public std::enable_shared_from_this<CallStateProcessor> {
     DECLARE_DELAYED_SINGLETON(CallStateProcessor)
 public:
     void AddCall(int32_t callId, TelCallState state);
     void DeleteCall(int32_t callId, TelCallState state);
+    void MoveCall(int32_t callId, TelCallState priorState, TelCallState nextState);
     bool UpdateCurrentCallState();
     bool ShouldStopSoundtone();
     int32_t GetCurrentActiveCall();
@@ -41,11 +50,29 @@ public:
     int32_t GetAudioForegroundLiveCall();
 
 private:
-    std::set<int32_t> activeCalls_;
-    std::set<int32_t> holdingCalls_;
-    std::set<int32_t> alertingCalls_;
-    std::set<int32_t> incomingCalls_;
-    std::set<int32_t> dialingCalls_;
+    enum StateIndex : uint32_t {
+        DIALING_INDEX = 0,
+        ALERTING_INDEX,
+        INCOMING_INDEX,
+        ACTIVE_INDEX,
+        HOLDING_INDEX,
+        STATE_INDEX_NUM,
+        INVALID_INDEX = STATE_INDEX_NUM,
+    };
+    static constexpr uint32_t COUNT_BITS = 12;
+    static constexpr uint64_t COUNT_MASK = (1ULL << COUNT_BITS) - 1;
+
+    static uint32_t GetStateIndex(TelCallState state);
+    static uint32_t GetCount(uint64_t counts, uint32_t index);
+    bool InsertLocked(int32_t callId, uint32_t index);
+    bool EraseLocked(int32_t callId, uint32_t index);
+    void ClearCalls(TelCallState state);
+    void PublishLocked();
+
+    std::vector<int32_t> stateCalls_[STATE_INDEX_NUM];
+    std::atomic<uint64_t> stateCounts_ { 0 };
+    std::atomic<int32_t> foregroundCallId_ { INVALID_CALLID };
+    std::atomic<int32_t> activeCallId_ { INVALID_CALLID };
     ffrt::mutex mutex_;
 };
 } // namespace Telephony
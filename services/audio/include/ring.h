@@ -18,6 +18,8 @@
 
 #include <memory>
 #include <atomic>
+#include <functional>
+#include <string>
 
 #include "audio_renderer.h"
 #include "ffrt.h"
@@ -40,20 +42,31 @@ enum class RingState {
     STOPPED,
 };
 
+class Ring;
+
 #ifdef OHOS_SUBSCRIBE_USER_STATUS_ENABLE
 class RingtoneSettingStatusObserver : public AAFwk::DataAbilityObserverStub {
 public:
-    RingtoneSettingStatusObserver() = default;
+    explicit RingtoneSettingStatusObserver(std::weak_ptr<Ring> ring) : ring_(ring) {}
     ~RingtoneSettingStatusObserver() = default;
     void OnChange() override;
+
+private:
+    std::weak_ptr<Ring> ring_;
 };
 #endif
 
 static constexpr const char* RING_PLAY_THREAD = "ringPlayThread";
 
+using RingtonePlayerCreator =
+    std::function<std::shared_ptr<Media::RingtonePlayer>(int32_t slotId, const std::string &ringtonePath)>;
+
 /**
  * @class Ring
  * plays the default or specific ringtone.
+ * The default ringtone player of a slot is created and configured ahead of the incoming call, Play takes it
+ * when the call uses the default ringtone and it still plays the current slot ringtone, a fresh one is prepared
+ * again after the ring is released.
  */
 class Ring : public std::enable_shared_from_this<Ring> {
 public:
@@ -65,6 +78,8 @@ public:
     void ReleaseRenderer();
     int32_t SetMute();
     int32_t SetRingToneVolume(float volume);
+    void PrewarmRingtonePlayer(int32_t slotId);
+    void RefreshPrewarmedPlayers();
 #ifdef OHOS_SUBSCRIBE_USER_STATUS_ENABLE
     void RegisterObserver();
     void UnRegisterObserver();
@@ -72,11 +87,28 @@ public:
     bool isMutedRing_ = false;
 
 private:
+    static constexpr int32_t PREWARM_SLOT_NUM = 2;
+    static bool IsPrewarmSlot(int32_t slotId);
+    std::shared_ptr<Media::RingtonePlayer> CreateRingtonePlayer(int32_t slotId, const std::string &ringtonePath);
+    std::string GetDefaultRingtoneUri(int32_t slotId);
+    std::shared_ptr<Media::RingtonePlayer> TakePrewarmedPlayer(int32_t slotId, const std::string &ringtonePath);
+    void DoPrewarmRingtonePlayer(int32_t slotId);
+    void ReleasePrewarmedPlayers();
+
+    ffrt::mutex prewarmMutex_;
+    std::shared_ptr<Media::RingtonePlayer> prewarmedPlayers_[PREWARM_SLOT_NUM];
+    std::string prewarmedUris_[PREWARM_SLOT_NUM];
+    uint64_t prewarmGeneration_ = 0;
+    std::atomic<int32_t> lastRingSlotId_{-1};
+    RingtonePlayerCreator ringtonePlayerCreator_ = nullptr;
 #ifdef OHOS_SUBSCRIBE_USER_STATUS_ENABLE
     void GetSettingsData();
+    void LoadSettingsData();
     void OnComfortReminderDataChanged(int32_t result, std::shared_ptr<UserStatusData> userStatusData);
     void PrepareComfortReminder();
     void SetRingToneVibrationState();
+    void StartVolumeRamp(int32_t fromLevel, int32_t toLevel, int64_t startDelayUs, int64_t durationUs);
+    void CancelVolumeRamp();
     void DecreaseVolume();
     void IncreaseVolume();
     void ResetComfortReminder();
@@ -87,17 +119,20 @@ private:
     bool isQuiet_ = false;
     bool isSwingMsgRecv_ = false;
     bool isEnvMsgRecv_ = false;
-    bool isRingStopped_ = false;
     int32_t oriRingVolLevel_ = 0;
     float oriVolumeDb_ = 0.0f;
     ffrt::mutex comfortReminderMutex_;
     ffrt::condition_variable conditionVar_;
-    ffrt::mutex ringStopMutex_;
-    ffrt::condition_variable ringStopCv_;
+    bool isRingStarted_ = false;
+    ffrt::mutex ringStartMutex_;
+    ffrt::condition_variable ringStartCv_;
     std::atomic<bool> isGentleHappend_{false};
     std::atomic<bool> isFadeupHappend_{false};
     std::atomic<bool> isAdaptiveSwitchOn_{false};
+    std::atomic<bool> isAdaptiveSwitchSetting_{false};
+    std::atomic<bool> isSettingsLoaded_{false};
     std::atomic<int32_t> curRingVolLevel_{0};
+    std::atomic<uint64_t> volumeRampId_{0};
     sptr<RingtoneSettingStatusObserver> ringtoneSettingStatusObserver_ = nullptr;
     void* userHandle_ = nullptr;
 #endif
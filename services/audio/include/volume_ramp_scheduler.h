@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_VOLUME_RAMP_SCHEDULER_H
+#define TELEPHONY_VOLUME_RAMP_SCHEDULER_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "ffrt.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace Telephony {
+constexpr uint64_t INVALID_VOLUME_RAMP_ID = 0;
+
+/**
+ * @brief One volume ramp, the gain of every step is computed before the ramp starts.
+ * onStep returns false to end the ramp early.
+ */
+struct VolumeRamp {
+    int64_t startDelayUs = 0;
+    int64_t intervalUs = 0;
+    std::vector<float> gains;
+    std::function<bool(size_t step, float gain)> onStep = nullptr;
+};
+
+/**
+ * @class VolumeRampScheduler
+ * Drives volume ramps as timer ticks shared by all ramps instead of a sleeping worker per ramp.
+ * Each tick applies one step and arms the next one, cancelling only forgets the ramp so a pending
+ * tick finds nothing to do.
+ */
+class VolumeRampScheduler : public std::enable_shared_from_this<VolumeRampScheduler> {
+    DECLARE_DELAYED_SINGLETON(VolumeRampScheduler)
+public:
+    uint64_t Start(VolumeRamp ramp);
+    bool Cancel(uint64_t rampId);
+    bool IsRunning(uint64_t rampId);
+    size_t GetRunningCount();
+
+private:
+    struct RampState {
+        VolumeRamp ramp;
+        size_t nextStep = 0;
+    };
+    void PostTick(uint64_t rampId, int64_t delayUs);
+    void OnTick(uint64_t rampId);
+
+    ffrt::mutex mutex_;
+    std::map<uint64_t, RampState> ramps_;
+    uint64_t lastRampId_ = INVALID_VOLUME_RAMP_ID;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_VOLUME_RAMP_SCHEDULER_H
@@ -20,6 +20,7 @@
 #include "call_control_manager.h"
 #include "call_dialog.h"
 #include "call_state_processor.h"
+#include "call_task_executor.h"
 #include "call_manager_hisysevent.h"
 #include "common_type.h"
 #include "distributed_call_manager.h"
@@ -42,16 +43,17 @@
 namespace OHOS {
 namespace Telephony {
 using namespace AudioStandard;
-constexpr int32_t DTMF_PLAY_TIME = 30;
+constexpr int64_t DTMF_PLAY_TIME_US = 30000;
 constexpr int32_t VOICE_TYPE = 0;
 constexpr int32_t CRS_TYPE = 2;
-constexpr int32_t CALL_ENDED_PLAY_TIME = 300;
+constexpr int64_t CALL_ENDED_PLAY_TIME_US = 300000;
 constexpr uint64_t UNMUTE_SOUNDTONE_DELAY_TIME = 500000;
 const int16_t MIN_MULITY_ACTIVE_CALL_COUNT = 1;
 const int16_t MIN_DC_MULITY_ACTIVE_CALL_COUNT = 2;
 const int32_t AUDIO_EVENT_MUTED_RINGTONE = 4;
 const int32_t MAX_RINGTONE_RETRY_COUNT = 5;
-const int32_t RINGTONE_RETRY_TIME = 200;
+const int64_t RINGTONE_RETRY_TIME_US = 200000;
+constexpr uint64_t INVALID_RING_ID = 0;
 bool AudioControlManager::isIncomingConflict_ = false;
 ffrt::mutex AudioControlManager::incomingMutex_ = {};
 
@@ -71,6 +73,7 @@ void AudioControlManager::Init()
 #ifdef OHOS_SUBSCRIBE_USER_STATUS_ENABLE
     ring_->RegisterObserver();
 #endif
+    ring_->PrewarmRingtonePlayer(DEFAULT_SIM_SLOT_ID);
 }
 
 void AudioControlManager::UnInit()
@@ -493,6 +496,11 @@ void AudioControlManager::HandleCallStateUpdated(
             }
         }
     }
+    if (priorState != nextState) {
+        // move in one step so lock-free readers never see the call in both states or in neither
+        DelayedSingleton<CallStateProcessor>::GetInstance()->MoveCall(
+            callObjectPtr->GetCallID(), priorState, nextState);
+    }
     HandleNextState(callObjectPtr, nextState);
     if (priorState == nextState) {
         TELEPHONY_LOGI("prior state equals next state");
@@ -985,19 +993,108 @@ void AudioControlManager::PlayRingtone(const sptr<CallBase>& incomingCall, const
         PlayRing(incomingCall, info, contactInfo);
         return;
     }
-    ffrt::submit([=]() {
-        int32_t retryCount = 0;
-        for (; retryCount < MAX_RINGTONE_RETRY_COUNT; ++retryCount) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(RINGTONE_RETRY_TIME));
-            if (!audioProxy->IsStreamActiveByStreamUsage(AudioStandard::StreamUsage::STREAM_USAGE_VOICE_RINGTONE)) {
-                PlayRing(incomingCall, info, contactInfo);
-                break;
-            }
+    DeferRing(incomingCall, info, contactInfo);
+}
+
+void AudioControlManager::DeferRing(
+    const sptr<CallBase> &incomingCall, const CallAttributeInfo &info, const ContactInfo &contactInfo)
+{
+    uint64_t ringId = INVALID_RING_ID;
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingRingMutex_);
+        ringId = ++lastRingId_;
+        pendingRing_.ringId = ringId;
+        pendingRing_.call = incomingCall;
+        pendingRing_.info = info;
+        pendingRing_.contactInfo = contactInfo;
+    }
+    TELEPHONY_LOGI("ringtone stream busy, defer ring %{public}d", static_cast<int32_t>(ringId));
+    // the release of the ringtone stream normally plays the ring, the checks only cover a missed callback
+    DelayedSingleton<AudioProxy>::GetInstance()->SetRingtoneStreamChangeCallback();
+    PostPendingRingCheck(ringId, 0);
+}
+
+void AudioControlManager::PostPendingRingCheck(uint64_t ringId, int32_t retryCount)
+{
+    auto weak = weak_from_this();
+    PostAudioTimer([weak, ringId, retryCount]() {
+        auto strong = weak.lock();
+        if (strong != nullptr) {
+            strong->CheckPendingRing(ringId, retryCount);
+        }
+    }, RINGTONE_RETRY_TIME_US);
+}
+
+bool AudioControlManager::TakePendingRing(uint64_t ringId, PendingRing &pendingRing)
+{
+    std::lock_guard<ffrt::mutex> lock(pendingRingMutex_);
+    if (pendingRing_.ringId == INVALID_RING_ID || (ringId != INVALID_RING_ID && pendingRing_.ringId != ringId)) {
+        return false;
+    }
+    pendingRing = pendingRing_;
+    pendingRing_ = PendingRing();
+    return true;
+}
+
+void AudioControlManager::CheckPendingRing(uint64_t ringId, int32_t retryCount)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingRingMutex_);
+        if (pendingRing_.ringId != ringId) {
+            return;
+        }
+    }
+    auto audioProxy = DelayedSingleton<AudioProxy>::GetInstance();
+    if (audioProxy == nullptr) {
+        return;
+    }
+    if (!audioProxy->IsStreamActiveByStreamUsage(AudioStandard::StreamUsage::STREAM_USAGE_VOICE_RINGTONE)) {
+        PlayPendingRing(ringId);
+        return;
+    }
+    if (retryCount + 1 < MAX_RINGTONE_RETRY_COUNT) {
+        PostPendingRingCheck(ringId, retryCount + 1);
+        return;
+    }
+    PendingRing pendingRing;
+    if (TakePendingRing(ringId, pendingRing)) {
+        TELEPHONY_LOGE("retryCount is %{public}d, give up ring %{public}d", retryCount + 1,
+            static_cast<int32_t>(ringId));
+        audioProxy->UnsetRingtoneStreamChangeCallback();
+    }
+}
+
+void AudioControlManager::OnRingtoneStreamReleased()
+{
+    auto weak = weak_from_this();
+    ffrt::submit([weak]() {
+        auto strong = weak.lock();
+        if (strong != nullptr) {
+            strong->PlayPendingRing(INVALID_RING_ID);
         }
-        TELEPHONY_LOGE("retryCount is %{public}d", retryCount);
     });
 }
 
+void AudioControlManager::PlayPendingRing(uint64_t ringId)
+{
+    PendingRing pendingRing;
+    if (!TakePendingRing(ringId, pendingRing)) {
+        return;
+    }
+    DelayedSingleton<AudioProxy>::GetInstance()->UnsetRingtoneStreamChangeCallback();
+    if (pendingRing.call == nullptr || pendingRing.call->GetTelCallState() != TelCallState::CALL_STATUS_INCOMING) {
+        TELEPHONY_LOGI("call is no longer incoming, drop deferred ring");
+        return;
+    }
+    std::lock_guard<ffrt::recursive_mutex> lock(ringMutex_);
+    PlayRing(pendingRing.call, pendingRing.info, pendingRing.contactInfo);
+}
+
+void AudioControlManager::PostAudioTimer(std::function<void()> task, int64_t delayUs)
+{
+    DelayedSingleton<CallTaskExecutor>::GetInstance()->Submit(std::move(task), delayUs);
+}
+
 void AudioControlManager::PlayRing(const sptr<CallBase>& incomingCall, const CallAttributeInfo& info,
     const ContactInfo& contactInfo)
 {
@@ -1338,6 +1435,7 @@ int32_t AudioControlManager::SetMute(bool isMute)
         }
     }
     DelayedSingleton<AudioDeviceManager>::GetInstance()->ReportAudioDeviceInfo();
+    DelayedSingleton<AudioDeviceManager>::GetInstance()->FlushAudioDeviceReport();
     if (currentCall->GetCallType() != CallType::TYPE_BLUETOOTH) {
         bool muted = DelayedSingleton<AudioProxy>::GetInstance()->IsMicrophoneMute();
         currentCall->SetMicPhoneState(muted);
@@ -1441,12 +1539,32 @@ void AudioControlManager::PlayCallEndedTone()
         TELEPHONY_LOGE("play call ended tone failed");
         return;
     }
+    StartCallEndedToneTimer();
+}
+
+void AudioControlManager::StartCallEndedToneTimer()
+{
+    std::lock_guard<std::recursive_mutex> lock(toneStateLock_);
     toneState_ = ToneState::CALLENDED;
-    std::this_thread::sleep_for(std::chrono::milliseconds(CALL_ENDED_PLAY_TIME));
+    uint64_t toneId = ++callEndedToneId_;
+    auto weak = weak_from_this();
+    PostAudioTimer([weak, toneId]() {
+        auto strong = weak.lock();
+        if (strong != nullptr) {
+            strong->StopCallEndedTone(toneId);
+        }
+    }, CALL_ENDED_PLAY_TIME_US);
+}
+
+void AudioControlManager::StopCallEndedTone(uint64_t toneId)
+{
+    std::lock_guard<std::recursive_mutex> lock(toneStateLock_);
+    if (toneId != callEndedToneId_ || toneState_ != ToneState::CALLENDED) {
+        return;
+    }
     toneState_ = ToneState::TONEING;
     if (StopCallTone() != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("stop call ended tone failed");
-        return;
     }
 }
 
@@ -1565,6 +1683,10 @@ int32_t AudioControlManager::PlayCallTone(ToneDescriptor type)
         TELEPHONY_LOGE("callTone is already playing");
         return CALL_ERR_AUDIO_TONE_PLAY_FAILED;
     }
+    if (toneState_ == ToneState::CALLENDED) {
+        // a new tone ends the call ended tone early instead of waiting for its timer
+        StopCallEndedTone(callEndedToneId_);
+    }
     toneState_ = ToneState::TONEING;
     tone_ = std::make_unique<Tone>(type);
     if (tone_ == nullptr) {
@@ -1661,9 +1783,27 @@ int32_t AudioControlManager::StopWaitingTone()
 }
 
 int32_t AudioControlManager::PlayDtmfTone(char str)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(dtmfMutex_);
+        if (isDtmfPlaying_) {
+            // dtmf tones never overlap, the next one starts when the playing one is stopped
+            pendingDtmfChars_.push_back(str);
+            return TELEPHONY_SUCCESS;
+        }
+        isDtmfPlaying_ = true;
+    }
+    int32_t ret = StartDtmfTone(str);
+    if (ret != TELEPHONY_SUCCESS) {
+        PlayNextDtmfTone();
+    }
+    return ret;
+}
+
+int32_t AudioControlManager::StartDtmfTone(char str)
 {
     ToneDescriptor dtmfTone = Tone::ConvertDigitToTone(str);
-    std::unique_ptr<Tone> tone = std::make_unique<Tone>(dtmfTone);
+    std::shared_ptr<Tone> tone = std::make_shared<Tone>(dtmfTone);
     if (tone == nullptr) {
         TELEPHONY_LOGE("create dtmf tone failed");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
@@ -1673,16 +1813,41 @@ int32_t AudioControlManager::PlayDtmfTone(char str)
         return CALL_ERR_AUDIO_TONE_PLAY_FAILED;
     }
     TELEPHONY_LOGI("play dtmftone success");
-    std::this_thread::sleep_for(std::chrono::milliseconds(DTMF_PLAY_TIME));
-    if (tone->Stop() != TELEPHONY_SUCCESS) {
-        TELEPHONY_LOGE("stop dtmftone failed");
-        return CALL_ERR_AUDIO_TONE_STOP_FAILED;
-    }
-    tone->ReleaseRenderer();
-    TELEPHONY_LOGI("stop dtmf tone success");
+    auto weak = weak_from_this();
+    PostAudioTimer([weak, tone]() {
+        if (tone->Stop() != TELEPHONY_SUCCESS) {
+            TELEPHONY_LOGE("stop dtmftone failed");
+        } else {
+            tone->ReleaseRenderer();
+            TELEPHONY_LOGI("stop dtmf tone success");
+        }
+        auto strong = weak.lock();
+        if (strong != nullptr) {
+            strong->PlayNextDtmfTone();
+        }
+    }, DTMF_PLAY_TIME_US);
     return TELEPHONY_SUCCESS;
 }
 
+void AudioControlManager::PlayNextDtmfTone()
+{
+    while (true) {
+        char str = 0;
+        {
+            std::lock_guard<ffrt::mutex> lock(dtmfMutex_);
+            if (pendingDtmfChars_.empty()) {
+                isDtmfPlaying_ = false;
+                return;
+            }
+            str = pendingDtmfChars_.front();
+            pendingDtmfChars_.pop_front();
+        }
+        if (StartDtmfTone(str) == TELEPHONY_SUCCESS) {
+            return;
+        }
+    }
+}
+
 int32_t AudioControlManager::StopDtmfTone()
 {
     return StopCallTone();
@@ -19,11 +19,14 @@
 #include "bluetooth_device_state.h"
 #include "call_ability_report_proxy.h"
 #include "call_manager_hisysevent.h"
+#include "call_manager_metrics.h"
 #include "call_manager_utils.h"
 #include "call_object_manager.h"
+#include "call_task_executor.h"
 #include "earpiece_device_state.h"
 #include "inactive_device_state.h"
 #include "speaker_device_state.h"
+#include "syspara/parameters.h"
 #include "telephony_log_wrapper.h"
 #include "wired_headset_device_state.h"
 #include "distributed_call_manager.h"
@@ -41,6 +44,10 @@ using namespace AudioStandard;
 constexpr int32_t DEVICE_ADDR_LEN = 7;
 constexpr int32_t ADDR_HEAD_VALID_LEN = 5;
 constexpr int32_t ADDR_TAIL_VALID_LEN = 2;
+// route flips during sco bring-up or headset plug settle well within this window
+constexpr int32_t AUDIO_DEVICE_REPORT_SETTLE_WINDOW_MS = 150;
+constexpr uint64_t MS_TO_US = 1000;
+const char *const AUDIO_DEVICE_REPORT_SETTLE_WINDOW_KEY = "const.telephony.audio_device_report_settle_ms";
 enum class AudioMode {
     AUDIO_MODE_DEFAULT = 0,
     AUDIO_MODE_SPEAKER = 1,
@@ -88,11 +95,14 @@ void AudioDeviceManager::Init()
         .address = { 0 },
     };
     info_.audioDeviceList.push_back(earpiece);
+    deviceRegistry_.Rebuild();
     if (CallManagerUtils::GetSystemParameter("const.product.devicetype", "") == "wearable") {
         isEarpieceAvailable_ = false;
     }
     callAudioMode_.audioMode = static_cast<int32_t>(AudioMode::AUDIO_MODE_DEFAULT);
     callAudioMode_.audioScene = static_cast<int32_t>(AudioScene::AUDIO_MODE_SCEN_CELLULAR_CALL_INCOMING);
+    SetAudioDeviceReportSettleWindow(
+        system::GetIntParameter(AUDIO_DEVICE_REPORT_SETTLE_WINDOW_KEY, AUDIO_DEVICE_REPORT_SETTLE_WINDOW_MS));
 }
 
 bool AudioDeviceManager::IsSupportEarpiece()
@@ -116,15 +126,10 @@ void AudioDeviceManager::UpdateEarpieceDevice()
     }
     isUpdateEarpieceDevice_ = true;
     std::lock_guard<ffrt::mutex> lock(infoMutex_);
-    std::vector<AudioDevice>::iterator it = info_.audioDeviceList.begin();
-    while (it != info_.audioDeviceList.end()) {
-        if (it->deviceType == AudioDeviceType::DEVICE_EARPIECE) {
-            it = info_.audioDeviceList.erase(it);
-            TELEPHONY_LOGI("not support Earpice, remove Earpice device success");
-            return;
-        } else {
-            ++it;
-        }
+    if (deviceRegistry_.RemoveIf([](const AudioDevice &device) {
+        return device.deviceType == AudioDeviceType::DEVICE_EARPIECE;
+    }) > 0) {
+        TELEPHONY_LOGI("not support Earpice, remove Earpice device success");
     }
 }
 
@@ -148,43 +153,28 @@ bool AudioDeviceManager::UpdateDeviceName(const std::string &macAddress, const s
     AudioDeviceType deviceType)
 {
     std::lock_guard<ffrt::mutex> lock(infoMutex_);
-    for (auto &device : info_.audioDeviceList) {
-        if (device.address == macAddress && (device.deviceType == deviceType)) {
-            if (deviceName.length() > kMaxDeviceNameLen) {
-                TELEPHONY_LOGE("deviceName is too long");
-                return false;
-            }
-            if (memset_s(device.deviceName, sizeof(device.deviceName), 0, sizeof(device.deviceName)) != EOK) {
-                TELEPHONY_LOGE("memset_s fail");
-                return false;
-            }
-            if (memcpy_s(device.deviceName, kMaxDeviceNameLen, deviceName.c_str(), deviceName.length()) != EOK) {
-                TELEPHONY_LOGE("memcpy_s deviceName fail");
-                return false;
-            }
-            TELEPHONY_LOGI("UpdateDeviceName for type %d", static_cast<int>(deviceType));
-            ReportAudioDeviceInfo();
-            return true;
-        }
+    if (!deviceRegistry_.UpdateDeviceName(macAddress, deviceType, deviceName)) {
+        return false;
     }
-    return false;
+    TELEPHONY_LOGI("UpdateDeviceName for type %d", static_cast<int>(deviceType));
+    OnDeviceListChanged();
+    return true;
 }
 
 void AudioDeviceManager::AddAudioDeviceList(const std::string &address, AudioDeviceType deviceType,
     const std::string &deviceName)
 {
     std::lock_guard<ffrt::mutex> lock(infoMutex_);
-    std::vector<AudioDevice>::iterator it = info_.audioDeviceList.begin();
-    while (it != info_.audioDeviceList.end()) {
-        if (it->address == address && it->deviceType == deviceType) {
-            TELEPHONY_LOGI("device is already existenced");
-            return;
-        }
-        if (deviceType == AudioDeviceType::DEVICE_WIRED_HEADSET && it->deviceType == AudioDeviceType::DEVICE_EARPIECE) {
-            it = info_.audioDeviceList.erase(it);
+    if (deviceRegistry_.Find(address, deviceType) != nullptr) {
+        TELEPHONY_LOGI("device is already existenced");
+        return;
+    }
+    if (deviceType == AudioDeviceType::DEVICE_WIRED_HEADSET) {
+        size_t removedCount = deviceRegistry_.RemoveIf([](const AudioDevice &device) {
+            return device.deviceType == AudioDeviceType::DEVICE_EARPIECE;
+        });
+        if (removedCount > 0) {
             TELEPHONY_LOGI("remove Earpiece device success");
-        } else {
-            ++it;
         }
     }
     AudioDevice audioDevice;
@@ -209,7 +199,7 @@ void AudioDeviceManager::AddAudioDeviceList(const std::string &address, AudioDev
         TELEPHONY_LOGE("memcpy_s deviceName fail");
         return;
     }
-    info_.audioDeviceList.push_back(audioDevice);
+    deviceRegistry_.Add(audioDevice);
     if (deviceType == AudioDeviceType::DEVICE_WIRED_HEADSET) {
         SetDeviceAvailable(AudioDeviceType::DEVICE_WIRED_HEADSET, true);
     }
@@ -219,36 +209,17 @@ void AudioDeviceManager::AddAudioDeviceList(const std::string &address, AudioDev
     if (IsDistributedAudioDeviceType(deviceType)) {
         SetDeviceAvailable(deviceType, true);
     }
-    ReportAudioDeviceInfo();
+    OnDeviceListChanged();
     TELEPHONY_LOGI("AddAudioDeviceList success");
 }
 
 void AudioDeviceManager::RemoveAudioDeviceList(const std::string &address, AudioDeviceType deviceType)
 {
     std::lock_guard<ffrt::mutex> lock(infoMutex_);
-    bool needAddEarpiece = true;
-    std::vector<AudioDevice>::iterator it = info_.audioDeviceList.begin();
-    while (it != info_.audioDeviceList.end()) {
-        if (it->deviceType == AudioDeviceType::DEVICE_EARPIECE) {
-            needAddEarpiece = false;
-        }
-        if (it->address == address && it->deviceType == deviceType) {
-            it = info_.audioDeviceList.erase(it);
-        } else {
-            ++it;
-        }
-    }
-
-    bool wiredHeadsetExist = false;
-    bool blueToothScoExist = false;
-    for (auto &elem : info_.audioDeviceList) {
-        if (elem.deviceType == AudioDeviceType::DEVICE_WIRED_HEADSET) {
-            wiredHeadsetExist = true;
-        }
-        if (elem.deviceType == AudioDeviceType::DEVICE_BLUETOOTH_SCO) {
-            blueToothScoExist = true;
-        }
-    }
+    bool needAddEarpiece = !deviceRegistry_.HasDeviceType(AudioDeviceType::DEVICE_EARPIECE);
+    deviceRegistry_.Remove(address, deviceType);
+    bool wiredHeadsetExist = deviceRegistry_.HasDeviceType(AudioDeviceType::DEVICE_WIRED_HEADSET);
+    bool blueToothScoExist = deviceRegistry_.HasDeviceType(AudioDeviceType::DEVICE_BLUETOOTH_SCO);
     if (deviceType == AudioDeviceType::DEVICE_WIRED_HEADSET && !wiredHeadsetExist) {
         SetDeviceAvailable(AudioDeviceType::DEVICE_WIRED_HEADSET, false);
     }
@@ -266,7 +237,7 @@ void AudioDeviceManager::RemoveAudioDeviceList(const std::string &address, Audio
         liveCall->GetCallType() == CallType::TYPE_SATELLITE)) {
         DelayedSingleton<AudioControlManager>::GetInstance()->UpdateDeviceType();
     }
-    ReportAudioDeviceInfo();
+    OnDeviceListChanged();
     TELEPHONY_LOGI("RemoveAudioDeviceList success");
 }
 
@@ -280,26 +251,19 @@ void AudioDeviceManager::AddEarpiece()
         .deviceType = AudioDeviceType::DEVICE_EARPIECE,
         .address = { 0 },
     };
-    info_.audioDeviceList.push_back(audioDevice);
+    deviceRegistry_.Add(audioDevice);
     TELEPHONY_LOGI("add Earpiece device success");
 }
 
 void AudioDeviceManager::ResetBtAudioDevicesList()
 {
     std::lock_guard<ffrt::mutex> lock(infoMutex_);
-    std::vector<AudioDevice>::iterator it = info_.audioDeviceList.begin();
-    bool hadBtActived = false;
-    while (it != info_.audioDeviceList.end()) {
-        if (it->deviceType == AudioDeviceType::DEVICE_BLUETOOTH_SCO) {
-            hadBtActived = true;
-            it = info_.audioDeviceList.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    bool hadBtActived = deviceRegistry_.RemoveIf([](const AudioDevice &device) {
+        return device.deviceType == AudioDeviceType::DEVICE_BLUETOOTH_SCO;
+    }) > 0;
     SetDeviceAvailable(AudioDeviceType::DEVICE_BLUETOOTH_SCO, false);
     if (hadBtActived) {
-        ReportAudioDeviceInfo();
+        OnDeviceListChanged();
     }
     TELEPHONY_LOGI("ResetBtAudioDevicesList success");
 }
@@ -307,37 +271,25 @@ void AudioDeviceManager::ResetBtAudioDevicesList()
 void AudioDeviceManager::ResetDistributedCallDevicesList()
 {
     std::lock_guard<ffrt::mutex> lock(infoMutex_);
-    std::vector<AudioDevice>::iterator it = info_.audioDeviceList.begin();
-    while (it != info_.audioDeviceList.end()) {
-        if (IsDistributedAudioDeviceType(it->deviceType)) {
-            it = info_.audioDeviceList.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    deviceRegistry_.RemoveIf([this](const AudioDevice &device) {
+        return IsDistributedAudioDeviceType(device.deviceType);
+    });
     SetDeviceAvailable(AudioDeviceType::DEVICE_DISTRIBUTED_AUTOMOTIVE, false);
     SetDeviceAvailable(AudioDeviceType::DEVICE_DISTRIBUTED_PHONE, false);
     SetDeviceAvailable(AudioDeviceType::DEVICE_DISTRIBUTED_PAD, false);
     SetDeviceAvailable(AudioDeviceType::DEVICE_DISTRIBUTED_PC, false);
-    DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAudioDeviceChange(info_);
+    OnDeviceListChanged(true);
     TELEPHONY_LOGI("Reset Distributed Audio Devices List success");
 }
 
 void AudioDeviceManager::ResetNearlinkAudioDevicesList()
 {
     std::unique_lock<ffrt::mutex> lock(infoMutex_);
-    std::vector<AudioDevice>::iterator it = info_.audioDeviceList.begin();
-    bool hadNearlinkActived = false;
-    while (it != info_.audioDeviceList.end()) {
-        if (it->deviceType == AudioDeviceType::DEVICE_NEARLINK) {
-            hadNearlinkActived = true;
-            it = info_.audioDeviceList.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    bool hadNearlinkActived = deviceRegistry_.RemoveIf([](const AudioDevice &device) {
+        return device.deviceType == AudioDeviceType::DEVICE_NEARLINK;
+    }) > 0;
     if (hadNearlinkActived) {
-        ReportAudioDeviceInfo();
+        OnDeviceListChanged();
     }
     lock.unlock();
     if (audioDeviceType_ == AudioDeviceType::DEVICE_NEARLINK) {
@@ -350,18 +302,11 @@ void AudioDeviceManager::ResetNearlinkAudioDevicesList()
 void AudioDeviceManager::ResetBtHearingAidDeviceList()
 {
     std::unique_lock<ffrt::mutex> lock(infoMutex_);
-    std::vector<AudioDevice>::iterator it = info_.audioDeviceList.begin();
-    bool hadBtHearingAidActived = false;
-    while (it != info_.audioDeviceList.end()) {
-        if (it->deviceType == AudioDeviceType::DEVICE_BLUETOOTH_HEARING_AID) {
-            hadBtHearingAidActived = true;
-            it = info_.audioDeviceList.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    bool hadBtHearingAidActived = deviceRegistry_.RemoveIf([](const AudioDevice &device) {
+        return device.deviceType == AudioDeviceType::DEVICE_BLUETOOTH_HEARING_AID;
+    }) > 0;
     if (hadBtHearingAidActived) {
-        ReportAudioDeviceInfo();
+        OnDeviceListChanged();
     }
     lock.unlock();
     if (audioDeviceType_ == AudioDeviceType::DEVICE_BLUETOOTH_HEARING_AID) {
@@ -425,6 +370,9 @@ bool AudioDeviceManager::ProcessEvent(AudioEvent event)
 bool AudioDeviceManager::SwitchDevice(AudioDeviceType device, bool isSetAudioDeviceByUser)
 {
     bool result = false;
+    CallManagerMetrics &metrics = CallManagerMetrics::GetInstance();
+    metrics.Increase(MetricCounter::AUDIO_ROUTE_SWITCH);
+    CallManagerMetricsTimer metricsTimer(MetricHistogram::AUDIO_ROUTE_LATENCY);
     std::lock_guard<ffrt::mutex> lock(mutex_);
     switch (device) {
         case AudioDeviceType::DEVICE_EARPIECE:
@@ -453,6 +401,11 @@ bool AudioDeviceManager::SwitchDevice(AudioDeviceType device, bool isSetAudioDev
         default:
             break;
     }
+    if (!result) {
+        metrics.Increase(MetricCounter::AUDIO_ROUTE_SWITCH_FAILED);
+    } else if (isSetAudioDeviceByUser) {
+        FlushAudioDeviceReport();
+    }
     TELEPHONY_LOGI("switch device lock release");
     return result;
 }
@@ -716,6 +669,54 @@ void AudioDeviceManager::UpdateBtHearingAidDevice(std::string &address, std::str
     deviceName = device.deviceName;
 }
 #endif
+void AudioDeviceManager::OnDeviceListChanged(bool isForceReport)
+{
+    hasPendingDeviceReport_ = true;
+    isPendingForceReport_ = isPendingForceReport_ || isForceReport;
+    if (deviceBatchDepth_ > 0) {
+        return;
+    }
+    FlushDeviceListChange();
+}
+
+void AudioDeviceManager::FlushDeviceListChange()
+{
+    if (!hasPendingDeviceReport_) {
+        return;
+    }
+    if (isPendingForceReport_) {
+        SubmitAudioDeviceReport(info_);
+    } else {
+        ReportAudioDeviceInfo();
+    }
+    hasPendingDeviceReport_ = false;
+    isPendingForceReport_ = false;
+}
+
+void AudioDeviceManager::BeginDeviceBatch()
+{
+    std::lock_guard<ffrt::mutex> lock(infoMutex_);
+    deviceBatchDepth_++;
+}
+
+void AudioDeviceManager::EndDeviceBatch()
+{
+    std::lock_guard<ffrt::mutex> lock(infoMutex_);
+    if (deviceBatchDepth_ <= 0) {
+        TELEPHONY_LOGE("device batch is not started");
+        return;
+    }
+    if (--deviceBatchDepth_ == 0) {
+        FlushDeviceListChange();
+    }
+}
+
+uint64_t AudioDeviceManager::GetAudioDeviceGeneration()
+{
+    std::lock_guard<ffrt::mutex> lock(infoMutex_);
+    return deviceRegistry_.GetGeneration();
+}
+
 int32_t AudioDeviceManager::ReportAudioDeviceInfo()
 {
     sptr<CallBase> liveCall = CallObjectManager::GetAudioLiveCall();
@@ -776,11 +777,97 @@ int32_t AudioDeviceManager::ReportAudioDeviceInfo(sptr<CallBase> call)
     CallManagerHisysevent::RecordVoipProcedure((call != nullptr) ? call->GetCallID() : -1,
         VoipProcedureEvent::CALLMANAGER_HANDLE_AUDIO_CHANGE,
         static_cast<int32_t>(info_.currentAudioDevice.deviceType));
-    int32_t ret = DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAudioDeviceChange(info_);
+    int32_t ret = SubmitAudioDeviceReport(info_);
     info_.currentAudioDevice.deviceType = deviceType;
     return ret;
 }
 
+void AudioDeviceManager::SetAudioDeviceReportSettleWindow(int32_t windowMs)
+{
+    TELEPHONY_LOGI("audio device report settle window %{public}d ms", windowMs);
+    reportSettleWindowMs_ = windowMs < 0 ? 0 : windowMs;
+    if (windowMs <= 0) {
+        FlushAudioDeviceReport();
+    }
+}
+
+int32_t AudioDeviceManager::SubmitAudioDeviceReport(const AudioDeviceInfo &info)
+{
+    CallManagerMetrics &metrics = CallManagerMetrics::GetInstance();
+    metrics.Increase(MetricCounter::AUDIO_DEVICE_REPORT_REQUEST);
+    metrics.Mark(MetricRate::AUDIO_DEVICE_REPORT_REQUEST);
+    int32_t windowMs = reportSettleWindowMs_;
+    uint64_t sequence = 0;
+    bool isScheduleFlush = false;
+    {
+        std::lock_guard<ffrt::mutex> lock(reportMutex_);
+        sequence = ++reportSequence_;
+        if (windowMs > 0) {
+            pendingReportInfo_ = info;
+            pendingReportSequence_ = sequence;
+            hasPendingReport_ = true;
+            isScheduleFlush = !isReportFlushScheduled_;
+            isReportFlushScheduled_ = true;
+        } else {
+            // a report sent now supersedes whatever is still settling
+            hasPendingReport_ = false;
+        }
+    }
+    if (windowMs <= 0) {
+        return SendAudioDeviceReport(info, sequence);
+    }
+    if (isScheduleFlush) {
+        // posted outside reportMutex_, the flush takes the same lock when it runs
+        std::weak_ptr<AudioDeviceManager> weak = weak_from_this();
+        DelayedSingleton<CallTaskExecutor>::GetInstance()->Submit([weak]() {
+            auto strong = weak.lock();
+            if (strong != nullptr) {
+                strong->OnAudioDeviceReportSettled();
+            }
+        }, static_cast<int64_t>(windowMs * MS_TO_US));
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+void AudioDeviceManager::OnAudioDeviceReportSettled()
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(reportMutex_);
+        isReportFlushScheduled_ = false;
+    }
+    FlushAudioDeviceReport();
+}
+
+int32_t AudioDeviceManager::FlushAudioDeviceReport()
+{
+    AudioDeviceInfo info;
+    uint64_t sequence = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(reportMutex_);
+        if (!hasPendingReport_) {
+            return TELEPHONY_SUCCESS;
+        }
+        info = pendingReportInfo_;
+        sequence = pendingReportSequence_;
+        hasPendingReport_ = false;
+    }
+    return SendAudioDeviceReport(info, sequence);
+}
+
+int32_t AudioDeviceManager::SendAudioDeviceReport(const AudioDeviceInfo &info, uint64_t sequence)
+{
+    std::lock_guard<ffrt::mutex> lock(reportSendMutex_);
+    if (sequence <= lastSentReportSequence_) {
+        TELEPHONY_LOGI("drop stale audio device report");
+        return TELEPHONY_SUCCESS;
+    }
+    lastSentReportSequence_ = sequence;
+    CallManagerMetrics &metrics = CallManagerMetrics::GetInstance();
+    metrics.Increase(MetricCounter::AUDIO_DEVICE_REPORT_SENT);
+    metrics.Mark(MetricRate::AUDIO_DEVICE_REPORT_SENT);
+    return DelayedSingleton<CallAbilityReportProxy>::GetInstance()->ReportAudioDeviceChange(info);
+}
+
 AudioDeviceType AudioDeviceManager::GetCurrentAudioDevice()
 {
     return audioDeviceType_;
@@ -978,5 +1065,19 @@ bool AudioDeviceManager::IsSpeakerMode()
     std::lock_guard<ffrt::mutex> lock(audioModeMutex_);
     return callAudioMode_.audioMode == static_cast<int32_t>(AudioMode::AUDIO_MODE_SPEAKER);
 }
+
+AudioDeviceBatch::AudioDeviceBatch() : audioDeviceManager_(DelayedSingleton<AudioDeviceManager>::GetInstance())
+{
+    if (audioDeviceManager_ != nullptr) {
+        audioDeviceManager_->BeginDeviceBatch();
+    }
+}
+
+AudioDeviceBatch::~AudioDeviceBatch()
+{
+    if (audioDeviceManager_ != nullptr) {
+        audioDeviceManager_->EndDeviceBatch();
+    }
+}
 } // namespace Telephony
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "audio_device_registry.h"
+
+#include "securec.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+AudioDeviceRegistry::AudioDeviceRegistry(std::vector<AudioDevice> &deviceList) : deviceList_(deviceList)
+{
+    RebuildIndex();
+}
+
+std::string AudioDeviceRegistry::GetKey(const std::string &address, AudioDeviceType deviceType)
+{
+    std::string key = std::to_string(static_cast<int32_t>(deviceType));
+    key.push_back('|');
+    key.append(address);
+    return key;
+}
+
+void AudioDeviceRegistry::Rebuild()
+{
+    RebuildIndex();
+    generation_++;
+}
+
+void AudioDeviceRegistry::RebuildIndex()
+{
+    index_.clear();
+    typeCount_.clear();
+    for (size_t i = 0; i < deviceList_.size(); i++) {
+        index_.emplace(GetKey(deviceList_[i].address, deviceList_[i].deviceType), i);
+        typeCount_[static_cast<int32_t>(deviceList_[i].deviceType)]++;
+    }
+}
+
+bool AudioDeviceRegistry::IsIndexInSync() const
+{
+    if (index_.size() != deviceList_.size()) {
+        TELEPHONY_LOGE("device index out of sync, index:%{public}zu list:%{public}zu",
+            index_.size(), deviceList_.size());
+        return false;
+    }
+    return true;
+}
+
+bool AudioDeviceRegistry::FindPosition(const std::string &key, size_t &position)
+{
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        IsIndexInSync();
+        return false;
+    }
+    if (it->second >= deviceList_.size() ||
+        GetKey(deviceList_[it->second].address, deviceList_[it->second].deviceType) != key) {
+        TELEPHONY_LOGE("device index points to a stale position %{public}zu", it->second);
+        return false;
+    }
+    position = it->second;
+    return true;
+}
+
+bool AudioDeviceRegistry::Add(const AudioDevice &device)
+{
+    if (!IsIndexInSync()) {
+        return false;
+    }
+    std::string key = GetKey(device.address, device.deviceType);
+    size_t position = 0;
+    if (FindPosition(key, position)) {
+        return false;
+    }
+    deviceList_.push_back(device);
+    index_.emplace(key, deviceList_.size() - 1);
+    typeCount_[static_cast<int32_t>(device.deviceType)]++;
+    generation_++;
+    return true;
+}
+
+bool AudioDeviceRegistry::Remove(const std::string &address, AudioDeviceType deviceType)
+{
+    std::string key = GetKey(address, deviceType);
+    size_t position = 0;
+    if (!FindPosition(key, position)) {
+        return false;
+    }
+    typeCount_[static_cast<int32_t>(deviceType)]--;
+    deviceList_.erase(deviceList_.begin() + static_cast<std::ptrdiff_t>(position));
+    index_.erase(key);
+    // only the devices behind the removed one move, shift their positions instead of rebuilding the index
+    for (size_t i = position; i < deviceList_.size(); i++) {
+        index_[GetKey(deviceList_[i].address, deviceList_[i].deviceType)] = i;
+    }
+    generation_++;
+    return true;
+}
+
+size_t AudioDeviceRegistry::RemoveIf(const std::function<bool(const AudioDevice &device)> &predicate)
+{
+    // compact the list in place and keep the index in step, the kept devices stay in their order
+    size_t keptCount = 0;
+    for (size_t i = 0; i < deviceList_.size(); i++) {
+        if (predicate(deviceList_[i])) {
+            typeCount_[static_cast<int32_t>(deviceList_[i].deviceType)]--;
+            index_.erase(GetKey(deviceList_[i].address, deviceList_[i].deviceType));
+            continue;
+        }
+        if (keptCount != i) {
+            deviceList_[keptCount] = deviceList_[i];
+            index_[GetKey(deviceList_[keptCount].address, deviceList_[keptCount].deviceType)] = keptCount;
+        }
+        keptCount++;
+    }
+    size_t removedCount = deviceList_.size() - keptCount;
+    if (removedCount > 0) {
+        deviceList_.resize(keptCount);
+        generation_++;
+    }
+    return removedCount;
+}
+
+bool AudioDeviceRegistry::UpdateDeviceName(
+    const std::string &address, AudioDeviceType deviceType, const std::string &deviceName)
+{
+    std::string key = GetKey(address, deviceType);
+    size_t position = 0;
+    if (!FindPosition(key, position)) {
+        return false;
+    }
+    if (deviceName.length() > kMaxDeviceNameLen) {
+        TELEPHONY_LOGE("deviceName is too long");
+        return false;
+    }
+    AudioDevice &device = deviceList_[position];
+    if (memset_s(device.deviceName, sizeof(device.deviceName), 0, sizeof(device.deviceName)) != EOK) {
+        TELEPHONY_LOGE("memset_s fail");
+        return false;
+    }
+    if (memcpy_s(device.deviceName, kMaxDeviceNameLen, deviceName.c_str(), deviceName.length()) != EOK) {
+        TELEPHONY_LOGE("memcpy_s deviceName fail");
+        return false;
+    }
+    generation_++;
+    return true;
+}
+
+const AudioDevice *AudioDeviceRegistry::Find(const std::string &address, AudioDeviceType deviceType)
+{
+    size_t position = 0;
+    if (!FindPosition(GetKey(address, deviceType), position)) {
+        return nullptr;
+    }
+    return &deviceList_[position];
+}
+
+bool AudioDeviceRegistry::HasDeviceType(AudioDeviceType deviceType)
+{
+    if (!IsIndexInSync()) {
+        return false;
+    }
+    auto it = typeCount_.find(static_cast<int32_t>(deviceType));
+    return it != typeCount_.end() && it->second > 0;
+}
+
+uint64_t AudioDeviceRegistry::GetGeneration() const
+{
+    return generation_;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "audio_event_scheduler.h"
+
+#include <algorithm>
+
+#include "audio_base.h"
+#include "call_manager_metrics.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+AudioEventLane AudioEventScheduler::GetLane(int32_t event)
+{
+    switch (event) {
+        case AudioEvent::NEW_INCOMING_CALL:
+        case AudioEvent::NEW_ALERTING_CALL:
+        case AudioEvent::NEW_DIALING_CALL:
+        case AudioEvent::SWITCH_INCOMING_STATE:
+        case AudioEvent::SWITCH_ALERTING_STATE:
+        case AudioEvent::SWITCH_DIALING_STATE:
+        case AudioEvent::NO_MORE_INCOMING_CALL:
+            return AudioEventLane::RING;
+        default:
+            return AudioEventLane::ROUTE;
+    }
+}
+
+bool AudioEventScheduler::IsStateSwitch(int32_t event)
+{
+    switch (event) {
+        case AudioEvent::SWITCH_CS_CALL_STATE:
+        case AudioEvent::SWITCH_IMS_CALL_STATE:
+        case AudioEvent::SWITCH_OTT_CALL_STATE:
+        case AudioEvent::SWITCH_DIALING_STATE:
+        case AudioEvent::SWITCH_ALERTING_STATE:
+        case AudioEvent::SWITCH_INCOMING_STATE:
+        case AudioEvent::SWITCH_HOLDING_STATE:
+        case AudioEvent::SWITCH_AUDIO_INACTIVE_STATE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool AudioEventScheduler::IsCollapsible(int32_t event)
+{
+    // these switches only replace the state object, dropping one that is superseded has no side effect
+    return event == AudioEvent::SWITCH_CS_CALL_STATE || event == AudioEvent::SWITCH_IMS_CALL_STATE ||
+        event == AudioEvent::SWITCH_HOLDING_STATE;
+}
+
+std::deque<AudioEventScheduler::Item> &AudioEventScheduler::GetLaneQueue(AudioEventLane lane)
+{
+    return lanes_[static_cast<uint32_t>(lane)];
+}
+
+bool AudioEventScheduler::Submit(int32_t event, Task task)
+{
+    return Submit(GetLane(event), event, std::move(task));
+}
+
+bool AudioEventScheduler::Submit(AudioEventLane lane, int32_t event, Task task)
+{
+    if (lane >= AudioEventLane::LANE_BUTT || task == nullptr) {
+        TELEPHONY_LOGE("invalid audio event %{public}d", event);
+        return false;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    bool isCollapsed = lane != AudioEventLane::CLEANUP && IsStateSwitch(event) && CollapseLocked(event);
+    Item item;
+    item.sequence = ++sequence_;
+    item.event = event;
+    item.task = std::move(task);
+    item.enqueueTime = std::chrono::steady_clock::now();
+    GetLaneQueue(lane).push_back(std::move(item));
+    // a collapsed switch reuses the run slot of the one it replaced
+    return !isCollapsed;
+}
+
+bool AudioEventScheduler::CollapseLocked(int32_t event)
+{
+    std::deque<Item> &ring = GetLaneQueue(AudioEventLane::RING);
+    std::deque<Item> &route = GetLaneQueue(AudioEventLane::ROUTE);
+    std::deque<Item> *newest = nullptr;
+    if (!ring.empty() && (route.empty() || ring.back().sequence > route.back().sequence)) {
+        newest = &ring;
+    } else if (!route.empty()) {
+        newest = &route;
+    }
+    if (newest == nullptr || !IsCollapsible(newest->back().event)) {
+        return false;
+    }
+    TELEPHONY_LOGI("audio event %{public}d supersedes pending %{public}d", event, newest->back().event);
+    latencyStats_[newest->back().event].collapsed++;
+    newest->pop_back();
+    return true;
+}
+
+bool AudioEventScheduler::PopNextLocked(Item &item)
+{
+    std::deque<Item> &ring = GetLaneQueue(AudioEventLane::RING);
+    std::deque<Item> &route = GetLaneQueue(AudioEventLane::ROUTE);
+    std::deque<Item> &cleanup = GetLaneQueue(AudioEventLane::CLEANUP);
+    std::deque<Item> *next = nullptr;
+    auto pickEarlier = [&next](std::deque<Item> &lane) {
+        if (!lane.empty() && (next == nullptr || lane.front().sequence < next->front().sequence)) {
+            next = &lane;
+        }
+    };
+    pickEarlier(ring);
+    pickEarlier(route);
+    if (ring.empty()) {
+        pickEarlier(cleanup);
+    }
+    if (next == nullptr) {
+        return false;
+    }
+    item = std::move(next->front());
+    next->pop_front();
+    return true;
+}
+
+bool AudioEventScheduler::RunNext()
+{
+    Item item;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (!PopNextLocked(item)) {
+            return false;
+        }
+        int64_t waitUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - item.enqueueTime).count();
+        LatencyStat &stat = latencyStats_[item.event];
+        stat.count++;
+        stat.sumUs += waitUs;
+        stat.maxUs = std::max(stat.maxUs, waitUs);
+        CallManagerMetrics::GetInstance().Record(MetricHistogram::AUDIO_EVENT_WAIT, waitUs);
+    }
+    item.task();
+    return true;
+}
+
+size_t AudioEventScheduler::GetPendingCount()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    size_t count = 0;
+    for (auto &lane : lanes_) {
+        count += lane.size();
+    }
+    return count;
+}
+
+void AudioEventScheduler::Dump(std::string &result)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    result.append("Audio event wait(us):\n");
+    for (auto &it : latencyStats_) {
+        const LatencyStat &stat = it.second;
+        int64_t avgUs = stat.count == 0 ? 0 : stat.sumUs / static_cast<int64_t>(stat.count);
+        result.append("  event ").append(std::to_string(it.first))
+            .append(": count ").append(std::to_string(stat.count))
+            .append(" avg ").append(std::to_string(avgUs))
+            .append(" max ").append(std::to_string(stat.maxUs))
+            .append(" collapsed ").append(std::to_string(stat.collapsed)).append("\n");
+    }
+}
+
+void AudioEventScheduler::ResetStats()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    latencyStats_.clear();
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -57,7 +57,8 @@ const std::string LOCAL_DEVICE = "LocalDevice";
 AudioProxy::AudioProxy()
     : deviceCallback_(std::make_shared<AudioDeviceChangeCallback>()),
       preferredDeviceCallback_(std::make_shared<AudioPreferDeviceChangeCallback>()),
-      audioMicStateChangeCallback_(std::make_shared<AudioMicStateChangeCallback>())
+      audioMicStateChangeCallback_(std::make_shared<AudioMicStateChangeCallback>()),
+      ringtoneStreamChangeCallback_(std::make_shared<AudioRingtoneStreamChangeCallback>())
 {}
 
 AudioProxy::~AudioProxy() {}
@@ -268,6 +269,7 @@ AudioStandard::AudioRingerMode AudioProxy::GetRingerMode() const
 void AudioDeviceChangeCallback::OnDeviceChange(const AudioStandard::DeviceChangeAction &deviceChangeAction)
 {
     TELEPHONY_LOGI("AudioDeviceChangeCallback::OnDeviceChange enter");
+    AudioDeviceBatch batch;
     for (auto &audioDeviceDescriptor : deviceChangeAction.deviceDescriptors) {
         if ((audioDeviceDescriptor->deviceType_ == AudioStandard::DEVICE_TYPE_WIRED_HEADSET ||
             audioDeviceDescriptor->deviceType_ == AudioStandard::DEVICE_TYPE_WIRED_HEADPHONES ||
@@ -612,6 +614,61 @@ void AudioMicStateChangeCallback::OnMicStateUpdated(
     DelayedSingleton<CallControlManager>::GetInstance()->SetMuted(audioGroupManager->IsMicrophoneMute());
 }
 
+int32_t AudioProxy::SetRingtoneStreamChangeCallback()
+{
+    if (ringtoneStreamChangeCallback_ == nullptr) {
+        TELEPHONY_LOGE("ringtoneStreamChangeCallback_ is nullptr");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    std::lock_guard<ffrt::mutex> lock(ringtoneStreamCallbackMutex_);
+    if (isRingtoneStreamCallbackSet_) {
+        return TELEPHONY_SUCCESS;
+    }
+    int32_t ret =
+        AudioStandard::AudioStreamManager::GetInstance()->RegisterAudioRendererEventListener(
+            ringtoneStreamChangeCallback_);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("SetRingtoneStreamChangeCallback fail");
+        return CALL_ERR_AUDIO_OPERATE_FAILED;
+    }
+    isRingtoneStreamCallbackSet_ = true;
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t AudioProxy::UnsetRingtoneStreamChangeCallback()
+{
+    if (ringtoneStreamChangeCallback_ == nullptr) {
+        TELEPHONY_LOGE("ringtoneStreamChangeCallback_ is nullptr");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    std::lock_guard<ffrt::mutex> lock(ringtoneStreamCallbackMutex_);
+    if (!isRingtoneStreamCallbackSet_) {
+        return TELEPHONY_SUCCESS;
+    }
+    int32_t ret =
+        AudioStandard::AudioStreamManager::GetInstance()->UnregisterAudioRendererEventListener(
+            ringtoneStreamChangeCallback_);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("UnsetRingtoneStreamChangeCallback fail");
+        return CALL_ERR_AUDIO_OPERATE_FAILED;
+    }
+    isRingtoneStreamCallbackSet_ = false;
+    return TELEPHONY_SUCCESS;
+}
+
+void AudioRingtoneStreamChangeCallback::OnRendererStateChange(
+    const std::vector<std::shared_ptr<AudioStandard::AudioRendererChangeInfo>> &audioRendererChangeInfos)
+{
+    for (const auto &changeInfo : audioRendererChangeInfos) {
+        if (changeInfo != nullptr &&
+            changeInfo->rendererInfo.streamUsage == AudioStandard::StreamUsage::STREAM_USAGE_VOICE_RINGTONE &&
+            changeInfo->rendererState == AudioStandard::RendererState::RENDERER_RUNNING) {
+            return;
+        }
+    }
+    DelayedSingleton<AudioControlManager>::GetInstance()->OnRingtoneStreamReleased();
+}
+
 float AudioProxy::GetSystemRingVolumeInDb(int32_t volumeLevel)
 {
     std::shared_ptr<AudioStandard::AudioGroupManager> audioGroupManager =
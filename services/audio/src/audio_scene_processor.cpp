@@ -89,26 +89,12 @@ void AudioSceneProcessor::ProcessEventInner(AudioEvent event)
         case AudioEvent::NO_MORE_ACTIVE_CALL:
         case AudioEvent::NO_MORE_ALERTING_CALL:
             DelayedSingleton<AudioControlManager>::GetInstance()->StopRingback();
-            if (DelayedSingleton<CallStateProcessor>::GetInstance()->ShouldStopSoundtone()) {
-                DelayedSingleton<AudioControlManager>::GetInstance()->
-                    PlayCallEndedTone();
-            } else {
-#ifdef CALL_MANAGER_SOS_NO_RINGBACK_TONE
-                PlaySosSoundTone(event);
-#endif
-            }
+            SubmitEndedTone(event, DelayedSingleton<CallStateProcessor>::GetInstance()->ShouldStopSoundtone());
             currentState_->ProcessEvent(event);
             break;
         case AudioEvent::NO_MORE_DIALING_CALL:
         case AudioEvent::NO_MORE_HOLDING_CALL:
-            if (DelayedSingleton<CallStateProcessor>::GetInstance()->ShouldStopSoundtone()) {
-                DelayedSingleton<AudioControlManager>::GetInstance()->
-                    PlayCallEndedTone();
-            } else {
-#ifdef CALL_MANAGER_SOS_NO_RINGBACK_TONE
-                PlaySosSoundTone(event);
-#endif
-            }
+            SubmitEndedTone(event, DelayedSingleton<CallStateProcessor>::GetInstance()->ShouldStopSoundtone());
             currentState_->ProcessEvent(event);
             break;
         case AudioEvent::NEW_ACTIVE_CS_CALL:
@@ -125,10 +111,51 @@ void AudioSceneProcessor::ProcessEventInner(AudioEvent event)
 
 bool AudioSceneProcessor::ProcessEvent(AudioEvent event)
 {
-    reportAudioStateChangeQueue.submit([=]() { ProcessEventInner(event); });
+    SubmitToScheduler(AudioEventScheduler::GetLane(event), event, [this, event]() { ProcessEventInner(event); });
     return true;
 }
 
+void AudioSceneProcessor::SubmitToScheduler(AudioEventLane lane, AudioEvent event, AudioEventScheduler::Task task)
+{
+    // one run slot per queued item, the scheduler decides which item the slot executes
+    if (eventScheduler_.Submit(lane, event, std::move(task))) {
+        reportAudioStateChangeQueue.submit([this]() { eventScheduler_.RunNext(); });
+    }
+}
+
+void AudioSceneProcessor::SubmitEndedTone(AudioEvent event, bool isCallEnded)
+{
+#ifndef CALL_MANAGER_SOS_NO_RINGBACK_TONE
+    if (!isCallEnded) {
+        return;
+    }
+#endif
+    uint64_t ringEpoch = ringEpoch_.load();
+    SubmitToScheduler(AudioEventLane::CLEANUP, event, [this, event, isCallEnded, ringEpoch]() {
+        if (ringEpoch != ringEpoch_.load()) {
+            TELEPHONY_LOGI("ended tone of event %{public}d is superseded by a new call", event);
+            return;
+        }
+        if (isCallEnded) {
+            DelayedSingleton<AudioControlManager>::GetInstance()->PlayCallEndedTone();
+            return;
+        }
+#ifdef CALL_MANAGER_SOS_NO_RINGBACK_TONE
+        PlaySosSoundTone(event);
+#endif
+    });
+}
+
+void AudioSceneProcessor::DumpEventLatency(std::string &result)
+{
+    eventScheduler_.Dump(result);
+}
+
+void AudioSceneProcessor::ResetEventLatency()
+{
+    eventScheduler_.ResetStats();
+}
+
 bool AudioSceneProcessor::SwitchState(AudioEvent event)
 {
     auto itFunc = memberFuncMap_.find(event);
@@ -180,6 +207,7 @@ bool AudioSceneProcessor::SwitchDialing()
     if (audioDeviceManager == nullptr || audioControlManager == nullptr) {
         return false;
     }
+    ringEpoch_++;
     currentState_ = std::make_unique<DialingState>();
     if (currentState_ == nullptr) {
         TELEPHONY_LOGE("make_unique DialingState failed");
@@ -199,6 +227,7 @@ bool AudioSceneProcessor::SwitchDialing()
 
 bool AudioSceneProcessor::SwitchAlerting()
 {
+    ringEpoch_++;
     currentState_ = std::make_unique<AlertingState>();
     if (currentState_ == nullptr) {
         TELEPHONY_LOGE("make_unique AlertingState failed");
@@ -223,6 +252,7 @@ bool AudioSceneProcessor::SwitchIncoming()
     if (callStateProcessor->GetCallNumber(TelCallState::CALL_STATUS_INCOMING) > 1) {
         AudioControlManager::SetIncomingConflict(true);
     }
+    ringEpoch_++;
     currentState_ = std::make_unique<IncomingState>();
     if (currentState_ == nullptr) {
         return false;
@@ -15,6 +15,8 @@
 
 #include "call_state_processor.h"
 
+#include <algorithm>
+
 #include "audio_control_manager.h"
 #include "audio_scene_processor.h"
 #include "call_object_manager.h"
@@ -26,139 +28,172 @@ CallStateProcessor::CallStateProcessor() {}
 
 CallStateProcessor::~CallStateProcessor()
 {
-    activeCalls_.clear();
-    alertingCalls_.clear();
-    incomingCalls_.clear();
-    holdingCalls_.clear();
-    dialingCalls_.clear();
+    for (auto &calls : stateCalls_) {
+        calls.clear();
+    }
 }
 
-void CallStateProcessor::AddCall(int32_t callId, TelCallState state)
+uint32_t CallStateProcessor::GetStateIndex(TelCallState state)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
     switch (state) {
         case TelCallState::CALL_STATUS_DIALING:
-            if (dialingCalls_.count(callId) == EMPTY_VALUE) {
-                TELEPHONY_LOGI("add call , state : dialing");
-                dialingCalls_.insert(callId);
-            }
-            break;
+            return DIALING_INDEX;
         case TelCallState::CALL_STATUS_ALERTING:
-            if (alertingCalls_.count(callId) == EMPTY_VALUE) {
-                TELEPHONY_LOGI("add call , state : alerting");
-                alertingCalls_.insert(callId);
-            }
-            break;
-        case TelCallState::CALL_STATUS_WAITING:
+            return ALERTING_INDEX;
         case TelCallState::CALL_STATUS_INCOMING:
-            if (incomingCalls_.count(callId) == EMPTY_VALUE) {
-                TELEPHONY_LOGI("add call , state : incoming");
-                incomingCalls_.insert(callId);
-            }
-            break;
+            return INCOMING_INDEX;
         case TelCallState::CALL_STATUS_ACTIVE:
-        case TelCallState::CALL_STATUS_ANSWERED:
-            if (activeCalls_.count(callId) == EMPTY_VALUE) {
-                TELEPHONY_LOGI("add call , state : active");
-                activeCalls_.insert(callId);
-            }
-            break;
+            return ACTIVE_INDEX;
         case TelCallState::CALL_STATUS_HOLDING:
-            if (holdingCalls_.count(callId) == EMPTY_VALUE) {
-                TELEPHONY_LOGI("add call , state : holding");
-                holdingCalls_.insert(callId);
-            }
-            break;
+            return HOLDING_INDEX;
         default:
-            break;
+            return INVALID_INDEX;
+    }
+}
+
+uint32_t CallStateProcessor::GetCount(uint64_t counts, uint32_t index)
+{
+    return static_cast<uint32_t>((counts >> (index * COUNT_BITS)) & COUNT_MASK);
+}
+
+bool CallStateProcessor::InsertLocked(int32_t callId, uint32_t index)
+{
+    if (index >= STATE_INDEX_NUM) {
+        return false;
+    }
+    std::vector<int32_t> &calls = stateCalls_[index];
+    auto it = std::lower_bound(calls.begin(), calls.end(), callId);
+    if (it != calls.end() && *it == callId) {
+        return false;
+    }
+    calls.insert(it, callId);
+    return true;
+}
+
+bool CallStateProcessor::EraseLocked(int32_t callId, uint32_t index)
+{
+    if (index >= STATE_INDEX_NUM) {
+        return false;
+    }
+    std::vector<int32_t> &calls = stateCalls_[index];
+    auto it = std::lower_bound(calls.begin(), calls.end(), callId);
+    if (it == calls.end() || *it != callId) {
+        return false;
+    }
+    calls.erase(it);
+    return true;
+}
+
+void CallStateProcessor::PublishLocked()
+{
+    uint64_t counts = 0;
+    for (uint32_t index = 0; index < STATE_INDEX_NUM; index++) {
+        uint64_t count = std::min(static_cast<uint64_t>(stateCalls_[index].size()), COUNT_MASK);
+        counts |= count << (index * COUNT_BITS);
+    }
+    // same precedence as the audio focus: active, dialing, alerting, incoming, holding
+    const uint32_t foregroundOrder[] = { ACTIVE_INDEX, DIALING_INDEX, ALERTING_INDEX, INCOMING_INDEX, HOLDING_INDEX };
+    int32_t foregroundCallId = INVALID_CALLID;
+    for (uint32_t index : foregroundOrder) {
+        if (!stateCalls_[index].empty()) {
+            foregroundCallId = stateCalls_[index].front();
+            break;
+        }
+    }
+    int32_t activeCallId = stateCalls_[ACTIVE_INDEX].empty() ? INVALID_CALLID : stateCalls_[ACTIVE_INDEX].front();
+    foregroundCallId_.store(foregroundCallId, std::memory_order_release);
+    activeCallId_.store(activeCallId, std::memory_order_release);
+    stateCounts_.store(counts, std::memory_order_release);
+}
+
+void CallStateProcessor::AddCall(int32_t callId, TelCallState state)
+{
+    if (state == TelCallState::CALL_STATUS_WAITING) {
+        state = TelCallState::CALL_STATUS_INCOMING;
+    } else if (state == TelCallState::CALL_STATUS_ANSWERED) {
+        state = TelCallState::CALL_STATUS_ACTIVE;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (InsertLocked(callId, GetStateIndex(state))) {
+        TELEPHONY_LOGI("add call %{public}d, state : %{public}d", callId, state);
+        PublishLocked();
     }
 }
 
 void CallStateProcessor::DeleteCall(int32_t callId, TelCallState state)
 {
+    if (state == TelCallState::CALL_STATUS_WAITING) {
+        state = TelCallState::CALL_STATUS_INCOMING;
+    }
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    switch (state) {
-        case TelCallState::CALL_STATUS_DIALING:
-            if (dialingCalls_.count(callId) > EMPTY_VALUE) {
-                TELEPHONY_LOGI("erase call , state : dialing");
-                dialingCalls_.erase(callId);
-            }
-            break;
-        case TelCallState::CALL_STATUS_ALERTING:
-            if (alertingCalls_.count(callId) > EMPTY_VALUE) {
-                TELEPHONY_LOGI("erase call , state : alerting");
-                alertingCalls_.erase(callId);
-            }
-            break;
-        case TelCallState::CALL_STATUS_WAITING:
-        case TelCallState::CALL_STATUS_INCOMING:
-            if (incomingCalls_.count(callId) > EMPTY_VALUE) {
-                TELEPHONY_LOGI("erase call , state : incoming");
-                incomingCalls_.erase(callId);
-            }
-            break;
-        case TelCallState::CALL_STATUS_ACTIVE:
-            if (activeCalls_.count(callId) > EMPTY_VALUE) {
-                TELEPHONY_LOGI("erase call , state : active");
-                activeCalls_.erase(callId);
-            }
-            break;
-        case TelCallState::CALL_STATUS_HOLDING:
-            if (holdingCalls_.count(callId) > EMPTY_VALUE) {
-                TELEPHONY_LOGI("erase call , state : holding");
-                holdingCalls_.erase(callId);
-            }
-            break;
-        default:
-            break;
+    if (EraseLocked(callId, GetStateIndex(state))) {
+        TELEPHONY_LOGI("erase call %{public}d, state : %{public}d", callId, state);
+        PublishLocked();
     }
 }
 
-int32_t CallStateProcessor::GetCallNumber(TelCallState state)
+void CallStateProcessor::MoveCall(int32_t callId, TelCallState priorState, TelCallState nextState)
 {
+    if (priorState == TelCallState::CALL_STATUS_WAITING) {
+        priorState = TelCallState::CALL_STATUS_INCOMING;
+    }
+    if (nextState == TelCallState::CALL_STATUS_WAITING) {
+        nextState = TelCallState::CALL_STATUS_INCOMING;
+    } else if (nextState == TelCallState::CALL_STATUS_ANSWERED) {
+        nextState = TelCallState::CALL_STATUS_ACTIVE;
+    }
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    int32_t number = EMPTY_VALUE;
-    switch (state) {
-        case TelCallState::CALL_STATUS_DIALING:
-            number = static_cast<int32_t>(dialingCalls_.size());
-            break;
-        case TelCallState::CALL_STATUS_ALERTING:
-            number = static_cast<int32_t>(alertingCalls_.size());
-            break;
-        case TelCallState::CALL_STATUS_INCOMING:
-            number = static_cast<int32_t>(incomingCalls_.size());
-            break;
-        case TelCallState::CALL_STATUS_ACTIVE:
-            number = static_cast<int32_t>(activeCalls_.size());
-            break;
-        case TelCallState::CALL_STATUS_HOLDING:
-            number = static_cast<int32_t>(holdingCalls_.size());
-            break;
-        default:
-            break;
+    bool isErased = EraseLocked(callId, GetStateIndex(priorState));
+    bool isInserted = InsertLocked(callId, GetStateIndex(nextState));
+    if (isErased || isInserted) {
+        TELEPHONY_LOGI("move call %{public}d, state : %{public}d -> %{public}d", callId, priorState, nextState);
+        PublishLocked();
     }
-    return number;
 }
 
-bool CallStateProcessor::ShouldSwitchState(TelCallState callState)
+void CallStateProcessor::ClearCalls(TelCallState state)
 {
+    uint32_t index = GetStateIndex(state);
+    if (index >= STATE_INDEX_NUM) {
+        return;
+    }
     std::lock_guard<ffrt::mutex> lock(mutex_);
+    stateCalls_[index].clear();
+    PublishLocked();
+}
+
+int32_t CallStateProcessor::GetCallNumber(TelCallState state)
+{
+    uint32_t index = GetStateIndex(state);
+    if (index >= STATE_INDEX_NUM) {
+        return EMPTY_VALUE;
+    }
+    return static_cast<int32_t>(GetCount(stateCounts_.load(std::memory_order_acquire), index));
+}
+
+bool CallStateProcessor::ShouldSwitchState(TelCallState callState)
+{
+    uint64_t counts = stateCounts_.load(std::memory_order_acquire);
+    uint32_t dialing = GetCount(counts, DIALING_INDEX);
+    uint32_t alerting = GetCount(counts, ALERTING_INDEX);
+    uint32_t incoming = GetCount(counts, INCOMING_INDEX);
+    uint32_t active = GetCount(counts, ACTIVE_INDEX);
     bool shouldSwitch = false;
     switch (callState) {
         case TelCallState::CALL_STATUS_DIALING:
-            shouldSwitch = (dialingCalls_.size() == EXIST_ONLY_ONE_CALL && activeCalls_.empty() &&
-                incomingCalls_.empty() && alertingCalls_.empty());
+            shouldSwitch = (dialing == EXIST_ONLY_ONE_CALL && active == EMPTY_VALUE &&
+                incoming == EMPTY_VALUE && alerting == EMPTY_VALUE);
             break;
         case TelCallState::CALL_STATUS_ALERTING:
-            shouldSwitch = (alertingCalls_.size() == EXIST_ONLY_ONE_CALL && activeCalls_.empty() &&
-                incomingCalls_.empty() && dialingCalls_.empty());
+            shouldSwitch = (alerting == EXIST_ONLY_ONE_CALL && active == EMPTY_VALUE &&
+                incoming == EMPTY_VALUE && dialing == EMPTY_VALUE);
             break;
         case TelCallState::CALL_STATUS_INCOMING:
-            shouldSwitch = (incomingCalls_.size() == EXIST_ONLY_ONE_CALL && activeCalls_.empty() &&
-                dialingCalls_.empty() && alertingCalls_.empty());
+            shouldSwitch = (incoming == EXIST_ONLY_ONE_CALL && active == EMPTY_VALUE &&
+                dialing == EMPTY_VALUE && alerting == EMPTY_VALUE);
             break;
         case TelCallState::CALL_STATUS_ACTIVE:
-            shouldSwitch = (activeCalls_.size() == EXIST_ONLY_ONE_CALL);
+            shouldSwitch = (active == EXIST_ONLY_ONE_CALL);
             break;
         default:
             break;
@@ -168,19 +203,19 @@ bool CallStateProcessor::ShouldSwitchState(TelCallState callState)
 
 bool CallStateProcessor::UpdateCurrentCallState()
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    if (activeCalls_.size() > EMPTY_VALUE) {
+    uint64_t counts = stateCounts_.load(std::memory_order_acquire);
+    if (GetCount(counts, ACTIVE_INDEX) > EMPTY_VALUE) {
         // no need to update call state while active calls exists
         return false;
     }
     AudioEvent event = AudioEvent::UNKNOWN_EVENT;
-    if (holdingCalls_.size() > EMPTY_VALUE) {
+    if (GetCount(counts, HOLDING_INDEX) > EMPTY_VALUE) {
         event = AudioEvent::SWITCH_HOLDING_STATE;
-    } else if (incomingCalls_.size() > EMPTY_VALUE) {
+    } else if (GetCount(counts, INCOMING_INDEX) > EMPTY_VALUE) {
         event = AudioEvent::SWITCH_INCOMING_STATE;
-    } else if (dialingCalls_.size() > EMPTY_VALUE) {
+    } else if (GetCount(counts, DIALING_INDEX) > EMPTY_VALUE) {
         event = AudioEvent::SWITCH_DIALING_STATE;
-    } else if (alertingCalls_.size() > EMPTY_VALUE) {
+    } else if (GetCount(counts, ALERTING_INDEX) > EMPTY_VALUE) {
         event = AudioEvent::SWITCH_ALERTING_STATE;
     } else {
         event = AudioEvent::SWITCH_AUDIO_INACTIVE_STATE;
@@ -191,44 +226,24 @@ bool CallStateProcessor::UpdateCurrentCallState()
 
 bool CallStateProcessor::ShouldStopSoundtone()
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    if (activeCalls_.size() > EMPTY_VALUE
-        || (incomingCalls_.size() > EMPTY_VALUE && CallObjectManager::HasIncomingCallCrsType())) {
+    uint64_t counts = stateCounts_.load(std::memory_order_acquire);
+    if (GetCount(counts, ACTIVE_INDEX) > EMPTY_VALUE ||
+        (GetCount(counts, INCOMING_INDEX) > EMPTY_VALUE && CallObjectManager::HasIncomingCallCrsType())) {
         // no need to stop soundtone
         return false;
     }
-    if (holdingCalls_.size() == EMPTY_VALUE && dialingCalls_.size() == EMPTY_VALUE &&
-        alertingCalls_.size() == EMPTY_VALUE) {
-        return true;
-    }
-    return false;
+    return GetCount(counts, HOLDING_INDEX) == EMPTY_VALUE && GetCount(counts, DIALING_INDEX) == EMPTY_VALUE &&
+        GetCount(counts, ALERTING_INDEX) == EMPTY_VALUE;
 }
 
 int32_t CallStateProcessor::GetAudioForegroundLiveCall()
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    int32_t callId = INVALID_CALLID;
-    if (activeCalls_.size() > EMPTY_VALUE) {
-        callId = *activeCalls_.begin();
-    } else if (dialingCalls_.size() > EMPTY_VALUE) {
-        callId = *dialingCalls_.begin();
-    } else if (alertingCalls_.size() > EMPTY_VALUE) {
-        callId = *alertingCalls_.begin();
-    } else if (incomingCalls_.size() > EMPTY_VALUE) {
-        callId = *incomingCalls_.begin();
-    } else if (holdingCalls_.size() > EMPTY_VALUE) {
-        callId = *holdingCalls_.begin();
-    }
-    return callId;
+    return foregroundCallId_.load(std::memory_order_acquire);
 }
 
 int32_t CallStateProcessor::GetCurrentActiveCall()
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    if (activeCalls_.size() > EMPTY_VALUE) {
-        return (*activeCalls_.begin());
-    }
-    return INVALID_CALLID;
+    return activeCallId_.load(std::memory_order_acquire);
 }
 } // namespace Telephony
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
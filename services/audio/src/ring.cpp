@@ -21,7 +21,9 @@
 #include "audio_player.h"
 #include "call_base.h"
 #include "call_control_manager.h"
+#include "call_manager_metrics.h"
 #include "telephony_log_wrapper.h"
+#include "volume_ramp_scheduler.h"
 #include "cpp/task_ext.h"
 namespace OHOS {
 namespace Telephony {
@@ -32,7 +34,6 @@ constexpr int32_t VOL_LEVEL_UNDER_LINE = 3;
 constexpr int32_t TIMEOUT_LIMIT = 500; //ms
 constexpr int32_t DECREASE_DURATION = 500000; //us
 constexpr int32_t INCREASE_DURATION = 5000000; //us
-constexpr int32_t ONE_AND_HALF_SECOND = 1500; //ms
 constexpr int32_t ONE_AND_HALF_SECOND_US = 1500000; //us
 constexpr int32_t US_TO_MS = 1000;
 constexpr uint32_t FEATURE_COMFORT_REMINDER = 15;
@@ -61,6 +62,7 @@ Ring::Ring()
 Ring::~Ring()
 {
     TELEPHONY_LOGI("~Ring Destory");
+    ReleasePrewarmedPlayers();
 #ifdef OHOS_SUBSCRIBE_USER_STATUS_ENABLE
     if (userHandle_ != nullptr) {
         dlclose(userHandle_);
@@ -97,25 +99,166 @@ void Ring::Init()
 #endif
 }
 
+bool Ring::IsPrewarmSlot(int32_t slotId)
+{
+    return slotId >= 0 && slotId < PREWARM_SLOT_NUM;
+}
+
+std::shared_ptr<Media::RingtonePlayer> Ring::CreateRingtonePlayer(int32_t slotId, const std::string &ringtonePath)
+{
+    if (ringtonePlayerCreator_ != nullptr) {
+        return ringtonePlayerCreator_(slotId, ringtonePath);
+    }
+    if (SystemSoundManager_ == nullptr) {
+        TELEPHONY_LOGE("SystemSoundManager_ is nullptr");
+        return nullptr;
+    }
+    const std::shared_ptr<AbilityRuntime::Context> context;
+    Media::RingtoneType type = slotId == DEFAULT_SIM_SLOT_ID ? Media::RingtoneType::RINGTONE_TYPE_SIM_CARD_0 :
+        Media::RingtoneType::RINGTONE_TYPE_SIM_CARD_1;
+    return SystemSoundManager_->GetSpecificRingTonePlayer(context, type, ringtonePath);
+}
+
+std::string Ring::GetDefaultRingtoneUri(int32_t slotId)
+{
+    if (SystemSoundManager_ == nullptr) {
+        return "";
+    }
+    Media::RingtoneType type = slotId == DEFAULT_SIM_SLOT_ID ? Media::RingtoneType::RINGTONE_TYPE_SIM_CARD_0 :
+        Media::RingtoneType::RINGTONE_TYPE_SIM_CARD_1;
+    return SystemSoundManager_->GetCurrentRingtoneAttribute(type).GetUri();
+}
+
+std::shared_ptr<Media::RingtonePlayer> Ring::TakePrewarmedPlayer(int32_t slotId, const std::string &ringtonePath)
+{
+    // only the slot default ringtone is prewarmed, contact specific ringtones are created on demand
+    if (!IsPrewarmSlot(slotId) || !ringtonePath.empty()) {
+        return nullptr;
+    }
+    std::string currentUri = GetDefaultRingtoneUri(slotId);
+    std::unique_lock<ffrt::mutex> lock(prewarmMutex_);
+    std::shared_ptr<Media::RingtonePlayer> player = prewarmedPlayers_[slotId];
+    std::string prewarmedUri = prewarmedUris_[slotId];
+    prewarmedPlayers_[slotId] = nullptr;
+    prewarmedUris_[slotId].clear();
+    lock.unlock();
+    if (player != nullptr && prewarmedUri != currentUri) {
+        // the user picked another ringtone since the player was prepared, play the new one from the cold path
+        TELEPHONY_LOGI("slot ringtone changed, drop the prewarmed player, slotId:%{public}d", slotId);
+        player->Release();
+        return nullptr;
+    }
+    return player;
+}
+
+void Ring::PrewarmRingtonePlayer(int32_t slotId)
+{
+    if (!IsPrewarmSlot(slotId)) {
+        return;
+    }
+    std::weak_ptr<Ring> weakPtr = weak_from_this();
+    ffrt::submit([weakPtr, slotId]() {
+        std::shared_ptr<Ring> strongPtr = weakPtr.lock();
+        if (strongPtr != nullptr) {
+            strongPtr->DoPrewarmRingtonePlayer(slotId);
+        }
+    });
+}
+
+void Ring::DoPrewarmRingtonePlayer(int32_t slotId)
+{
+    if (!IsPrewarmSlot(slotId)) {
+        return;
+    }
+    uint64_t generation = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(prewarmMutex_);
+        if (prewarmedPlayers_[slotId] != nullptr) {
+            return;
+        }
+        generation = prewarmGeneration_;
+    }
+#ifdef OHOS_SUBSCRIBE_USER_STATUS_ENABLE
+    if (!isSettingsLoaded_) {
+        LoadSettingsData();
+    }
+#endif
+    std::string ringtoneUri = GetDefaultRingtoneUri(slotId);
+    std::shared_ptr<Media::RingtonePlayer> player = CreateRingtonePlayer(slotId, "");
+    if (player == nullptr) {
+        TELEPHONY_LOGE("prewarm ringtone player failed, slotId:%{public}d", slotId);
+        return;
+    }
+    if (player->Configure(defaultVolume_, true) != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("configure prewarmed ringtone player failed");
+    }
+    std::unique_lock<ffrt::mutex> lock(prewarmMutex_);
+    if (generation == prewarmGeneration_ && prewarmedPlayers_[slotId] == nullptr) {
+        prewarmedPlayers_[slotId] = player;
+        prewarmedUris_[slotId] = ringtoneUri;
+        TELEPHONY_LOGI("ringtone player prewarmed, slotId:%{public}d", slotId);
+        return;
+    }
+    lock.unlock();
+    // a refresh or another prewarm won the race, the player was never started
+    player->Release();
+}
+
+void Ring::ReleasePrewarmedPlayers()
+{
+    std::shared_ptr<Media::RingtonePlayer> players[PREWARM_SLOT_NUM];
+    {
+        std::lock_guard<ffrt::mutex> lock(prewarmMutex_);
+        prewarmGeneration_++;
+        for (int32_t slotId = 0; slotId < PREWARM_SLOT_NUM; slotId++) {
+            players[slotId] = prewarmedPlayers_[slotId];
+            prewarmedPlayers_[slotId] = nullptr;
+            prewarmedUris_[slotId].clear();
+        }
+    }
+    for (auto &player : players) {
+        if (player != nullptr) {
+            player->Release();
+        }
+    }
+}
+
+void Ring::RefreshPrewarmedPlayers()
+{
+#ifdef OHOS_SUBSCRIBE_USER_STATUS_ENABLE
+    LoadSettingsData();
+#endif
+    ReleasePrewarmedPlayers();
+    PrewarmRingtonePlayer(DEFAULT_SIM_SLOT_ID);
+    int32_t lastRingSlotId = lastRingSlotId_;
+    if (lastRingSlotId != DEFAULT_SIM_SLOT_ID) {
+        PrewarmRingtonePlayer(lastRingSlotId);
+    }
+}
+
 int32_t Ring::Play(int32_t slotId, std::string ringtonePath, Media::HapticStartupMode mode)
 {
+    CallManagerMetricsTimer timer(MetricHistogram::RING_START_LATENCY);
     std::lock_guard<ffrt::mutex> lock(mutex_);
     if (SystemSoundManager_ == nullptr || audioPlayer_ == nullptr) {
         TELEPHONY_LOGE("SystemSoundManager_ or audioPlayer_ is nullptr");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    const std::shared_ptr<AbilityRuntime::Context> context;
-    Media::RingtoneType type = slotId == DEFAULT_SIM_SLOT_ID ? Media::RingtoneType::RINGTONE_TYPE_SIM_CARD_0 :
-        Media::RingtoneType::RINGTONE_TYPE_SIM_CARD_1;
     TELEPHONY_LOGI("ringtonePath: %{public}s", ringtonePath.c_str());
-    RingtonePlayer_ = SystemSoundManager_->GetSpecificRingTonePlayer(context, type, ringtonePath);
+    lastRingSlotId_ = slotId;
+    RingtonePlayer_ = TakePrewarmedPlayer(slotId, ringtonePath);
+    bool isPrewarmed = RingtonePlayer_ != nullptr;
+    CallManagerMetrics::GetInstance().Increase(
+        isPrewarmed ? MetricCounter::RINGTONE_PREWARM_HIT : MetricCounter::RINGTONE_PREWARM_MISS);
+    if (!isPrewarmed) {
+        RingtonePlayer_ = CreateRingtonePlayer(slotId, ringtonePath);
+    }
     if (RingtonePlayer_ == nullptr) {
         TELEPHONY_LOGE("get RingtonePlayer failed");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
     audioPlayer_->RegisterRingCallback(RingtonePlayer_);
-    int32_t result = RingtonePlayer_->Configure(defaultVolume_, true);
-    if (result != TELEPHONY_SUCCESS) {
+    if (!isPrewarmed && RingtonePlayer_->Configure(defaultVolume_, true) != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("configure failed");
     }
 
@@ -151,10 +294,7 @@ int32_t Ring::Stop()
     lockMuteRing.unlock();
     DelayedSingleton<CallControlManager>::GetInstance()->SetReduceRingToneVolume(false);
 #ifdef OHOS_SUBSCRIBE_USER_STATUS_ENABLE
-    std::unique_lock<ffrt::mutex> lockRing(ringStopMutex_);
-    isRingStopped_ = true;
-    lockRing.unlock();
-    ringStopCv_.notify_all();
+    CancelVolumeRamp();
     UnsubscribeFeature();
     ResetComfortReminder();
 #endif
@@ -168,6 +308,8 @@ void Ring::ReleaseRenderer()
         return;
     }
     RingtonePlayer_->Release();
+    // ringtone players are single use, prepare the next one while the device is idle
+    PrewarmRingtonePlayer(lastRingSlotId_);
 }
 
 int32_t Ring::SetMute()
@@ -208,7 +350,7 @@ void Ring::RegisterObserver()
     if (ringtoneSettingStatusObserver_ != nullptr) {
         return;
     }
-    ringtoneSettingStatusObserver_ = new (std::nothrow) RingtoneSettingStatusObserver();
+    ringtoneSettingStatusObserver_ = new (std::nothrow) RingtoneSettingStatusObserver(weak_from_this());
     if (ringtoneSettingStatusObserver_ == nullptr) {
         TELEPHONY_LOGE("ringtoneSettingStatusObserver is null");
         return;
@@ -236,23 +378,42 @@ void Ring::UnRegisterObserver()
 
 void RingtoneSettingStatusObserver::OnChange()
 {
+    std::weak_ptr<Ring> weakPtr = ring_;
+    ffrt::submit([weakPtr]() {
+        std::shared_ptr<Ring> strongPtr = weakPtr.lock();
+        if (strongPtr != nullptr) {
+            strongPtr->RefreshPrewarmedPlayers();
+        }
+    });
 }
 
 void Ring::GetSettingsData()
+{
+    if (!isSettingsLoaded_) {
+        LoadSettingsData();
+    }
+    isAdaptiveSwitchOn_ = isAdaptiveSwitchSetting_.load();
+}
+
+void Ring::LoadSettingsData()
 {
     if (!OHOS::system::GetBoolParameter(RINGADAPTIVE_MODE_STATE, false)) {
         TELEPHONY_LOGI("ringtone vibrate adaptive is disabled");
-        isAdaptiveSwitchOn_ = false;
+        isAdaptiveSwitchSetting_ = false;
+        isSettingsLoaded_ = true;
         return;
     }
     std::string ringtoneSettingStatus = "";
+    bool isQueried = false;
     auto settingHelper = SettingsDataShareHelper::GetInstance();
     if (settingHelper != nullptr) {
         OHOS::Uri settingUri(SettingsDataShareHelper::SETTINGS_DATASHARE_URI);
-        settingHelper->Query(settingUri, ADAPTIVE_SWITCH, ringtoneSettingStatus);
+        isQueried = settingHelper->Query(settingUri, ADAPTIVE_SWITCH, ringtoneSettingStatus) == TELEPHONY_SUCCESS;
     }
     TELEPHONY_LOGI("ringtone vibrate adaptive: %{public}s", ringtoneSettingStatus.c_str());
-    isAdaptiveSwitchOn_ = ringtoneSettingStatus == "true";
+    isAdaptiveSwitchSetting_ = ringtoneSettingStatus == "true";
+    // keep querying on each ring until the settings database answers once
+    isSettingsLoaded_ = isQueried;
 }
 
 void Ring::OnComfortReminderDataChanged(int32_t result, std::shared_ptr<UserStatusData> userStatusData)
@@ -422,7 +583,6 @@ void Ring::PrepareComfortReminder()
         return;
     }
     controlManager->SetReduceRingToneVolume(true);
-    isRingStopped_ = false;
     auto audioProxy = DelayedSingleton<AudioProxy>::GetInstance();
     oriRingVolLevel_ = audioProxy->GetVolume(AudioStandard::AudioVolumeType::STREAM_RING);
     curRingVolLevel_ = oriRingVolLevel_;
@@ -459,66 +619,63 @@ void Ring::PrepareComfortReminder()
     }
 }
 
-void Ring::DecreaseVolume()
+void Ring::StartVolumeRamp(int32_t fromLevel, int32_t toLevel, int64_t startDelayUs, int64_t durationUs)
 {
-    int totalSteps = curRingVolLevel_ - VOL_LEVEL_UNDER_LINE;
+    int32_t totalSteps = toLevel > fromLevel ? toLevel - fromLevel : fromLevel - toLevel;
     if (oriVolumeDb_ <= 0.0f || totalSteps <= 0) {
         TELEPHONY_LOGE("invalid oriVolumeDb %{public}f or steps %{public}d", oriVolumeDb_, totalSteps);
         return;
     }
+    int32_t direction = toLevel > fromLevel ? 1 : -1;
     auto audioProxy = DelayedSingleton<AudioProxy>::GetInstance();
-    int32_t ringVolume = curRingVolLevel_;
-    const int interval = DECREASE_DURATION / totalSteps;
-    TELEPHONY_LOGI("DecreaseVolume totalSteps %{public}d, interval %{public}d", totalSteps, interval);
-    for (int i = 0; i < totalSteps; ++i) {
-        std::unique_lock<ffrt::mutex> lock(ringStopMutex_);
-        if (ringStopCv_.wait_for(lock, std::chrono::microseconds(interval),
-            [this] {return isRingStopped_; })) {
-            TELEPHONY_LOGI("DecreaseVolume interrupt by ring stop");
-            return;
+    VolumeRamp ramp;
+    ramp.startDelayUs = startDelayUs;
+    ramp.intervalUs = durationUs / totalSteps;
+    ramp.gains.reserve(totalSteps);
+    for (int32_t i = 1; i <= totalSteps; i++) {
+        ramp.gains.push_back(audioProxy->GetSystemRingVolumeInDb(fromLevel + direction * i) / oriVolumeDb_);
+    }
+    TELEPHONY_LOGI("volume ramp %{public}d -> %{public}d, interval %{public}d", fromLevel, toLevel,
+        static_cast<int32_t>(ramp.intervalUs));
+    std::weak_ptr<Ring> weakPtr = weak_from_this();
+    ramp.onStep = [weakPtr, fromLevel, direction](size_t step, float gain) {
+        std::shared_ptr<Ring> strongPtr = weakPtr.lock();
+        if (strongPtr == nullptr) {
+            return false;
+        }
+        if (direction > 0 && strongPtr->isGentleHappend_) {
+            TELEPHONY_LOGI("IncreaseVolume interrupt by DecreaseVolume");
+            return false;
         }
-        lock.unlock();
-        ringVolume--;
-        float endVolumeDb = audioProxy->GetSystemRingVolumeInDb(ringVolume);
-        SetRingToneVolume(endVolumeDb / oriVolumeDb_);
+        strongPtr->SetRingToneVolume(gain);
+        strongPtr->curRingVolLevel_ = fromLevel + direction * static_cast<int32_t>(step + 1);
+        return true;
+    };
+    auto rampScheduler = DelayedSingleton<VolumeRampScheduler>::GetInstance();
+    uint64_t previousRampId = volumeRampId_.exchange(rampScheduler->Start(std::move(ramp)));
+    if (previousRampId != INVALID_VOLUME_RAMP_ID) {
+        rampScheduler->Cancel(previousRampId);
     }
 }
 
-void Ring::IncreaseVolume()
+void Ring::CancelVolumeRamp()
 {
-    int totalSteps = oriRingVolLevel_ - VOL_LEVEL_UNDER_LINE;
-    if (oriVolumeDb_ <= 0.0f || totalSteps <= 0) {
-        TELEPHONY_LOGE("invalid oriVolumeDb %{public}f or steps %{public}d", oriVolumeDb_, totalSteps);
-        return;
-    }
-    auto audioProxy = DelayedSingleton<AudioProxy>::GetInstance();
-    int32_t ringVolume = VOL_LEVEL_UNDER_LINE;
-    const int interval = (INCREASE_DURATION - ONE_AND_HALF_SECOND_US) / totalSteps;
-    TELEPHONY_LOGI("IncreaseVolume totalSteps %{public}d, interval %{public}d", totalSteps, interval);
-    std::unique_lock<ffrt::mutex> lock(ringStopMutex_);
-    if (ringStopCv_.wait_for(lock, std::chrono::milliseconds(ONE_AND_HALF_SECOND), [this] { return isRingStopped_; })) {
-        TELEPHONY_LOGI("IncreaseVolume interrupt by ring stop in 1.5 sec");
-        return;
-    }
-    lock.unlock();
-    for (int i = 0; i < totalSteps; ++i) {
-        std::unique_lock<ffrt::mutex> innerLock(ringStopMutex_);
-        if (ringStopCv_.wait_for(innerLock, std::chrono::microseconds(interval),
-            [this] { return isRingStopped_; })) {
-            TELEPHONY_LOGI("IncreaseVolume interrupt by ring stop");
-            return;
-        }
-        innerLock.unlock();
-        if (isGentleHappend_) {
-            TELEPHONY_LOGI("IncreaseVolume interrupt by DecreaseVolume");
-            return;
-        }
-        ringVolume++;
-        float endVolumeDb = audioProxy->GetSystemRingVolumeInDb(ringVolume);
-        SetRingToneVolume(endVolumeDb / oriVolumeDb_);
-        curRingVolLevel_ = ringVolume;
+    uint64_t rampId = volumeRampId_.exchange(INVALID_VOLUME_RAMP_ID);
+    if (rampId != INVALID_VOLUME_RAMP_ID && DelayedSingleton<VolumeRampScheduler>::GetInstance()->Cancel(rampId)) {
+        TELEPHONY_LOGI("volume ramp interrupt by ring stop");
     }
 }
+
+void Ring::DecreaseVolume()
+{
+    StartVolumeRamp(curRingVolLevel_, VOL_LEVEL_UNDER_LINE, 0, DECREASE_DURATION);
+}
+
+void Ring::IncreaseVolume()
+{
+    StartVolumeRamp(VOL_LEVEL_UNDER_LINE, oriRingVolLevel_, ONE_AND_HALF_SECOND_US,
+        INCREASE_DURATION - ONE_AND_HALF_SECOND_US);
+}
 #endif //OHOS_SUBSCRIBE_USER_STATUS_ENABLE
 } // namespace Telephony
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "volume_ramp_scheduler.h"
+
+#include "call_task_executor.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+VolumeRampScheduler::VolumeRampScheduler() {}
+
+VolumeRampScheduler::~VolumeRampScheduler() {}
+
+uint64_t VolumeRampScheduler::Start(VolumeRamp ramp)
+{
+    if (ramp.gains.empty() || ramp.onStep == nullptr || ramp.intervalUs < 0 || ramp.startDelayUs < 0) {
+        TELEPHONY_LOGE("invalid volume ramp");
+        return INVALID_VOLUME_RAMP_ID;
+    }
+    int64_t firstDelayUs = ramp.startDelayUs + ramp.intervalUs;
+    uint64_t rampId = INVALID_VOLUME_RAMP_ID;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        rampId = ++lastRampId_;
+        RampState state;
+        state.ramp = std::move(ramp);
+        ramps_.emplace(rampId, std::move(state));
+    }
+    PostTick(rampId, firstDelayUs);
+    return rampId;
+}
+
+bool VolumeRampScheduler::Cancel(uint64_t rampId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return ramps_.erase(rampId) != 0;
+}
+
+bool VolumeRampScheduler::IsRunning(uint64_t rampId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return ramps_.count(rampId) != 0;
+}
+
+size_t VolumeRampScheduler::GetRunningCount()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return ramps_.size();
+}
+
+void VolumeRampScheduler::PostTick(uint64_t rampId, int64_t delayUs)
+{
+    std::weak_ptr<VolumeRampScheduler> weakPtr = weak_from_this();
+    auto task = [weakPtr, rampId]() {
+        std::shared_ptr<VolumeRampScheduler> strongPtr = weakPtr.lock();
+        if (strongPtr != nullptr) {
+            strongPtr->OnTick(rampId);
+        }
+    };
+    DelayedSingleton<CallTaskExecutor>::GetInstance()->Submit(task, delayUs);
+}
+
+void VolumeRampScheduler::OnTick(uint64_t rampId)
+{
+    size_t step = 0;
+    float gain = 0.0f;
+    bool isLastStep = false;
+    std::function<bool(size_t step, float gain)> onStep = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto it = ramps_.find(rampId);
+        if (it == ramps_.end()) {
+            // cancelled while the tick was pending
+            return;
+        }
+        RampState &state = it->second;
+        step = state.nextStep++;
+        gain = state.ramp.gains[step];
+        isLastStep = state.nextStep >= state.ramp.gains.size();
+        onStep = state.ramp.onStep;
+    }
+    bool shouldContinue = onStep(step, gain);
+    int64_t intervalUs = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto it = ramps_.find(rampId);
+        if (it == ramps_.end()) {
+            return;
+        }
+        if (!shouldContinue || isLastStep) {
+            ramps_.erase(it);
+            return;
+        }
+        intervalUs = it->second.ramp.intervalUs;
+    }
+    PostTick(rampId, intervalUs);
+}
+} // namespace Telephony
+} // namespace OHOS
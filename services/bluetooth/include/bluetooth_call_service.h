@@ -173,10 +173,12 @@ public:
 #endif
 
 private:
-    std::vector<int32_t> getCallInfoNum(int32_t &callState, std::string &number);
+    std::vector<int32_t> getCallInfoNum(const CallStateCensus &census, int32_t &callState, std::string &number);
     void sendEventToVoip(CallAbilityEventId eventId);
 private:
     void GetVoipCallState(int32_t &numActive, int32_t &callState, std::string &number);
+    void GetVoipCallState(
+        const CallAttributeInfo &callAttributeInfo, int32_t &numActive, int32_t &callState, std::string &number);
     std::shared_ptr<CallControlManager> callControlManagerPtr_;
     bool sendDtmfState_;
     int32_t sendDtmfCallId_;
@@ -26,11 +26,13 @@ BluetoothCallPolicy::~BluetoothCallPolicy() {}
 
 int32_t BluetoothCallPolicy::AnswerCallPolicy(int32_t &callId)
 {
-    if (IsCallExist(TelCallState::CALL_STATUS_INCOMING, callId)) {
+    CallStateCensus census;
+    GetCallStateCensus(census);
+    if (census.IsCallExist(TelCallState::CALL_STATUS_INCOMING, callId)) {
         TELEPHONY_LOGI("incoming call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_WAITING, callId)) {
+    if (census.IsCallExist(TelCallState::CALL_STATUS_WAITING, callId)) {
         TELEPHONY_LOGI("waiting call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
@@ -40,11 +42,13 @@ int32_t BluetoothCallPolicy::AnswerCallPolicy(int32_t &callId)
 
 int32_t BluetoothCallPolicy::RejectCallPolicy(int32_t &callId)
 {
-    if (IsCallExist(TelCallState::CALL_STATUS_INCOMING, callId)) {
+    CallStateCensus census;
+    GetCallStateCensus(census);
+    if (census.IsCallExist(TelCallState::CALL_STATUS_INCOMING, callId)) {
         TELEPHONY_LOGI("incoming call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_WAITING, callId)) {
+    if (census.IsCallExist(TelCallState::CALL_STATUS_WAITING, callId)) {
         TELEPHONY_LOGI("waiting call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
@@ -64,11 +68,13 @@ int32_t BluetoothCallPolicy::HoldCallPolicy(int32_t &callId)
 
 int32_t BluetoothCallPolicy::UnHoldCallPolicy(int32_t &callId)
 {
-    if (IsCallExist(TelCallState::CALL_STATUS_ACTIVE, callId)) {
+    CallStateCensus census;
+    GetCallStateCensus(census);
+    if (census.IsCallExist(TelCallState::CALL_STATUS_ACTIVE, callId)) {
         TELEPHONY_LOGI("active call is exist, callId:%{public}d", callId);
         return CALL_ERR_ILLEGAL_CALL_OPERATION;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_HOLDING, callId)) {
+    if (census.IsCallExist(TelCallState::CALL_STATUS_HOLDING, callId)) {
         TELEPHONY_LOGI("holding call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
@@ -82,23 +88,25 @@ int32_t BluetoothCallPolicy::HangUpPolicy(int32_t &callId)
         TELEPHONY_LOGI("active call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_DIALING, callId)) {
+    CallStateCensus census;
+    GetCallStateCensus(census);
+    if (census.IsCallExist(TelCallState::CALL_STATUS_DIALING, callId)) {
         TELEPHONY_LOGI("dialing call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_ALERTING, callId)) {
+    if (census.IsCallExist(TelCallState::CALL_STATUS_ALERTING, callId)) {
         TELEPHONY_LOGI("alerting call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_INCOMING, callId)) {
+    if (census.IsCallExist(TelCallState::CALL_STATUS_INCOMING, callId)) {
         TELEPHONY_LOGI("incoming call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_WAITING, callId)) {
+    if (census.IsCallExist(TelCallState::CALL_STATUS_WAITING, callId)) {
         TELEPHONY_LOGI("waiting call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_HOLDING, callId)) {
+    if (census.IsCallExist(TelCallState::CALL_STATUS_HOLDING, callId)) {
         TELEPHONY_LOGI("holding call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
@@ -108,8 +116,10 @@ int32_t BluetoothCallPolicy::HangUpPolicy(int32_t &callId)
 
 int32_t BluetoothCallPolicy::SwitchCallPolicy(int32_t &callId)
 {
-    if (IsCallExist(TelCallState::CALL_STATUS_ACTIVE) &&
-        IsCallExist(TelCallState::CALL_STATUS_HOLDING, callId)) {
+    CallStateCensus census;
+    GetCallStateCensus(census);
+    if (census.IsCallExist(TelCallState::CALL_STATUS_ACTIVE) &&
+        census.IsCallExist(TelCallState::CALL_STATUS_HOLDING, callId)) {
         TELEPHONY_LOGI("active call and holding call are exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
@@ -119,19 +129,21 @@ int32_t BluetoothCallPolicy::SwitchCallPolicy(int32_t &callId)
 
 int32_t BluetoothCallPolicy::StartDtmfPolicy(int32_t &callId)
 {
-    if (IsCallExist(TelCallState::CALL_STATUS_ACTIVE, callId)) {
+    CallStateCensus census;
+    GetCallStateCensus(census);
+    if (census.IsCallExist(TelCallState::CALL_STATUS_ACTIVE, callId)) {
         TELEPHONY_LOGI("active call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_ALERTING, callId)) {
+    if (census.IsCallExist(TelCallState::CALL_STATUS_ALERTING, callId)) {
         TELEPHONY_LOGI("alerting call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_DIALING, callId)) {
+    if (census.IsCallExist(TelCallState::CALL_STATUS_DIALING, callId)) {
         TELEPHONY_LOGI("dialing call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
-    if (IsCallExist(TelCallState::CALL_STATUS_HOLDING, callId)) {
+    if (census.IsCallExist(TelCallState::CALL_STATUS_HOLDING, callId)) {
         TELEPHONY_LOGI("holding call is exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
@@ -141,8 +153,10 @@ int32_t BluetoothCallPolicy::StartDtmfPolicy(int32_t &callId)
 
 int32_t BluetoothCallPolicy::CombineConferencePolicy(int32_t &callId)
 {
-    if (IsCallExist(TelCallState::CALL_STATUS_ACTIVE, callId) &&
-        IsCallExist(TelCallState::CALL_STATUS_HOLDING)) {
+    CallStateCensus census;
+    GetCallStateCensus(census);
+    if (census.IsCallExist(TelCallState::CALL_STATUS_ACTIVE, callId) &&
+        census.IsCallExist(TelCallState::CALL_STATUS_HOLDING)) {
         TELEPHONY_LOGI("active call and holding call are exist, callId:%{public}d", callId);
         return TELEPHONY_SUCCESS;
     }
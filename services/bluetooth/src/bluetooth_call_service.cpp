@@ -155,67 +155,52 @@ int32_t BluetoothCallService::GetCallState()
     int32_t numHeld = 0;
     int32_t callState = static_cast<int32_t>(TelCallState::CALL_STATUS_IDLE);
     std::string number = "";
-    std::vector<int32_t> callInfo = getCallInfoNum(callState, number);
+    CallStateCensus census;
+    GetCallStateCensus(census, true);
+    std::vector<int32_t> callInfo = getCallInfoNum(census, callState, number);
     if (!callInfo.empty()) {
         numActive = callInfo[0];
         numHeld = callInfo[1];
     }
-    if (IsVoipCallExist() && numActive == 0) {
-        GetVoipCallState(numActive, callState, number);
+    if (census.hasVoipCall && numActive == 0) {
+        GetVoipCallState(census.voipCallInfo, numActive, callState, number);
     }
     return DelayedSingleton<BluetoothCallManager>::GetInstance()->
         SendBtCallState(numActive, numHeld, callState, number);
 }
 
-std::vector<int32_t> BluetoothCallService::getCallInfoNum(int32_t &callState, std::string &number)
+std::vector<int32_t> BluetoothCallService::getCallInfoNum(
+    const CallStateCensus &census, int32_t &callState, std::string &number)
 {
-    int32_t numActive = GetCallNum(TelCallState::CALL_STATUS_ACTIVE, true);
-    int32_t numHeld = GetCallNum(TelCallState::CALL_STATUS_HOLDING, true);
-    int32_t numDial = GetCallNum(TelCallState::CALL_STATUS_DIALING, true);
-    int32_t numAlert = GetCallNum(TelCallState::CALL_STATUS_ALERTING, true);
-    int32_t numIncoming = GetCallNum(TelCallState::CALL_STATUS_INCOMING, true);
-    int32_t numWait = GetCallNum(TelCallState::CALL_STATUS_WAITING, true);
-    int32_t numDisconnected = GetCallNum(TelCallState::CALL_STATUS_DISCONNECTED, true);
-    int32_t numDisconnecting = GetCallNum(TelCallState::CALL_STATUS_DISCONNECTING, true);
-    if (numHeld > 0) {
-        callState = static_cast<int32_t>(TelCallState::CALL_STATUS_IDLE);
-        number = GetCallNumber(TelCallState::CALL_STATUS_HOLDING, true);
-    }
-    if (numActive > 0) {
-        callState = static_cast<int32_t>(TelCallState::CALL_STATUS_IDLE);
-        number = GetCallNumber(TelCallState::CALL_STATUS_ACTIVE, true);
-    }
-    if (numDial > 0) {
-        callState = static_cast<int32_t>(TelCallState::CALL_STATUS_DIALING);
-        number = GetCallNumber(TelCallState::CALL_STATUS_DIALING, true);
-    }
-    if (numAlert > 0) {
-        callState = static_cast<int32_t>(TelCallState::CALL_STATUS_ALERTING);
-        number = GetCallNumber(TelCallState::CALL_STATUS_ALERTING, true);
-    }
-    if (numIncoming > 0) {
-        callState = static_cast<int32_t>(TelCallState::CALL_STATUS_INCOMING);
-        number = GetCallNumber(TelCallState::CALL_STATUS_INCOMING, true);
-    }
-    if (numWait > 0) {
-        callState = static_cast<int32_t>(TelCallState::CALL_STATUS_INCOMING);
-        number = GetCallNumber(TelCallState::CALL_STATUS_WAITING, true);
-    }
-    if (numDisconnected > 0) {
-        callState = static_cast<int32_t>(TelCallState::CALL_STATUS_IDLE);
-        number = GetCallNumber(TelCallState::CALL_STATUS_DISCONNECTED, true);
-    }
-    if (numDisconnecting > 0) {
-        callState = static_cast<int32_t>(TelCallState::CALL_STATUS_DISCONNECTED);
-        number = GetCallNumber(TelCallState::CALL_STATUS_DISCONNECTING, true);
-    }
-    return {numActive, numHeld};
+    // later states take precedence, the order matches the HFP call state priority
+    static const std::pair<TelCallState, TelCallState> statePriority[] = {
+        { TelCallState::CALL_STATUS_HOLDING, TelCallState::CALL_STATUS_IDLE },
+        { TelCallState::CALL_STATUS_ACTIVE, TelCallState::CALL_STATUS_IDLE },
+        { TelCallState::CALL_STATUS_DIALING, TelCallState::CALL_STATUS_DIALING },
+        { TelCallState::CALL_STATUS_ALERTING, TelCallState::CALL_STATUS_ALERTING },
+        { TelCallState::CALL_STATUS_INCOMING, TelCallState::CALL_STATUS_INCOMING },
+        { TelCallState::CALL_STATUS_WAITING, TelCallState::CALL_STATUS_INCOMING },
+        { TelCallState::CALL_STATUS_DISCONNECTED, TelCallState::CALL_STATUS_IDLE },
+        { TelCallState::CALL_STATUS_DISCONNECTING, TelCallState::CALL_STATUS_DISCONNECTED },
+    };
+    for (const auto &item : statePriority) {
+        if (census.GetCallNum(item.first) > 0) {
+            callState = static_cast<int32_t>(item.second);
+            number = census.GetCallNumber(item.first);
+        }
+    }
+    return {census.GetCallNum(TelCallState::CALL_STATUS_ACTIVE), census.GetCallNum(TelCallState::CALL_STATUS_HOLDING)};
 }
 
 void BluetoothCallService::GetVoipCallState(int32_t &numActive, int32_t &callState, std::string &number)
+{
+    GetVoipCallState(GetVoipCallInfo(), numActive, callState, number);
+}
+
+void BluetoothCallService::GetVoipCallState(
+    const CallAttributeInfo &callAttributeInfo, int32_t &numActive, int32_t &callState, std::string &number)
 {
     TELEPHONY_LOGI("GetVoipCallState start,callState:%{public}d", callState);
-    CallAttributeInfo callAttributeInfo = GetVoipCallInfo();
     if (callState == (int32_t)TelCallState::CALL_STATUS_IDLE && number == "") {
         switch (callAttributeInfo.callState) {
             case TelCallState::CALL_STATUS_IDLE:
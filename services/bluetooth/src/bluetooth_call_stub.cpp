@@ -233,10 +233,7 @@ int32_t BluetoothCallStub::OnGetCurrentCallList(MessageParcel &data, MessageParc
     int32_t slotId = data.ReadInt32();
     std::vector<CallAttributeInfo> callVec = GetCurrentCallList(slotId);
     reply.WriteInt32(callVec.size());
-    std::vector<CallAttributeInfo>::iterator it = callVec.begin();
-    for (; it != callVec.end(); ++it) {
-        CallManagerUtils::WriteCallAttributeInfo(*it, reply);
-    }
+    CallManagerUtils::WriteCallAttributeInfoList(callVec, reply);
     return TELEPHONY_SUCCESS;
 }
 
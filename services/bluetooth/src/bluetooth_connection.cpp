@@ -80,6 +80,7 @@ void BluetoothConnection::Init()
         TELEPHONY_LOGE("get connected devices fail");
         return;
     }
+    AudioDeviceBatch batch;
     for (auto device : devices) {
         std::string macAddress = device.GetDeviceAddr();
         std::string deviceName = device.GetDeviceName();
@@ -16,6 +16,7 @@
 #include "call_data_base_helper.h"
 
 #include "call_manager_errors.h"
+#include "call_manager_metrics.h"
 #include "call_number_utils.h"
 #include "iservice_registry.h"
 #include "phonenumbers/phonenumber.pb.h"
@@ -172,9 +173,13 @@ bool CallDataBaseHelper::Query(std::vector<std::string> *phones, DataShare::Data
 bool CallDataBaseHelper::Query(ContactInfo &contactInfo, DataShare::DataSharePredicates &predicates)
 {
     TELEPHONY_LOGI("QueryCallerInfo use normal query");
+    CallManagerMetrics &metrics = CallManagerMetrics::GetInstance();
+    metrics.Increase(MetricCounter::DATASHARE_QUERY);
+    CallManagerMetricsTimer metricsTimer(MetricHistogram::DATASHARE_QUERY_LATENCY);
     std::shared_ptr<DataShare::DataShareHelper> helper = CreateDataShareHelper(CONTACT_URI);
     if (helper == nullptr) {
         TELEPHONY_LOGE("helper is nullptr");
+        metrics.Increase(MetricCounter::DATASHARE_QUERY_FAILED);
         return false;
     }
     Uri uri(CONTACT_DATA);
@@ -183,10 +188,12 @@ bool CallDataBaseHelper::Query(ContactInfo &contactInfo, DataShare::DataSharePre
     helper->Release();
     if (!CheckResultSet(resultSet)) {
         TELEPHONY_LOGE("resultSet is null");
+        metrics.Increase(MetricCounter::DATASHARE_QUERY_FAILED);
         return false;
     }
     if (resultSet->GoToFirstRow() != E_OK) {
         TELEPHONY_LOGE("GoToFirstRow failed");
+        metrics.Increase(MetricCounter::DATASHARE_QUERY_FAILED);
         resultSet->Close();
         return false;
     }
@@ -120,6 +120,8 @@ public:
     int32_t CombineConference(int32_t mainCallId);
     int32_t SeparateConference(int32_t callId);
     int32_t KickOutFromConference(int32_t callId);
+    void DumpRequestLatency(std::string &result);
+    void ResetRequestLatency();
     int32_t GetMainCallId(int32_t callId, int32_t &mainCallId);
     int32_t GetSubCallIdList(int32_t callId, std::vector<std::u16string> &callIdList);
     int32_t GetCallIdListForConference(int32_t callId, std::vector<std::u16string> &callIdList);
@@ -209,7 +211,6 @@ private:
     void ReportPhoneUEInSuperPrivacy(const std::string &eventName);
     void PackageDialInformation(AppExecFwk::PacMap &extras, std::string accountNumber, bool isEcc);
     static void handler();
-    bool cancel(ffrt::task_handle &handle);
     int32_t CanDial(std::u16string &number, AppExecFwk::PacMap &extras, bool isEcc);
     void AnswerHandlerForSatelliteOrVideoCall(sptr<CallBase> &call, int32_t videoState);
     bool CurrentIsSuperPrivacyMode(int32_t callId, int32_t videoState);
@@ -279,7 +280,6 @@ private:
     CallStateToApp VoIPCallState_ = CallStateToApp::CALL_STATE_IDLE;
     bool shouldDisconnect = true;
     bool ReduceRingToneVolume_ = false;
-    static std::atomic<bool> alarmSeted_;
     static bool isWearableDevice_;
     std::vector<int32_t> preloadedCallUiRequestPids_ = {};
     struct AnsweredCallQueue {
@@ -294,7 +294,6 @@ private:
         std::string phoneNumber = "";
     } VoipCallInfo_;
 
-    ffrt::task_handle disconnectHandle = nullptr;
     sptr<ApplicationStateObserver> appStateObserver = nullptr;
     sptr<AppExecFwk::IAppMgr> appMgrProxy_ = nullptr;
     
@@ -305,7 +304,7 @@ private:
     ffrt::mutex wearStatusMutex_;
     ffrt::mutex reminderMutex_;
     ffrt::mutex ringToneMutex_;
-    ffrt::task_handle pendingHangupHandle_ = nullptr;
+    uint64_t pendingHangupTimerId_ = 0;
     ffrt::mutex pendingHangupHandleMutex_;
     std::shared_ptr<IncomingFlashReminder> incomingFlashReminder_ {nullptr};
 #ifdef CALL_MANAGER_THERMAL_PROTECTION
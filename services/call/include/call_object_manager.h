@@ -31,6 +31,47 @@
 
 namespace OHOS {
 namespace Telephony {
+/**
+ * Per-state view of the call list collected under a single lock by CallObjectManager::GetCallStateCensus.
+ * callNum and number follow the filtering of GetCallNum/GetCallNumber, isExist and firstCallId follow
+ * IsCallExist and cover every call in the list.
+ */
+struct CallStateCensus {
+    static constexpr int32_t STATE_NUM = static_cast<int32_t>(TelCallState::CALL_STATUS_ANSWERED) + 1;
+
+    int32_t callNum[STATE_NUM] = { 0 };
+    bool isExist[STATE_NUM] = { false };
+    int32_t firstCallId[STATE_NUM] = { 0 };
+    std::string number[STATE_NUM];
+    bool hasVoipCall = false;
+    CallAttributeInfo voipCallInfo;
+
+    static bool IsValidState(TelCallState state)
+    {
+        return state >= TelCallState::CALL_STATUS_ACTIVE && state <= TelCallState::CALL_STATUS_ANSWERED;
+    }
+    int32_t GetCallNum(TelCallState state) const
+    {
+        return IsValidState(state) ? callNum[static_cast<int32_t>(state)] : 0;
+    }
+    std::string GetCallNumber(TelCallState state) const
+    {
+        return IsValidState(state) ? number[static_cast<int32_t>(state)] : "";
+    }
+    bool IsCallExist(TelCallState state) const
+    {
+        return IsValidState(state) && isExist[static_cast<int32_t>(state)];
+    }
+    bool IsCallExist(TelCallState state, int32_t &callId) const
+    {
+        if (!IsCallExist(state)) {
+            return false;
+        }
+        callId = firstCallId[static_cast<int32_t>(state)];
+        return true;
+    }
+};
+
 class CallObjectManager {
 public:
     CallObjectManager();
@@ -76,6 +117,7 @@ public:
     static bool IsConferenceCallExist(TelConferenceState state, int32_t &callId);
     static int32_t GetCallNum(TelCallState callState, bool isIncludeVoipCall = true);
     static std::string GetCallNumber(TelCallState callState, bool isIncludeVoipCall = true);
+    static void GetCallStateCensus(CallStateCensus &census, bool isIncludeVoipCall = true);
     static CallAttributeInfo GetVoipCallInfo();
     static CallAttributeInfo GetActiveVoipCallInfo();
     static void ClearVoipList();
@@ -86,6 +128,7 @@ public:
     static sptr<CallBase> GetAudioLiveCall();
     static std::vector<CallAttributeInfo> GetAllCallInfoList(bool isIncludeVoipCall = true);
     static std::vector<CallAttributeInfo> GetVoipCallInfoList();
+    static int32_t GetCellularCallInfoList(std::vector<CellularCallInfo> &infos);
     int32_t DealFailDial(sptr<CallBase> call);
     int32_t ReportCallDisconnected(sptr<CallBase> call);
     static bool HasVideoCall();
@@ -16,7 +16,6 @@
 #ifndef CALL_REQUEST_EVENT_HANDLER_HELPER
 #define CALL_REQUEST_EVENT_HANDLER_HELPER
 
-#include "event_handler.h"
 #include "refbase.h"
 #include "singleton.h"
 #include "ffrt.h"
@@ -39,7 +38,6 @@ public:
     int32_t GetPendingHangupCallId();
 
 private:
-    std::shared_ptr<AppExecFwk::EventHandler> callRequestEventHandler_;
     bool isDialingCallProcessing_ = false;
     bool pendingMo_ = false;
     bool pendingHangup_ = false;
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CALL_REQUEST_EXECUTOR_H
+#define CALL_REQUEST_EXECUTOR_H
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Telephony {
+enum class CallRequestType : uint32_t {
+    ANSWER = 0,
+    REJECT,
+    HANG_UP,
+    HOLD,
+    UN_HOLD,
+    SWITCH,
+    COMBINE_CONFERENCE,
+    SEPARATE_CONFERENCE,
+    KICK_OUT_CONFERENCE,
+    JOIN_CONFERENCE,
+    UPDATE_RTT_MODE,
+    REQUEST_TYPE_BUTT,
+};
+
+enum class CallRequestScope : uint32_t {
+    CALL = 0,
+    SLOT,
+};
+
+/**
+ * @class CallRequestExecutor
+ * Runs call control requests in submission order per key, a key is a call id or, for conference operations,
+ * a slot id. Different keys drain in parallel on the ffrt pool. A per call request without payload, other than a
+ * switch, is dropped when the newest queued request has the same type, and a hang up or reject cancels the queued
+ * requests it makes pointless, a request that already started is never interrupted.
+ */
+class CallRequestExecutor : public std::enable_shared_from_this<CallRequestExecutor> {
+public:
+    using Task = std::function<void()>;
+
+    CallRequestExecutor() = default;
+    ~CallRequestExecutor() = default;
+
+    bool Submit(CallRequestScope scope, int32_t id, CallRequestType type, Task task);
+    size_t GetPendingCount();
+    void Dump(std::string &result);
+    void ResetStats();
+
+private:
+    using Key = std::pair<CallRequestScope, int32_t>;
+    struct Request {
+        CallRequestType type = CallRequestType::REQUEST_TYPE_BUTT;
+        Task task;
+        std::chrono::steady_clock::time_point enqueueTime;
+    };
+    struct RequestQueue {
+        std::deque<Request> requests;
+        bool isDraining = false;
+    };
+    struct RequestStat {
+        uint64_t count = 0;
+        uint64_t merged = 0;
+        uint64_t cancelled = 0;
+        int64_t waitSumUs = 0;
+        int64_t waitMaxUs = 0;
+        int64_t execSumUs = 0;
+        int64_t execMaxUs = 0;
+    };
+    static bool IsMergeable(CallRequestType type);
+    static bool IsCancelledBy(CallRequestType pending, CallRequestType type);
+    bool MergeLocked(RequestQueue &queue, CallRequestType type);
+    void PostDrain(const Key &key);
+    void Drain(const Key &key);
+    RequestStat &GetStatLocked(CallRequestType type);
+
+    ffrt::mutex mutex_;
+    std::map<Key, RequestQueue> queues_;
+    RequestStat stats_[static_cast<uint32_t>(CallRequestType::REQUEST_TYPE_BUTT)] {};
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // CALL_REQUEST_EXECUTOR_H
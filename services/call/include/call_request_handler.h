@@ -16,10 +16,12 @@
 #ifndef CALL_REQUEST_HANDLER_H
 #define CALL_REQUEST_HANDLER_H
 
+#include <functional>
 #include <map>
 #include <memory>
 #include "ffrt.h"
 
+#include "call_request_executor.h"
 #include "call_request_process.h"
 #include "common_type.h"
 #include "event_handler.h"
@@ -72,9 +74,18 @@ public:
     int32_t UpdateImsRttCallMode(int32_t callId, ImsRTTCallMode mode);
 #endif
     int32_t JoinConference(int32_t callId, std::vector<std::string> &numberList);
+    void DumpRequestLatency(std::string &result);
+    void ResetRequestLatency();
+
+private:
+    using RequestTask = std::function<void(const std::shared_ptr<CallRequestProcess> &processPtr)>;
+    int32_t SubmitCallRequest(int32_t callId, CallRequestType type, RequestTask task);
+    int32_t SubmitConferenceRequest(int32_t callId, CallRequestType type, RequestTask task);
+    int32_t SubmitRequest(CallRequestScope scope, int32_t id, CallRequestType type, RequestTask task);
 
 private:
     std::shared_ptr<CallRequestProcess> callRequestProcessPtr_;
+    std::shared_ptr<CallRequestExecutor> requestExecutor_;
 };
 } // namespace Telephony
 } // namespace OHOS
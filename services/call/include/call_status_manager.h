@@ -72,9 +72,8 @@ public:
     void CallFilterCompleteResult(const CallDetailInfo &info);
     int32_t HandleVoipEventReportInfo(const VoipCallEventInfo &info);
     void HandleCeliaCall(sptr<CallBase> &call);
-    void TriggerAntiFraud(int32_t antiFraudState, const OHOS::AntiFraudService::AntiFraudResultExt &antiFraudResultExt);
-    int32_t GetAntiFraudSlotId();
-    int32_t GetAntiFraudIndex();
+    void TriggerAntiFraud(int32_t slotId, int32_t index, int32_t antiFraudState,
+        const OHOS::AntiFraudService::AntiFraudResultExt &antiFraudResultExt);
     static int32_t GetDevProvisioned();
     static void RegisterObserver();
     static void UpdateDevProvisioned();
@@ -128,8 +127,6 @@ private:
     int32_t TurnOffMute(sptr<CallBase> &call);
     int32_t IncomingFilterPolicy(const CallDetailInfo &info);
     void QueryCallerInfo(ContactInfo &contactInfo, std::string phoneNum);
-    void SetAntiFraudSlotId(int32_t slotId);
-    void SetAntiFraudIndex(int32_t index);
     void SetupAntiFraudService(const sptr<CallBase> &call, const CallDetailInfo &info);
     uint32_t GetAntiFraudDetectType(
         int32_t slotId, const CallDirection callDirection, const VideoStateType videoStateType);
@@ -163,6 +160,8 @@ private:
     void SetConferenceCall(std::vector<sptr<CallBase>>);
     std::vector<sptr<CallBase>> GetConferenceCallList(int32_t slotId);
     void UpdateCallDetailsInfo(const CallDetailsInfo &info);
+    static uint64_t GetCallReportFingerprint(const CallDetailInfo &info);
+    static bool IsCallReportChanged(const CallDetailInfo &oldInfo, const CallDetailInfo &newInfo);
     bool IsDistributeCallSourceStatus();
     void HandleBluetoothCallReportInfo(const CallDetailInfo &info);
     void SetBtCallDialByPhone(const sptr<CallBase> &call, bool isBtCallDialByPhone);
@@ -184,9 +183,9 @@ private:
     void ModifyEsimType();
     int32_t RefreshOldCall(const CallDetailInfo &info, bool &isExistedOldCall);
     bool IsCallMotionRecognitionEnable(const std::string &key);
-    void StartInComingCallMotionRecognition();
-    void StartOutGoingCallMotionRecognition();
-    void StopCallMotionRecognition(TelCallState nextState);
+    void StartInComingCallMotionRecognition(int32_t callId);
+    void StartOutGoingCallMotionRecognition(int32_t callId);
+    void StopCallMotionRecognition(TelCallState nextState, int32_t callId);
     bool UpdateDialingHandle(const CallDetailInfo &info, bool &isDistributedDeviceDialing);
     bool RefreshDialingStateByOtherState(sptr<CallBase> &call, const CallDetailInfo &info);
     void PackVoipCallInfo(DialParaInfo &paraInfo, const CallDetailInfo &info);
@@ -213,9 +212,6 @@ private:
     const int32_t CALL_NUMBER = 2;
     std::unique_ptr<TimeWaitHelper> timeWaitHelper_ {nullptr};
     std::chrono::system_clock::time_point detectStartTime_ = std::chrono::system_clock::from_time_t(0);
-    int32_t antiFraudSlotId_ = -1;
-    int32_t antiFraudIndex_ = -1;
-    ffrt::mutex mutex_;
     static sptr<OOBEStatusObserver> oobeStatusObserver_;
     static int32_t deviceProvisioned_;
 #ifdef CALL_MANAGER_WATCH_CALL_BLOCKING
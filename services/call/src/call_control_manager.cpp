@@ -34,6 +34,7 @@
 #include "call_manager_base.h"
 #include "call_request_event_handler_helper.h"
 #include "call_state_report_proxy.h"
+#include "call_timer_wheel.h"
 #include "cellular_call_connection.h"
 #include "common_type.h"
 #include "ims_call.h"
@@ -62,9 +63,10 @@
 #endif
 namespace OHOS {
 namespace Telephony {
-std::atomic<bool> CallControlManager::alarmSeted_ = false;
-const uint64_t DISCONNECT_DELAY_TIME = 1000000;
-const uint64_t PENDINGHANGUP_DELAY_TIME = 30000000;
+const int64_t DISCONNECT_DELAY_TIME = 1000;
+const int64_t PENDINGHANGUP_DELAY_TIME = 30000;
+constexpr const char *DISCONNECT_CALL_UI_TIMER = "disconnect_call_ui";
+constexpr const char *PENDING_HANGUP_TIMER = "pending_hangup_protect";
 static const int32_t SATCOMM_UID = 1096;
 #ifdef CALL_MANAGER_THERMAL_PROTECTION
 static const int32_t THERMAL_UID = 5528;
@@ -483,40 +485,47 @@ int32_t CallControlManager::HangUpCall(int32_t callId)
 void CallControlManager::PostPendingHangupProtectTask(int32_t callId)
 {
     std::lock_guard<ffrt::mutex> lock(pendingHangupHandleMutex_);
-    if (pendingHangupHandle_ != nullptr) {
+    if (pendingHangupTimerId_ != INVALID_TIMER_ID) {
         return;
     }
     std::weak_ptr<CallControlManager> weakPtr = shared_from_this();
-    pendingHangupHandle_ = ffrt::submit_h([weakPtr, callId]() {
+    auto task = [weakPtr, callId]() {
         auto strong = weakPtr.lock();
         if (strong == nullptr) {
             return;
         }
-        auto callRequestEventHandler = DelayedSingleton<CallRequestEventHandlerHelper>::GetInstance();
-        if (callRequestEventHandler != nullptr && callRequestEventHandler->HasPendingHangup(callId)) {
+        {
+            std::lock_guard<ffrt::mutex> lock(strong->pendingHangupHandleMutex_);
+            strong->pendingHangupTimerId_ = INVALID_TIMER_ID;
+        }
+        // failing the dial reports to the UI and releases the call, keep it off the timer wheel
+        ffrt::submit([weakPtr, callId]() {
+            auto strong = weakPtr.lock();
+            auto callRequestEventHandler = DelayedSingleton<CallRequestEventHandlerHelper>::GetInstance();
+            if (strong == nullptr || callRequestEventHandler == nullptr ||
+                !callRequestEventHandler->HasPendingHangup(callId)) {
+                return;
+            }
             sptr<CallBase> call = GetOneCallObject(callId);
             if (call != nullptr) {
                 strong->DealFailDial(call);
             }
             callRequestEventHandler->SetPendingHangup(false, -1);
-            std::lock_guard<ffrt::mutex> lock(strong->pendingHangupHandleMutex_);
-            strong->pendingHangupHandle_ = nullptr;
             TELEPHONY_LOGI("PendingHangup timeout, clear pending state");
-        }
-    }, {}, {}, ffrt::task_attr().delay(PENDINGHANGUP_DELAY_TIME));
+        });
+    };
+    pendingHangupTimerId_ = DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(PENDING_HANGUP_TIMER,
+        PENDINGHANGUP_DELAY_TIME, task, callId);
 }
  
 void CallControlManager::RemovePendingHangupProtectTask()
 {
     std::lock_guard<ffrt::mutex> lock(pendingHangupHandleMutex_);
-    if (pendingHangupHandle_ == nullptr) {
+    if (pendingHangupTimerId_ == INVALID_TIMER_ID) {
         return;
     }
-    int result = ffrt::skip(pendingHangupHandle_);
-    pendingHangupHandle_ = nullptr;
-    if (result != TELEPHONY_SUCCESS) {
-        TELEPHONY_LOGE("DisconnectedHandle failed! result:%{public}d", result);
-    }
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Cancel(pendingHangupTimerId_);
+    pendingHangupTimerId_ = INVALID_TIMER_ID;
 }
 
 void CallControlManager::sendEventToVoip(CallAbilityEventId eventId)
@@ -1004,6 +1013,20 @@ int32_t CallControlManager::KickOutFromConference(int32_t callId)
     return TELEPHONY_SUCCESS;
 }
 
+void CallControlManager::DumpRequestLatency(std::string &result)
+{
+    if (CallRequestHandlerPtr_ != nullptr) {
+        CallRequestHandlerPtr_->DumpRequestLatency(result);
+    }
+}
+
+void CallControlManager::ResetRequestLatency()
+{
+    if (CallRequestHandlerPtr_ != nullptr) {
+        CallRequestHandlerPtr_->ResetRequestLatency();
+    }
+}
+
 int32_t CallControlManager::GetMainCallId(int32_t callId, int32_t &mainCallId)
 {
     sptr<CallBase> call = GetOneCallObject(callId);
@@ -1317,54 +1340,26 @@ void CallControlManager::GetDialParaInfo(DialParaInfo &info, AppExecFwk::PacMap
 
 void CallControlManager::handler()
 {
-    alarmSeted_ = false;
     TELEPHONY_LOGE("handle DisconnectAbility");
     if (!CallObjectManager::HasCallExist()) {
         DelayedSingleton<CallConnectAbility>::GetInstance()->DisconnectAbility();
     }
 }
 
-bool CallControlManager::cancel(ffrt::task_handle &handle)
-{
-    if (handle != nullptr) {
-        TELEPHONY_LOGI("skip disconnect ability task");
-        int ret = ffrt::skip(handle);
-        if (ret != TELEPHONY_SUCCESS) {
-            TELEPHONY_LOGE("skip task failed, ret = %{public}d", ret);
-            return false;
-        }
-    }
-    return true;
-}
-
 void CallControlManager::ConnectCallUiService(bool shouldConnect)
 {
     if (shouldConnect) {
-        if (alarmSeted_) {
-            if (!cancel(disconnectHandle)) {
-                return;
-            }
-            alarmSeted_ = false;
+        if (DelayedSingleton<CallTimerWheel>::GetInstance()->Cancel(DISCONNECT_CALL_UI_TIMER)) {
+            TELEPHONY_LOGI("skip disconnect ability task");
         }
         DelayedSingleton<CallConnectAbility>::GetInstance()->ConnectAbility();
         shouldDisconnect = false;
     } else {
         shouldDisconnect = true;
-        if (!alarmSeted_) {
-            TELEPHONY_LOGI("submit delay disconnect ability");
-            disconnectHandle = ffrt::submit_h([&]() {
-                handler();
-            }, {}, {}, ffrt::task_attr().delay(DISCONNECT_DELAY_TIME));
-            alarmSeted_ = true;
-        }  else {
-            if (!cancel(disconnectHandle)) {
-                return;
-            }
-            TELEPHONY_LOGI("submit delay disconnect ability");
-            disconnectHandle = ffrt::submit_h([&]() {
-                handler();
-            }, {}, {}, ffrt::task_attr().delay(DISCONNECT_DELAY_TIME));
-        }
+        // scheduling again replaces a pending disconnect, so the delay restarts from the last request
+        TELEPHONY_LOGI("submit delay disconnect ability");
+        DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(DISCONNECT_CALL_UI_TIMER, DISCONNECT_DELAY_TIME,
+            []() { ffrt::submit([]() { handler(); }); });
     }
 }
 
@@ -2256,8 +2251,7 @@ void CallControlManager::StartFlashRemind()
 {
     std::lock_guard<ffrt::mutex> lock(reminderMutex_);
     if (incomingFlashReminder_ == nullptr) {
-        auto runner = AppExecFwk::EventRunner::Create("handler_incoming_flash_reminder");
-        incomingFlashReminder_ = std::make_shared<IncomingFlashReminder>(runner,
+        incomingFlashReminder_ = std::make_shared<IncomingFlashReminder>(
             []() {
                 TELEPHONY_LOGI("clear flash reminder");
                 DelayedSingleton<CallControlManager>::GetInstance()->ClearFlashReminder();
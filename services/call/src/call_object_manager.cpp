@@ -19,6 +19,7 @@
 #include "call_control_manager.h"
 #include "call_manager_errors.h"
 #include "call_number_utils.h"
+#include "call_timer_wheel.h"
 #include "call_wired_headset.h"
 #include "conference_base.h"
 #include "ims_conference.h"
@@ -40,6 +41,8 @@ bool CallObjectManager::needWaitHold_ = false;
 CellularCallInfo CallObjectManager::dialCallInfo_;
 constexpr int32_t CRS_TYPE = 2;
 constexpr uint64_t DISCONNECT_DELAY_TIME = 2000000;
+constexpr uint64_t US_PER_MS = 1000;
+constexpr const char *DELAYED_DISCONNECT_TIMER = "delayed_disconnect_call_connect_ability";
 static constexpr const char *VIDEO_RING_PATH_FIX_TAIL = ".mp4";
 constexpr int32_t VIDEO_RING_PATH_FIX_TAIL_LENGTH = 4;
 static constexpr const char *SYSTEM_VIDEO_RING = "system_video_ring";
@@ -186,18 +189,21 @@ CallAttributeInfo CallObjectManager::GetActiveVoipCallInfo()
 
 void CallObjectManager::DelayedDisconnectCallConnectAbility(uint64_t time = DISCONNECT_DELAY_TIME)
 {
-    ffrt::submit_h(
-        []() {
-            std::lock_guard<ffrt::mutex> lock(listMutex_);
-            TELEPHONY_LOGI("delayed disconnect callback begin");
-            auto controlManager = DelayedSingleton<CallControlManager>::GetInstance();
-            if (callObjectPtrList_.size() == NO_CALL_EXIST && controlManager->ShouldDisconnectService()) {
-                auto callConnectAbility = DelayedSingleton<CallConnectAbility>::GetInstance();
-                callConnectAbility->DisconnectAbility();
-                TELEPHONY_LOGI("delayed disconnect done");
-            }
-        },
-        {}, {}, ffrt::task_attr().delay(time));
+    // the timer is keyed by name, a new request replaces the pending one instead of queueing a second disconnect,
+    // so the call UI stays connected until the delay has passed since the last call was deleted
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(DELAYED_DISCONNECT_TIMER,
+        static_cast<int64_t>(time / US_PER_MS), []() {
+            ffrt::submit([]() {
+                std::lock_guard<ffrt::mutex> lock(listMutex_);
+                TELEPHONY_LOGI("delayed disconnect callback begin");
+                auto controlManager = DelayedSingleton<CallControlManager>::GetInstance();
+                if (callObjectPtrList_.size() == NO_CALL_EXIST && controlManager->ShouldDisconnectService()) {
+                    auto callConnectAbility = DelayedSingleton<CallConnectAbility>::GetInstance();
+                    callConnectAbility->DisconnectAbility();
+                    TELEPHONY_LOGI("delayed disconnect done");
+                }
+            });
+        });
 }
 
 int32_t CallObjectManager::DeleteOneCallObject(int32_t callId)
@@ -877,6 +883,34 @@ std::string CallObjectManager::GetCallNumber(TelCallState callState, bool isIncl
     return number;
 }
 
+void CallObjectManager::GetCallStateCensus(CallStateCensus &census, bool isIncludeVoipCall)
+{
+    census = CallStateCensus();
+    std::lock_guard<ffrt::mutex> lock(listMutex_);
+    for (auto &call : callObjectPtrList_) {
+        TelCallState callState = call->GetTelCallState();
+        if (!CallStateCensus::IsValidState(callState)) {
+            continue;
+        }
+        int32_t stateIndex = static_cast<int32_t>(callState);
+        if (!census.isExist[stateIndex]) {
+            census.isExist[stateIndex] = true;
+            census.firstCallId[stateIndex] = call->GetCallID();
+        }
+        if (call->GetCallType() == CallType::TYPE_VOIP && (isIncludeVoipCall ? !call->isNonVirtualCall() : true)) {
+            continue;
+        }
+        if (census.callNum[stateIndex]++ == 0) {
+            census.number[stateIndex] = call->GetAccountNumber();
+        }
+    }
+    auto voipIt = voipCallObjectList_.begin();
+    if (voipIt != voipCallObjectList_.end()) {
+        census.hasVoipCall = true;
+        census.voipCallInfo = voipIt->second;
+    }
+}
+
 std::vector<CallAttributeInfo> CallObjectManager::GetCallInfoList(int32_t slotId, bool isIncludeVoipCall)
 {
     std::vector<CallAttributeInfo> callVec;
@@ -1087,6 +1121,40 @@ std::vector<CallAttributeInfo> CallObjectManager::GetAllCallInfoList(bool isIncl
     return callVec;
 }
 
+int32_t CallObjectManager::GetCellularCallInfoList(std::vector<CellularCallInfo> &infos)
+{
+    infos.clear();
+    std::lock_guard<ffrt::mutex> lock(listMutex_);
+    infos.reserve(callObjectPtrList_.size());
+    for (auto &call : callObjectPtrList_) {
+        if (call == nullptr || call->GetCallType() == CallType::TYPE_VOIP) {
+            continue;
+        }
+        CellularCallInfo callInfo;
+        if (memset_s(&callInfo, sizeof(CellularCallInfo), 0, sizeof(CellularCallInfo)) != EOK) {
+            TELEPHONY_LOGE("memset_s fail");
+            return TELEPHONY_ERR_MEMSET_FAIL;
+        }
+        std::string number = call->GetAccountNumber();
+        if (number.length() > static_cast<size_t>(kMaxNumberLen)) {
+            TELEPHONY_LOGE("Number out of limit!");
+            return CALL_ERR_NUMBER_OUT_OF_RANGE;
+        }
+        if (!number.empty() && memcpy_s(callInfo.phoneNum, kMaxNumberLen, number.c_str(), number.length()) != EOK) {
+            TELEPHONY_LOGE("memcpy_s fail");
+            return TELEPHONY_ERR_MEMCPY_FAIL;
+        }
+        callInfo.callId = call->GetCallID();
+        callInfo.slotId = call->GetSlotId();
+        callInfo.accountId = callInfo.slotId;
+        callInfo.callType = call->GetCallType();
+        callInfo.videoState = static_cast<int32_t>(call->GetVideoStateType());
+        callInfo.index = call->GetCallIndex();
+        infos.emplace_back(callInfo);
+    }
+    return TELEPHONY_SUCCESS;
+}
+
 int32_t CallObjectManager::GetCallNumByRunningState(CallRunningState callState)
 {
     int32_t count = 0;
@@ -407,8 +407,11 @@ int32_t CallPolicy::SwitchCallPolicy(int32_t callId)
         callIdList.clear();
         return CALL_ERR_PHONE_CALLS_TOO_FEW;
     }
+    CallStateCensus census;
+    GetCallStateCensus(census);
     if (GetCallState(callId) != TelCallState::CALL_STATUS_HOLDING ||
-        IsCallExist(TelCallState::CALL_STATUS_DIALING) || IsCallExist(TelCallState::CALL_STATUS_ALERTING)) {
+        census.IsCallExist(TelCallState::CALL_STATUS_DIALING) ||
+        census.IsCallExist(TelCallState::CALL_STATUS_ALERTING)) {
         TELEPHONY_LOGE("the call is not on hold, callId:%{public}d", callId);
         return CALL_ERR_ILLEGAL_CALL_OPERATION;
     }
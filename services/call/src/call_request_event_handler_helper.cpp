@@ -16,6 +16,7 @@
 
 #include <thread>
 
+#include "call_timer_wheel.h"
 #include "telephony_errors.h"
 #include "telephony_log_wrapper.h"
 #include <shared_mutex>
@@ -25,29 +26,19 @@ namespace Telephony {
 const std::string TASK_ID = "handler_restore_dialing_flag";
 const int32_t DELAY_TIME = 3000;
 
-CallRequestEventHandlerHelper::CallRequestEventHandlerHelper()
-{
-    auto runner = AppExecFwk::EventRunner::Create(TASK_ID);
-    if (callRequestEventHandler_ == nullptr) {
-        callRequestEventHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
-    }
-    if (callRequestEventHandler_ == nullptr) {
-        TELEPHONY_LOGE("init call request event handler failed");
-    }
-}
+CallRequestEventHandlerHelper::CallRequestEventHandlerHelper() {}
 
 CallRequestEventHandlerHelper::~CallRequestEventHandlerHelper() {}
 
 int32_t CallRequestEventHandlerHelper::SetDialingCallProcessing()
 {
     TELEPHONY_LOGI("start restore dialing flag task");
-    if (callRequestEventHandler_ != nullptr && IsDialingCallProcessing()) {
+    if (IsDialingCallProcessing()) {
         auto task = [this]() {
             RestoreDialingFlag(false);
         };
-        callRequestEventHandler_->RemoveTask(TASK_ID);
-        bool ret = callRequestEventHandler_->PostTask(task, TASK_ID, DELAY_TIME);
-        if (ret) {
+        uint64_t timerId = DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(TASK_ID, DELAY_TIME, task);
+        if (timerId == INVALID_TIMER_ID) {
             TELEPHONY_LOGE("restore dialing flag task failed");
             return TELEPHONY_ERROR;
         }
@@ -58,9 +49,7 @@ int32_t CallRequestEventHandlerHelper::SetDialingCallProcessing()
 
 void CallRequestEventHandlerHelper::RemoveEventHandlerTask()
 {
-    if (callRequestEventHandler_ != nullptr) {
-        callRequestEventHandler_->RemoveTask(TASK_ID);
-    }
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Cancel(TASK_ID);
 }
 
 void CallRequestEventHandlerHelper::RestoreDialingFlag(bool isDialingCallProcessing)
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "call_request_executor.h"
+
+#include <algorithm>
+
+#include "call_manager_metrics.h"
+#include "call_task_executor.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+const char *const REQUEST_TYPE_NAMES[] = { "answer", "reject", "hang_up", "hold", "un_hold", "switch",
+    "combine_conference", "separate_conference", "kick_out_conference", "join_conference", "update_rtt_mode" };
+static_assert(sizeof(REQUEST_TYPE_NAMES) / sizeof(REQUEST_TYPE_NAMES[0]) ==
+    static_cast<uint32_t>(CallRequestType::REQUEST_TYPE_BUTT), "request type names mismatch");
+
+int64_t GetElapsedUs(std::chrono::steady_clock::time_point begin)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+} // namespace
+
+bool CallRequestExecutor::IsMergeable(CallRequestType type)
+{
+    // these carry a payload (video state, sms content, number list, rtt mode), two of them are not the same request
+    switch (type) {
+        case CallRequestType::ANSWER:
+        case CallRequestType::REJECT:
+        case CallRequestType::JOIN_CONFERENCE:
+        case CallRequestType::UPDATE_RTT_MODE:
+            return false;
+        // a switch toggles, two of them undo each other instead of being one request
+        case CallRequestType::SWITCH:
+            return false;
+        // queued per slot, the same type may target another call of that slot
+        case CallRequestType::COMBINE_CONFERENCE:
+        case CallRequestType::SEPARATE_CONFERENCE:
+        case CallRequestType::KICK_OUT_CONFERENCE:
+            return false;
+        default:
+            return true;
+    }
+}
+
+bool CallRequestExecutor::IsCancelledBy(CallRequestType pending, CallRequestType type)
+{
+    if (type != CallRequestType::HANG_UP && type != CallRequestType::REJECT) {
+        return false;
+    }
+    switch (pending) {
+        case CallRequestType::ANSWER:
+        case CallRequestType::HOLD:
+        case CallRequestType::UN_HOLD:
+        case CallRequestType::SWITCH:
+        case CallRequestType::UPDATE_RTT_MODE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+CallRequestExecutor::RequestStat &CallRequestExecutor::GetStatLocked(CallRequestType type)
+{
+    return stats_[static_cast<uint32_t>(type)];
+}
+
+bool CallRequestExecutor::Submit(CallRequestScope scope, int32_t id, CallRequestType type, Task task)
+{
+    if (type >= CallRequestType::REQUEST_TYPE_BUTT || task == nullptr) {
+        TELEPHONY_LOGE("invalid call request %{public}u", static_cast<uint32_t>(type));
+        return false;
+    }
+    Key key(scope, id);
+    bool shouldPost = false;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        RequestQueue &queue = queues_[key];
+        if (!MergeLocked(queue, type)) {
+            return true;
+        }
+        Request request;
+        request.type = type;
+        request.task = std::move(task);
+        request.enqueueTime = std::chrono::steady_clock::now();
+        queue.requests.push_back(std::move(request));
+        if (!queue.isDraining) {
+            queue.isDraining = true;
+            shouldPost = true;
+        }
+    }
+    if (shouldPost) {
+        PostDrain(key);
+    }
+    return true;
+}
+
+bool CallRequestExecutor::MergeLocked(RequestQueue &queue, CallRequestType type)
+{
+    // only the newest request is compared, hold, unhold, hold must still end up held
+    if (IsMergeable(type) && !queue.requests.empty() && queue.requests.back().type == type) {
+        TELEPHONY_LOGI("call request %{public}s already pending", REQUEST_TYPE_NAMES[static_cast<uint32_t>(type)]);
+        GetStatLocked(type).merged++;
+        return false;
+    }
+    auto it = queue.requests.begin();
+    while (it != queue.requests.end()) {
+        if (IsCancelledBy(it->type, type)) {
+            TELEPHONY_LOGI("call request %{public}s cancelled by %{public}s",
+                REQUEST_TYPE_NAMES[static_cast<uint32_t>(it->type)], REQUEST_TYPE_NAMES[static_cast<uint32_t>(type)]);
+            GetStatLocked(it->type).cancelled++;
+            it = queue.requests.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return true;
+}
+
+void CallRequestExecutor::PostDrain(const Key &key)
+{
+    std::shared_ptr<CallRequestExecutor> executor = shared_from_this();
+    auto task = [executor, key]() { executor->Drain(key); };
+    DelayedSingleton<CallTaskExecutor>::GetInstance()->Submit(task);
+}
+
+void CallRequestExecutor::Drain(const Key &key)
+{
+    Request request;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto it = queues_.find(key);
+        if (it == queues_.end()) {
+            return;
+        }
+        if (it->second.requests.empty()) {
+            queues_.erase(it);
+            return;
+        }
+        request = std::move(it->second.requests.front());
+        it->second.requests.pop_front();
+        int64_t waitUs = GetElapsedUs(request.enqueueTime);
+        RequestStat &stat = GetStatLocked(request.type);
+        stat.count++;
+        stat.waitSumUs += waitUs;
+        stat.waitMaxUs = std::max(stat.waitMaxUs, waitUs);
+        CallManagerMetrics::GetInstance().Record(MetricHistogram::CALL_REQUEST_WAIT, waitUs);
+    }
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    request.task();
+    int64_t execUs = GetElapsedUs(begin);
+    CallManagerMetrics::GetInstance().Record(MetricHistogram::CALL_REQUEST_EXEC, execUs);
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        RequestStat &stat = GetStatLocked(request.type);
+        stat.execSumUs += execUs;
+        stat.execMaxUs = std::max(stat.execMaxUs, execUs);
+        auto it = queues_.find(key);
+        if (it == queues_.end()) {
+            return;
+        }
+        if (it->second.requests.empty()) {
+            queues_.erase(it);
+            return;
+        }
+    }
+    // one request per task, so a busy call never holds a worker that other calls are waiting for
+    PostDrain(key);
+}
+
+size_t CallRequestExecutor::GetPendingCount()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    size_t count = 0;
+    for (auto &it : queues_) {
+        count += it.second.requests.size();
+    }
+    return count;
+}
+
+void CallRequestExecutor::Dump(std::string &result)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    result.append("Call request wait/exec(us):\n");
+    for (uint32_t i = 0; i < static_cast<uint32_t>(CallRequestType::REQUEST_TYPE_BUTT); i++) {
+        const RequestStat &stat = stats_[i];
+        if (stat.count == 0 && stat.merged == 0 && stat.cancelled == 0) {
+            continue;
+        }
+        int64_t count = static_cast<int64_t>(std::max<uint64_t>(stat.count, 1));
+        result.append("  ").append(REQUEST_TYPE_NAMES[i])
+            .append(": count ").append(std::to_string(stat.count))
+            .append(" wait avg ").append(std::to_string(stat.waitSumUs / count))
+            .append(" max ").append(std::to_string(stat.waitMaxUs))
+            .append(" exec avg ").append(std::to_string(stat.execSumUs / count))
+            .append(" max ").append(std::to_string(stat.execMaxUs))
+            .append(" merged ").append(std::to_string(stat.merged))
+            .append(" cancelled ").append(std::to_string(stat.cancelled)).append("\n");
+    }
+}
+
+void CallRequestExecutor::ResetStats()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    for (auto &stat : stats_) {
+        stat = RequestStat();
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -25,7 +25,7 @@
 
 namespace OHOS {
 namespace Telephony {
-CallRequestHandler::CallRequestHandler() {}
+CallRequestHandler::CallRequestHandler() : requestExecutor_(std::make_shared<CallRequestExecutor>()) {}
 
 CallRequestHandler::~CallRequestHandler() {}
 
@@ -35,137 +35,147 @@ void CallRequestHandler::Init()
     return;
 }
 
-int32_t CallRequestHandler::DialCall()
+int32_t CallRequestHandler::SubmitCallRequest(int32_t callId, CallRequestType type, RequestTask task)
 {
-    if (callRequestProcessPtr_ == nullptr) {
-        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    return SubmitRequest(CallRequestScope::CALL, callId, type, std::move(task));
+}
+
+int32_t CallRequestHandler::SubmitConferenceRequest(int32_t callId, CallRequestType type, RequestTask task)
+{
+    // conference operations touch every call of the slot, so they are ordered per slot instead of per call
+    sptr<CallBase> call = CallObjectManager::GetOneCallObject(callId);
+    if (call == nullptr) {
+        return SubmitRequest(CallRequestScope::CALL, callId, type, std::move(task));
     }
-    return callRequestProcessPtr_->DialRequest();
+    return SubmitRequest(CallRequestScope::SLOT, call->GetSlotId(), type, std::move(task));
 }
 
-int32_t CallRequestHandler::AnswerCall(int32_t callId, int32_t videoState, bool isRTT)
+int32_t CallRequestHandler::SubmitRequest(CallRequestScope scope, int32_t id, CallRequestType type, RequestTask task)
 {
     if (callRequestProcessPtr_ == nullptr) {
         TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    ffrt::submit([=]() { callRequestProcessPtr_->AnswerRequest(callId, videoState, isRTT); });
+    std::weak_ptr<CallRequestProcess> callRequestProcessPtr = callRequestProcessPtr_;
+    auto request = [callRequestProcessPtr, task]() {
+        std::shared_ptr<CallRequestProcess> processPtr = callRequestProcessPtr.lock();
+        if (processPtr == nullptr) {
+            TELEPHONY_LOGE("processPtr is null");
+            return;
+        }
+        task(processPtr);
+    };
+    if (requestExecutor_ == nullptr || !requestExecutor_->Submit(scope, id, type, request)) {
+        ffrt::submit(request);
+    }
     return TELEPHONY_SUCCESS;
 }
 
-int32_t CallRequestHandler::RejectCall(int32_t callId, bool isSendSms, std::string &content)
+int32_t CallRequestHandler::DialCall()
 {
     if (callRequestProcessPtr_ == nullptr) {
         TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    ffrt::submit([=]() {
-        std::string mContent = content;
-        callRequestProcessPtr_->RejectRequest(callId, isSendSms, mContent);
-    });
-    return TELEPHONY_SUCCESS;
+    return callRequestProcessPtr_->DialRequest();
+}
+
+int32_t CallRequestHandler::AnswerCall(int32_t callId, int32_t videoState, bool isRTT)
+{
+    return SubmitCallRequest(callId, CallRequestType::ANSWER,
+        [callId, videoState, isRTT](const std::shared_ptr<CallRequestProcess> &processPtr) {
+            processPtr->AnswerRequest(callId, videoState, isRTT);
+        });
+}
+
+int32_t CallRequestHandler::RejectCall(int32_t callId, bool isSendSms, std::string &content)
+{
+    return SubmitCallRequest(callId, CallRequestType::REJECT,
+        [callId, isSendSms, content](const std::shared_ptr<CallRequestProcess> &processPtr) {
+            std::string mContent = content;
+            processPtr->RejectRequest(callId, isSendSms, mContent);
+        });
 }
 
 int32_t CallRequestHandler::HangUpCall(int32_t callId)
 {
-    if (callRequestProcessPtr_ == nullptr) {
-        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    ffrt::submit([=]() { callRequestProcessPtr_->HangUpRequest(callId); });
-    return TELEPHONY_SUCCESS;
+    return SubmitCallRequest(callId, CallRequestType::HANG_UP,
+        [callId](const std::shared_ptr<CallRequestProcess> &processPtr) { processPtr->HangUpRequest(callId); });
 }
 
 int32_t CallRequestHandler::HoldCall(int32_t callId)
 {
-    if (callRequestProcessPtr_ == nullptr) {
-        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    ffrt::submit([=]() { callRequestProcessPtr_->HoldRequest(callId); });
-    return TELEPHONY_SUCCESS;
+    return SubmitCallRequest(callId, CallRequestType::HOLD,
+        [callId](const std::shared_ptr<CallRequestProcess> &processPtr) { processPtr->HoldRequest(callId); });
 }
 
 int32_t CallRequestHandler::UnHoldCall(int32_t callId)
 {
-    if (callRequestProcessPtr_ == nullptr) {
-        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    ffrt::submit([=]() { callRequestProcessPtr_->UnHoldRequest(callId); });
-    return TELEPHONY_SUCCESS;
+    return SubmitCallRequest(callId, CallRequestType::UN_HOLD,
+        [callId](const std::shared_ptr<CallRequestProcess> &processPtr) { processPtr->UnHoldRequest(callId); });
 }
 
 int32_t CallRequestHandler::SwitchCall(int32_t callId)
 {
-    if (callRequestProcessPtr_ == nullptr) {
-        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    ffrt::submit([=]() { callRequestProcessPtr_->SwitchRequest(callId); });
-    return TELEPHONY_SUCCESS;
+    return SubmitCallRequest(callId, CallRequestType::SWITCH,
+        [callId](const std::shared_ptr<CallRequestProcess> &processPtr) { processPtr->SwitchRequest(callId); });
 }
 
 #ifdef SUPPORT_RTT_CALL
 int32_t CallRequestHandler::UpdateImsRttCallMode(int32_t callId, ImsRTTCallMode mode)
 {
-    if (callRequestProcessPtr_ == nullptr) {
-        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    ffrt::submit([=]() {callRequestProcessPtr_->UpdateImsRttCallModeRequest(callId, mode); });
-    return TELEPHONY_SUCCESS;
+    return SubmitCallRequest(callId, CallRequestType::UPDATE_RTT_MODE,
+        [callId, mode](const std::shared_ptr<CallRequestProcess> &processPtr) {
+            processPtr->UpdateImsRttCallModeRequest(callId, mode);
+        });
 }
 #endif
 
 int32_t CallRequestHandler::JoinConference(int32_t callId, std::vector<std::string> &numberList)
 {
-    if (callRequestProcessPtr_ == nullptr) {
-        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    std::weak_ptr<CallRequestProcess> callRequestProcessPtr = callRequestProcessPtr_;
-    ffrt::submit([callId, callRequestProcessPtr, numberList]() {
-        std::shared_ptr<CallRequestProcess> processPtr = callRequestProcessPtr.lock();
-        std::vector<std::string> mNumberList(numberList);
-        if (processPtr == nullptr) {
-            TELEPHONY_LOGE("processPtr is null");
-            return;
-        }
-        processPtr->JoinConference(callId, mNumberList);
-    });
-    return TELEPHONY_SUCCESS;
+    return SubmitConferenceRequest(callId, CallRequestType::JOIN_CONFERENCE,
+        [callId, numberList](const std::shared_ptr<CallRequestProcess> &processPtr) {
+            std::vector<std::string> mNumberList(numberList);
+            processPtr->JoinConference(callId, mNumberList);
+        });
 }
 
 int32_t CallRequestHandler::CombineConference(int32_t mainCallId)
 {
-    if (callRequestProcessPtr_ == nullptr) {
-        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    ffrt::submit([=]() { callRequestProcessPtr_->CombineConferenceRequest(mainCallId); });
-    return TELEPHONY_SUCCESS;
+    return SubmitConferenceRequest(mainCallId, CallRequestType::COMBINE_CONFERENCE,
+        [mainCallId](const std::shared_ptr<CallRequestProcess> &processPtr) {
+            processPtr->CombineConferenceRequest(mainCallId);
+        });
 }
 
 int32_t CallRequestHandler::SeparateConference(int32_t callId)
 {
-    if (callRequestProcessPtr_ == nullptr) {
-        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
-    ffrt::submit([=]() { callRequestProcessPtr_->SeparateConferenceRequest(callId); });
-    return TELEPHONY_SUCCESS;
+    return SubmitConferenceRequest(callId, CallRequestType::SEPARATE_CONFERENCE,
+        [callId](const std::shared_ptr<CallRequestProcess> &processPtr) {
+            processPtr->SeparateConferenceRequest(callId);
+        });
 }
 
 int32_t CallRequestHandler::KickOutFromConference(int32_t callId)
 {
-    if (callRequestProcessPtr_ == nullptr) {
-        TELEPHONY_LOGE("callRequestProcessPtr_ is nullptr");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    return SubmitConferenceRequest(callId, CallRequestType::KICK_OUT_CONFERENCE,
+        [callId](const std::shared_ptr<CallRequestProcess> &processPtr) {
+            processPtr->KickOutFromConferenceRequest(callId);
+        });
+}
+
+void CallRequestHandler::DumpRequestLatency(std::string &result)
+{
+    if (requestExecutor_ != nullptr) {
+        requestExecutor_->Dump(result);
+    }
+}
+
+void CallRequestHandler::ResetRequestLatency()
+{
+    if (requestExecutor_ != nullptr) {
+        requestExecutor_->ResetStats();
     }
-    ffrt::submit([=]() { callRequestProcessPtr_->KickOutFromConferenceRequest(callId); });
-    return TELEPHONY_SUCCESS;
 }
 } // namespace Telephony
 } // namespace OHOS
@@ -18,6 +18,7 @@
 #include "call_ability_report_proxy.h"
 #include "call_control_manager.h"
 #include "call_dialog.h"
+#include "call_earthquake_alarm_locator.h"
 #include "call_manager_errors.h"
 #include "call_manager_hisysevent.h"
 #include "call_number_utils.h"
@@ -37,6 +38,8 @@ namespace OHOS {
 namespace Telephony {
 static std::atomic<bool> g_flagForDsda{false};
 constexpr int32_t INIT_INDEX = 0;
+// keeps the ecc service prepare of a dial ahead of its cancel when the dial fails
+ffrt::queue eccServicePrepareQueue { "ecc_service_prepare" };
 
 CallRequestProcess::CallRequestProcess() {}
 
@@ -57,6 +60,7 @@ int32_t CallRequestProcess::DialRequest()
         TELEPHONY_LOGE("Number out of limit!");
         return CALL_ERR_NUMBER_OUT_OF_RANGE;
     }
+    auto dialBegin = std::chrono::steady_clock::now();
     bool isEcc = false;
     DelayedSingleton<CallNumberUtils>::GetInstance()->CheckNumberIsEmergency(info.number, info.accountId, isEcc);
     if (!isEcc && info.dialType == DialType::DIAL_CARRIER_TYPE && !IsCnSimCard(info.accountId) &&
@@ -77,7 +81,18 @@ int32_t CallRequestProcess::DialRequest()
         }
     }
     TELEPHONY_LOGI("dialType:%{public}d", info.dialType);
-    return HandleDialRequest(info);
+    if (!isEcc) {
+        return HandleDialRequest(info);
+    }
+    int32_t slotId = info.accountId;
+    std::string number = info.number;
+    eccServicePrepareQueue.submit(
+        [slotId, number, dialBegin]() { MyLocationEngine::PrepareEccService(slotId, number, dialBegin); });
+    int32_t ret = HandleDialRequest(info);
+    if (ret != TELEPHONY_SUCCESS) {
+        eccServicePrepareQueue.submit([]() { MyLocationEngine::CancelPreparedEccService(); });
+    }
+    return ret;
 }
 
 bool CallRequestProcess::IsCnSimCard(int32_t slotId)
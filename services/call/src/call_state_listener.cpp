@@ -14,6 +14,7 @@
  */
 
 #include "call_state_listener.h"
+#include "call_manager_metrics.h"
 
 #include "telephony_log_wrapper.h"
 
@@ -88,6 +89,8 @@ void CallStateListener::CallStateUpdated(
         TELEPHONY_LOGE("callObjectPtr is nullptr");
         return;
     }
+    CallManagerMetrics::GetInstance().Increase(MetricCounter::OBSERVER_STATE_UPDATE);
+    CallManagerMetricsTimer metricsTimer(MetricHistogram::OBSERVER_FANOUT_LATENCY);
     std::lock_guard<ffrt::mutex> lock(mutex_);
     for (auto &observer : listenerSet_) {
         observer->CallStateUpdated(callObjectPtr, priorState, nextState);
@@ -16,6 +16,7 @@
 #include "call_status_manager.h"
 
 #include <securec.h>
+#include <unordered_map>
 
 #include "antifraud_service.h"
 #include "call_manager_config.h"
@@ -52,7 +53,6 @@
 #include "report_call_info_handler.h"
 #include "satellite_call.h"
 #include "satellite_call_control.h"
-#include "screen_sensor_plugin.h"
 #include "settings_datashare_helper.h"
 #include "sim_state_type.h"
 #include "spam_call_adapter.h"
@@ -263,10 +263,27 @@ void CallStatusManager::HandleDsdaInfo(int32_t slotId)
     }
 }
 
+uint64_t CallStatusManager::GetCallReportFingerprint(const CallDetailInfo &info)
+{
+    // fields whose change has to be reported for an existing call, packed into one comparable word
+    constexpr uint32_t fieldBits = 16;
+    constexpr uint64_t fieldMask = 0xFFFF;
+    uint64_t fingerprint = static_cast<uint64_t>(info.state) & fieldMask;
+    fingerprint = (fingerprint << fieldBits) | (static_cast<uint64_t>(info.mpty) & fieldMask);
+    fingerprint = (fingerprint << fieldBits) | (static_cast<uint64_t>(info.callMode) & fieldMask);
+    fingerprint = (fingerprint << fieldBits) | (static_cast<uint64_t>(info.callType) & fieldMask);
+    return fingerprint;
+}
+
+bool CallStatusManager::IsCallReportChanged(const CallDetailInfo &oldInfo, const CallDetailInfo &newInfo)
+{
+    return newInfo.state == TelCallState::CALL_STATUS_ALERTING || newInfo.callType == CallType::TYPE_VOIP ||
+        GetCallReportFingerprint(oldInfo) != GetCallReportFingerprint(newInfo);
+}
+
 // handle call state changes, incoming call, outgoing call.
 int32_t CallStatusManager::HandleCallsReportInfo(const CallDetailsInfo &info)
 {
-    bool flag = false;
     TELEPHONY_LOGI("call list size:%{public}zu,slotId:%{public}d", info.callVec.size(), info.slotId);
     int32_t curSlotId = info.slotId;
     if (!DelayedSingleton<CallNumberUtils>::GetInstance()->IsValidSlotId(curSlotId)) {
@@ -275,45 +292,44 @@ int32_t CallStatusManager::HandleCallsReportInfo(const CallDetailsInfo &info)
     }
     tmpCallDetailsInfo_[curSlotId].callVec.clear();
     tmpCallDetailsInfo_[curSlotId] = info;
-    for (auto &it : info.callVec) {
-        for (const auto &it1 : callDetailsInfo_[curSlotId].callVec) {
-            if (it.index == it1.index) {
-                // call state changes
-                if (it.state != it1.state || it.mpty != it1.mpty || it.state == TelCallState::CALL_STATUS_ALERTING ||
-                    it.callType == CallType::TYPE_VOIP || it.callMode != it1.callMode || it.callType != it1.callType) {
-                    TELEPHONY_LOGI("handle updated call state:%{public}d", it.state);
-                    HandleCallReportInfo(it);
-                }
-                flag = true;
-                break;
-            }
+    std::vector<CallDetailInfo> &oldCallVec = callDetailsInfo_[curSlotId].callVec;
+    std::unordered_map<int32_t, const CallDetailInfo *> oldCalls;
+    oldCalls.reserve(oldCallVec.size());
+    for (const auto &oldInfo : oldCallVec) {
+        // keep the first entry of an index, as the previous linear search did
+        oldCalls.emplace(oldInfo.index, &oldInfo);
+    }
+    std::unordered_map<int32_t, const CallDetailInfo *> newCalls;
+    newCalls.reserve(info.callVec.size());
+    for (const auto &newInfo : info.callVec) {
+        newCalls.emplace(newInfo.index, &newInfo);
+        auto oldIt = oldCalls.find(newInfo.index);
+        if (oldIt == oldCalls.end()) {
+            // incoming/outgoing call handle
+            HandleConnectingCallReportInfo(newInfo);
+            continue;
         }
-        // incoming/outgoing call handle
-        if (!flag || callDetailsInfo_[curSlotId].callVec.empty()) {
-            HandleConnectingCallReportInfo(it);
+        // call state changes
+        if (IsCallReportChanged(*(oldIt->second), newInfo)) {
+            TELEPHONY_LOGI("handle updated call state:%{public}d", newInfo.state);
+            HandleCallReportInfo(newInfo);
         }
-        flag = false;
     }
     // disconnected calls handle
-    for (auto &it2 : callDetailsInfo_[curSlotId].callVec) {
-        for (const auto &it3 : info.callVec) {
-            if (it2.index == it3.index) {
-                TELEPHONY_LOGI("state:%{public}d", it2.state);
+    for (auto &oldInfo : oldCallVec) {
+        auto newIt = newCalls.find(oldInfo.index);
+        if (newIt != newCalls.end()) {
+            TELEPHONY_LOGI("state:%{public}d", oldInfo.state);
 #ifdef SUPPORT_RTT_CALL
-                auto controlManager = DelayedSingleton<CallControlManager>::GetInstance();
-                if (controlManager != nullptr) {
-                    controlManager->RefreshRttManager(it3);
-                }
-#endif
-                flag = true;
-                break;
+            auto controlManager = DelayedSingleton<CallControlManager>::GetInstance();
+            if (controlManager != nullptr) {
+                controlManager->RefreshRttManager(*(newIt->second));
             }
+#endif
+            continue;
         }
-        if (!flag) {
-            it2.state = TelCallState::CALL_STATUS_DISCONNECTED;
-            HandleCallReportInfo(it2);
-        }
-        flag = false;
+        oldInfo.state = TelCallState::CALL_STATUS_DISCONNECTED;
+        HandleCallReportInfo(oldInfo);
     }
     UpdateCallDetailsInfo(info);
     return TELEPHONY_SUCCESS;
@@ -337,7 +353,7 @@ void CallStatusManager::UpdateCallDetailsInfo(const CallDetailsInfo &info)
     int32_t curSlotId = info.slotId;
     callDetailsInfo_[curSlotId].callVec.clear();
     callDetailsInfo_[curSlotId] = info;
-    auto condition = [](CallDetailInfo i) { return i.state == TelCallState::CALL_STATUS_DISCONNECTED; };
+    auto condition = [](const CallDetailInfo &i) { return i.state == TelCallState::CALL_STATUS_DISCONNECTED; };
     auto it_end = std::remove_if(callDetailsInfo_[curSlotId].callVec.begin(),
         callDetailsInfo_[curSlotId].callVec.end(), condition);
     callDetailsInfo_[curSlotId].callVec.erase(it_end, callDetailsInfo_[curSlotId].callVec.end());
@@ -537,7 +553,7 @@ int32_t CallStatusManager::IncomingHandle(const CallDetailInfo &info)
     }
     HandleVideoCallInAdvsecMode(call, info);
     AddOneCallObject(call);
-    StartInComingCallMotionRecognition();
+    StartInComingCallMotionRecognition(call->GetCallID());
     SetPhoneIndexInfo(call, info.phoneIndex);
     DelayedSingleton<CallControlManager>::GetInstance()->NotifyNewCallCreated(call);
     return FinalizeIncomingState(call, info.state);
@@ -924,7 +940,7 @@ int32_t CallStatusManager::DialingHandle(const CallDetailInfo &info)
         callRequestEventHandler->SetPendingMo(true, call->GetCallID());
         call->SetPhoneOrWatchDial(static_cast<int32_t>(PhoneOrWatchDial::WATCH_DIAL));
         SetBtCallDialByPhone(call, false);
-        StartOutGoingCallMotionRecognition();
+        StartOutGoingCallMotionRecognition(call->GetCallID());
     }
     callRequestEventHandler->RestoreDialingFlag(false);
     callRequestEventHandler->RemoveEventHandlerTask();
@@ -963,7 +979,7 @@ bool CallStatusManager::UpdateDialingHandle(const CallDetailInfo &info, bool &is
 int32_t CallStatusManager::ActiveHandle(const CallDetailInfo &info)
 {
     TELEPHONY_LOGI("handle active state");
-    StopCallMotionRecognition(TelCallState::CALL_STATUS_ACTIVE);
+    StopCallMotionRecognition(TelCallState::CALL_STATUS_ACTIVE, INVALID_CALLID);
     DelayedSingleton<CallControlManager>::GetInstance()->StopFlashRemind();
     std::string tmpStr(info.phoneNum);
     sptr<CallBase> call = GetOneCallObjectByIndexSlotIdAndCallType(info.index, info.accountId, info.callType,
@@ -1016,30 +1032,6 @@ void CallStatusManager::HandleAntiFraudState(const sptr<CallBase> &call, const C
     }
 }
 
-int32_t CallStatusManager::GetAntiFraudSlotId()
-{
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    return antiFraudSlotId_;
-}
-
-int32_t CallStatusManager::GetAntiFraudIndex()
-{
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    return antiFraudIndex_;
-}
-
-void CallStatusManager::SetAntiFraudSlotId(int32_t slotId)
-{
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    antiFraudSlotId_ = slotId;
-}
-
-void CallStatusManager::SetAntiFraudIndex(int32_t index)
-{
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    antiFraudIndex_ = index;
-}
-
 void CallStatusManager::SetupAntiFraudService(const sptr<CallBase> &call, const CallDetailInfo &info)
 {
     VideoStateType videoStateType = call->GetVideoStateType();
@@ -1074,11 +1066,9 @@ void CallStatusManager::StartAntiFraudDetectTask(const sptr<CallBase> &call, con
     const std::string &phoneNum, const VideoStateType videoStateType)
 {
     int32_t slotId = call->GetSlotId();
-    if (slotId == -1 || GetAntiFraudSlotId() != -1 || GetAntiFraudIndex() != -1) {
+    if (slotId == -1 || !DelayedSingleton<AntiFraudService>::GetInstance()->ClaimDetectSession(slotId, info.index)) {
         return;
     }
-    SetAntiFraudSlotId(slotId);
-    SetAntiFraudIndex(info.index);
     wptr<CallBase> callBaseWeakPtr = call;
     OHOS::AntiFraudService::AfsDetectType detectType;
     CallDirection callDirection = call->GetCallDirection();
@@ -1125,13 +1115,17 @@ uint32_t CallStatusManager::GetAntiFraudDetectType(
 
 void CallStatusManager::StopAntiFraudDetect(sptr<CallBase> &call, const CallDetailInfo &info)
 {
-    if (GetAntiFraudSlotId() != call->GetSlotId() || GetAntiFraudIndex() != info.index) {
+    auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
+    auto session = antiFraudService->GetSession(call->GetSlotId(), info.index);
+    if (session == nullptr) {
         return;
     }
-    DelayedSingleton<AntiFraudService>::GetInstance()->StopAntiFraudService(call->GetSlotId(), info.index);
-    SetAntiFraudSlotId(-1);
-    SetAntiFraudIndex(-1);
+    // the detector keeps running after a result, so it is always stopped, only a pending state is reset
+    antiFraudService->StopAntiFraudService(call->GetSlotId(), info.index);
     TELEPHONY_LOGI("call ending, can begin a new antifraud");
+    if (!session->IsDetecting()) {
+        return;
+    }
     OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt;
     UpdateAntiFraudState(call, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED),
         antiFraudResultExt);
@@ -1139,12 +1133,15 @@ void CallStatusManager::StopAntiFraudDetect(sptr<CallBase> &call, const CallDeta
 
 void CallStatusManager::PauseAntiFraudDetect(sptr<CallBase> &call, const CallDetailInfo &info)
 {
-    if (GetAntiFraudSlotId() != call->GetSlotId() || GetAntiFraudIndex() != info.index) {
+    auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
+    auto session = antiFraudService->GetSession(call->GetSlotId(), info.index);
+    if (session == nullptr) {
+        return;
+    }
+    antiFraudService->StopAntiFraudService(call->GetSlotId(), info.index);
+    if (!session->IsDetecting()) {
         return;
     }
-    DelayedSingleton<AntiFraudService>::GetInstance()->StopAntiFraudService(call->GetSlotId(), info.index);
-    SetAntiFraudSlotId(-1);
-    SetAntiFraudIndex(-1);
     AAFwk::WantParams extraParams = call->GetExtraParams();
     int32_t antiFraudState = static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED);
     extraParams.SetParam("antiFraudState", AAFwk::Integer::Box(antiFraudState));
@@ -1156,16 +1153,18 @@ void CallStatusManager::HandleCeliaCall(sptr<CallBase> &call)
     int32_t slotId = call->GetSlotId();
     int32_t index = call->GetCallIndex();
     TELEPHONY_LOGI("handle celia call, slotId=%{public}d, index=%{public}d", slotId, index);
-    if (GetAntiFraudSlotId() != slotId || GetAntiFraudIndex() != index) {
+    auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
+    auto session = antiFraudService->GetSession(slotId, index);
+    if (session == nullptr) {
         return;
     }
-    DelayedSingleton<AntiFraudService>::GetInstance()->StopAntiFraudService(slotId, index);
-    SetAntiFraudSlotId(-1);
-    SetAntiFraudIndex(-1);
+    antiFraudService->StopAntiFraudService(slotId, index);
     TELEPHONY_LOGI("celia call begin, recover AntiFraud SlotId and Index");
-    OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt;
-    UpdateAntiFraudState(call, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED),
-        antiFraudResultExt);
+    if (session->IsDetecting()) {
+        OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt;
+        UpdateAntiFraudState(call, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED),
+            antiFraudResultExt);
+    }
 
     if (call->GetTelCallState() == TelCallState::CALL_STATUS_ACTIVE) {
         int32_t ret = UpdateCallState(call, TelCallState::CALL_STATUS_ACTIVE);
@@ -1219,17 +1218,17 @@ bool CallStatusManager::IsContactPhoneNum(const std::string &phoneNum)
     }
 }
 
-void CallStatusManager::TriggerAntiFraud(
-    int32_t antiFraudState, const OHOS::AntiFraudService::AntiFraudResultExt &antiFraudResultExt)
+void CallStatusManager::TriggerAntiFraud(int32_t slotId, int32_t index, int32_t antiFraudState,
+    const OHOS::AntiFraudService::AntiFraudResultExt &antiFraudResultExt)
 {
-    TELEPHONY_LOGI("TriggerAntiState, antiFraudState = %{public}d", antiFraudState);
+    TELEPHONY_LOGI("TriggerAntiState, slotId = %{public}d, index = %{public}d, antiFraudState = %{public}d",
+        slotId, index, antiFraudState);
     sptr<CallBase> call = nullptr;
-    int32_t antiFraudSlotId = GetAntiFraudSlotId();
-    if (antiFraudSlotId >= SLOT_NUM || antiFraudSlotId < 0) {
+    if (slotId >= SLOT_NUM || slotId < 0) {
         return;
     }
-    for (auto &it : callDetailsInfo_[antiFraudSlotId].callVec) {
-        if (it.index == GetAntiFraudIndex()) {
+    for (auto &it : callDetailsInfo_[slotId].callVec) {
+        if (it.index == index) {
             it.antiFraudState = antiFraudState;
             call = GetOneCallObjectByIndexSlotIdAndCallType(it.index, it.accountId, it.callType, it.phoneIndex);
             break;
@@ -1237,8 +1236,6 @@ void CallStatusManager::TriggerAntiFraud(
     }
     if (antiFraudState == static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK) ||
         antiFraudState == static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED)) {
-        SetAntiFraudSlotId(-1);
-        SetAntiFraudIndex(-1);
         TELEPHONY_LOGI("detect finish, can begin a new antifraud");
     }
 
@@ -1471,24 +1468,27 @@ int32_t CallStatusManager::DisconnectedHandle(const CallDetailInfo &info)
         callSuperPrivacyControlManager->RestorePrivacyPolicy();
         callControlManager->SetReduceRingToneVolume(false);
     }
-    StopCallMotionRecognition(TelCallState::CALL_STATUS_DISCONNECTED);
+    StopCallMotionRecognition(TelCallState::CALL_STATUS_DISCONNECTED, callId);
     callControlManager->StopFlashRemind();
     return TELEPHONY_SUCCESS;
 }
 
-void CallStatusManager::StopCallMotionRecognition(TelCallState nextState)
+void CallStatusManager::StopCallMotionRecognition(TelCallState nextState, int32_t callId)
 {
+    auto sensorManager = DelayedSingleton<MotionSensorSubscriptionManager>::GetInstance();
     switch (nextState) {
         case TelCallState::CALL_STATUS_ACTIVE:
-            MotionRecogntion::UnsubscribePickupSensor();
-            MotionRecogntion::UnsubscribeFlipSensor();
+            // pickup and flip only act on a ringing call, drop them for every call once one is answered
+            sensorManager->ReleaseAll(MotionSensorType::PICKUP);
+            sensorManager->ReleaseAll(MotionSensorType::FLIP);
             break;
         case TelCallState::CALL_STATUS_DISCONNECTED:
+            sensorManager->ReleaseCall(callId);
             if (!CallObjectManager::HasCellularCallExist()) {
-                MotionRecogntion::UnsubscribePickupSensor();
-                MotionRecogntion::UnsubscribeFlipSensor();
-                MotionRecogntion::UnsubscribeCloseToEarSensor();
-                Rosen::UnloadMotionSensor();
+                // backstop for a holder whose call id was never released, e.g. a call dropped before its report
+                for (uint32_t type = 0; type < static_cast<uint32_t>(MotionSensorType::SENSOR_TYPE_BUTT); type++) {
+                    sensorManager->ReleaseAll(static_cast<MotionSensorType>(type));
+                }
             }
             break;
         default:
@@ -2795,7 +2795,7 @@ bool CallStatusManager::IsCallMotionRecognitionEnable(const std::string& key)
     return false;
 }
 
-void CallStatusManager::StartInComingCallMotionRecognition()
+void CallStatusManager::StartInComingCallMotionRecognition(int32_t callId)
 {
     if (GetOneCarrierCallObject(CallRunningState::CALL_RUNNING_STATE_DIALING) != nullptr ||
         GetOneCarrierCallObject(CallRunningState::CALL_RUNNING_STATE_ACTIVE) != nullptr ||
@@ -2803,40 +2803,25 @@ void CallStatusManager::StartInComingCallMotionRecognition()
         TELEPHONY_LOGI("has dialing active or holding call return");
         return;
     }
-    bool isPickupReduceVolumeSwitchOn =
-        IsCallMotionRecognitionEnable(SettingsDataShareHelper::QUERY_MOTION_PICKUP_REDUCE_KEY);
-    bool isFlipMuteSwitchOn = IsCallMotionRecognitionEnable(SettingsDataShareHelper::QUERY_MOTION_FLIP_MUTE_KEY);
-    bool isCloseToEarQuickAnswerSwitchOn =
-        IsCallMotionRecognitionEnable(SettingsDataShareHelper::QUERY_MOTION_CLOSE_TO_EAR_KEY);
-    if (isPickupReduceVolumeSwitchOn || isFlipMuteSwitchOn || isCloseToEarQuickAnswerSwitchOn) {
-        if (!Rosen::LoadMotionSensor()) {
-            TELEPHONY_LOGE("LoadMotionSensor failed");
-            return;
-        }
-        TELEPHONY_LOGI("LoadMotionSensor success");
-        if (isPickupReduceVolumeSwitchOn) {
-            MotionRecogntion::SubscribePickupSensor();
-        }
-        if (isFlipMuteSwitchOn) {
-            MotionRecogntion::SubscribeFlipSensor();
-        }
-        if (isCloseToEarQuickAnswerSwitchOn) {
-            MotionRecogntion::SubscribeCloseToEarSensor();
-        }
+    auto sensorManager = DelayedSingleton<MotionSensorSubscriptionManager>::GetInstance();
+    if (IsCallMotionRecognitionEnable(SettingsDataShareHelper::QUERY_MOTION_PICKUP_REDUCE_KEY) &&
+        !sensorManager->Acquire(MotionSensorType::PICKUP, callId)) {
+        return;
+    }
+    if (IsCallMotionRecognitionEnable(SettingsDataShareHelper::QUERY_MOTION_FLIP_MUTE_KEY) &&
+        !sensorManager->Acquire(MotionSensorType::FLIP, callId)) {
+        return;
+    }
+    if (IsCallMotionRecognitionEnable(SettingsDataShareHelper::QUERY_MOTION_CLOSE_TO_EAR_KEY)) {
+        sensorManager->Acquire(MotionSensorType::CLOSE_TO_EAR, callId);
     }
 }
 
-void CallStatusManager::StartOutGoingCallMotionRecognition()
+void CallStatusManager::StartOutGoingCallMotionRecognition(int32_t callId)
 {
-    bool isCloseToEarQuickAnswerSwitchOn =
-        IsCallMotionRecognitionEnable(SettingsDataShareHelper::QUERY_MOTION_CLOSE_TO_EAR_KEY);
-    if (isCloseToEarQuickAnswerSwitchOn) {
-        if (!Rosen::LoadMotionSensor()) {
-            TELEPHONY_LOGE("LoadMotionSensor failed");
-            return;
-        }
-        TELEPHONY_LOGI("LoadMotionSensor success");
-        MotionRecogntion::SubscribeCloseToEarSensor();
+    if (IsCallMotionRecognitionEnable(SettingsDataShareHelper::QUERY_MOTION_CLOSE_TO_EAR_KEY)) {
+        DelayedSingleton<MotionSensorSubscriptionManager>::GetInstance()->Acquire(
+            MotionSensorType::CLOSE_TO_EAR, callId);
     }
 }
 
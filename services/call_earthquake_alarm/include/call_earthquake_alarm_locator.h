@@ -16,6 +16,8 @@
 #ifndef CALL_EARTHQUAKE_ALARM_LOCATOR_H
 #define CALL_EARTHQUAKE_ALARM_LOCATOR_H
 
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <map>
@@ -60,6 +62,13 @@ private:
     static ffrt::mutex mutex_;
 };
 
+class EccSwitchObserver : public AAFwk::DataAbilityObserverStub {
+public:
+    EccSwitchObserver() = default;
+    virtual ~EccSwitchObserver() = default;
+    void OnChange() override;
+};
+
 class MyLocationEngine {
 public:
     MyLocationEngine();
@@ -77,6 +86,12 @@ public:
     static std::shared_ptr<MyLocationEngine> GetInstance();
     static void StartEccService(sptr<CallBase> call, const CallDetailInfo &info);
     static void StopEccService(int32_t callId);
+    static void PrepareEccService(
+        int32_t slotId, const std::string &number, std::chrono::steady_clock::time_point dialBegin);
+    static void CancelPreparedEccService();
+    static void InitEccSwitchObserver();
+    static void UpdateEccSwitchState();
+    static bool IsEccSwitchOn();
     static void ConnectAbility(std::string value, sptr<AAFwk::IAbilityConnection>& callback, AAFwk::Want& want);
 private:
     class MyLocationCallBack : public IRemoteStub<Location::ILocatorCallback> {
@@ -99,6 +114,12 @@ private:
     private:
         std::shared_ptr<MyLocationEngine> locationUpdate_ = nullptr;
     };
+private:
+    static void ConnectEccService(
+        int32_t slotId, const std::string &number, std::chrono::steady_clock::time_point connectBegin);
+    static void DisconnectEccService();
+    static void OnEccPrepareExpired();
+
 private:
     std::unique_ptr<Location::RequestConfig> requestConfig = nullptr;
     std::shared_ptr<Location::LocatorImpl> locatorImpl = nullptr;
@@ -118,8 +139,16 @@ private:
     static const char* PARAMETERS_KEY_SLOTID;
     static const std::string ALARM_SWITCH_ON;
     static const std::string ALARM_SWITCH_OFF;
-    
+    static const char* ECC_SWITCH_KEY;
+    static const char* ECC_PREPARE_EXPIRE_TIMER;
+    static const int64_t ECC_PREPARE_EXPIRE_MS;
+    static std::atomic<int32_t> eccSwitchState_;
+    static sptr<AAFwk::IDataAbilityObserver> eccSwitchObserver_;
+
 public:
+    static constexpr int32_t ECC_SWITCH_UNKNOWN = -1;
+    static constexpr int32_t ECC_SWITCH_OFF = 0;
+    static constexpr int32_t ECC_SWITCH_ON = 1;
     static const std::string INITIAL_FIRST_VALUE;
     static const std::string PARAMETERS_VALUE_ECC;
     static const std::string PARAMETERS_VALUE_OOBE;
@@ -130,6 +159,7 @@ public:
 class EmergencyCallConnectCallback : public AAFwk::AbilityConnectionStub {
 public:
     EmergencyCallConnectCallback() = default;
+    explicit EmergencyCallConnectCallback(bool isEccConnection) : isEccConnection_(isEccConnection) {}
     ~EmergencyCallConnectCallback() = default;
     void OnAbilityConnectDone(const AppExecFwk::ElementName &element, const sptr<IRemoteObject> &remoteObject,
         int resultCode);
@@ -139,6 +169,12 @@ public:
     static bool isStartEccService;
     static ffrt::mutex mutex_;
     static int32_t nowCallId;
+    static bool isEccServicePrepared;
+    static bool isEccConnectPending;
+    static std::chrono::steady_clock::time_point eccConnectBegin;
+
+private:
+    bool isEccConnection_ = false;
 };
 
 } // namespace Telephony
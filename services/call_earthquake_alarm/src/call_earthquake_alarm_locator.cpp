@@ -15,6 +15,8 @@
 
 #include "call_earthquake_alarm_locator.h"
 #include "call_manager_base.h"
+#include "call_manager_metrics.h"
+#include "call_timer_wheel.h"
 #include "ffrt.h"
 
 using namespace std;
@@ -39,6 +41,11 @@ const std::string MyLocationEngine::PARAMETERS_VALUE_OOBE = "call_manager_oobe_e
 const std::string MyLocationEngine::ALARM_SWITCH_ON = "1";
 const std::string MyLocationEngine::ALARM_SWITCH_OFF = "0";
 const std::string MyLocationEngine::INITIAL_FIRST_VALUE = "invalid";
+const char* MyLocationEngine::ECC_SWITCH_KEY = "emergency_post_location_switch";
+const char* MyLocationEngine::ECC_PREPARE_EXPIRE_TIMER = "ecc_service_prepare_expire";
+const int64_t MyLocationEngine::ECC_PREPARE_EXPIRE_MS = 30000;
+std::atomic<int32_t> MyLocationEngine::eccSwitchState_ = MyLocationEngine::ECC_SWITCH_UNKNOWN;
+sptr<AAFwk::IDataAbilityObserver> MyLocationEngine::eccSwitchObserver_ = nullptr;
 std::shared_ptr<MyLocationEngine> MyLocationEngine::mylocator = std::make_shared<MyLocationEngine>();
 std::shared_ptr<MyLocationEngine> MyLocationEngine::GetInstance()
 {
@@ -330,9 +337,47 @@ void OOBESwitchObserver::OnChange()
     });
 }
 
+void EccSwitchObserver::OnChange()
+{
+    MyLocationEngine::UpdateEccSwitchState();
+}
+
+void MyLocationEngine::InitEccSwitchObserver()
+{
+    if (eccSwitchObserver_ != nullptr) {
+        return;
+    }
+    eccSwitchObserver_ = sptr<EccSwitchObserver>::MakeSptr();
+    auto datashareHelper = std::make_shared<DataShareSwitchState>();
+    if (!datashareHelper->RegisterListenSettingsKey(ECC_SWITCH_KEY, true, eccSwitchObserver_)) {
+        TELEPHONY_LOGE("register ecc switch observer failed");
+        eccSwitchObserver_ = nullptr;
+        return;
+    }
+    UpdateEccSwitchState();
+}
+
+void MyLocationEngine::UpdateEccSwitchState()
+{
+    std::string value = "";
+    eccSwitchState_ = IsSwitchOn(ECC_SWITCH_KEY, value) ? ECC_SWITCH_ON : ECC_SWITCH_OFF;
+}
+
+bool MyLocationEngine::IsEccSwitchOn()
+{
+    if (eccSwitchState_ == ECC_SWITCH_UNKNOWN) {
+        std::string value = "";
+        return IsSwitchOn(ECC_SWITCH_KEY, value);
+    }
+    return eccSwitchState_ == ECC_SWITCH_ON;
+}
+
 ffrt::mutex EmergencyCallConnectCallback::mutex_;
 bool EmergencyCallConnectCallback::isStartEccService = false;
 int32_t EmergencyCallConnectCallback::nowCallId = -1;
+bool EmergencyCallConnectCallback::isEccServicePrepared = false;
+bool EmergencyCallConnectCallback::isEccConnectPending = false;
+std::chrono::steady_clock::time_point EmergencyCallConnectCallback::eccConnectBegin;
 sptr<AAFwk::IAbilityConnection> EmergencyCallConnectCallback::connectCallback_ = nullptr;
 sptr<AAFwk::IAbilityConnection> EmergencyCallConnectCallback::connectCallbackEcc = nullptr;
 void MyLocationEngine::ConnectAbility(std::string value, sptr<AAFwk::IAbilityConnection>& callback,
@@ -360,27 +405,94 @@ void MyLocationEngine::StartEccService(sptr<CallBase> call, const CallDetailInfo
         TELEPHONY_LOGE("call is nullptr");
         return;
     }
+    if (!call->GetEmergencyState()) {
+        TELEPHONY_LOGE("ecc state is false");
+        return;
+    }
+    if (EmergencyCallConnectCallback::isEccServicePrepared) {
+        DelayedSingleton<CallTimerWheel>::GetInstance()->Cancel(ECC_PREPARE_EXPIRE_TIMER);
+        EmergencyCallConnectCallback::nowCallId = call->GetCallID();
+        EmergencyCallConnectCallback::isEccServicePrepared = false;
+        TELEPHONY_LOGI("ecc service prepared at dial, bind callId %{public}d", call->GetCallID());
+        return;
+    }
     if (EmergencyCallConnectCallback::isStartEccService) {
         TELEPHONY_LOGE("ecc service already start");
         return;
     }
-    CallAttributeInfo attributeInfo;
-    call->GetCallAttributeInfo(attributeInfo);
-    if (!attributeInfo.isEcc) {
-        TELEPHONY_LOGE("ecc state is false");
+    if (!IsEccSwitchOn()) {
+        TELEPHONY_LOGE("ecc switch is close");
         return;
     }
-    std::string value = "";
-    if (!IsSwitchOn("emergency_post_location_switch", value)) {
-        TELEPHONY_LOGE("ecc switch is close");
+    ConnectEccService(info.accountId, std::string(info.phoneNum), std::chrono::steady_clock::now());
+    EmergencyCallConnectCallback::nowCallId = call->GetCallID();
+    EmergencyCallConnectCallback::isStartEccService = true;
+}
+
+void MyLocationEngine::PrepareEccService(
+    int32_t slotId, const std::string &number, std::chrono::steady_clock::time_point dialBegin)
+{
+    std::lock_guard<ffrt::mutex> lock(EmergencyCallConnectCallback::mutex_);
+    if (EmergencyCallConnectCallback::isStartEccService) {
+        TELEPHONY_LOGI("ecc service already start");
+        return;
+    }
+    if (!IsEccSwitchOn()) {
+        TELEPHONY_LOGI("ecc switch is close");
         return;
     }
+    // the connect latency counts from the dial request, including the wait for this task
+    ConnectEccService(slotId, number, dialBegin);
+    EmergencyCallConnectCallback::nowCallId = -1;
+    EmergencyCallConnectCallback::isStartEccService = true;
+    EmergencyCallConnectCallback::isEccServicePrepared = true;
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(ECC_PREPARE_EXPIRE_TIMER, ECC_PREPARE_EXPIRE_MS,
+        []() { ffrt::submit([]() { MyLocationEngine::OnEccPrepareExpired(); }); });
+}
+
+void MyLocationEngine::CancelPreparedEccService()
+{
+    std::lock_guard<ffrt::mutex> lock(EmergencyCallConnectCallback::mutex_);
+    if (!EmergencyCallConnectCallback::isEccServicePrepared) {
+        return;
+    }
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Cancel(ECC_PREPARE_EXPIRE_TIMER);
+    TELEPHONY_LOGI("ecc dial failed, disconnect the prepared ecc service");
+    DisconnectEccService();
+}
+
+void MyLocationEngine::OnEccPrepareExpired()
+{
+    std::lock_guard<ffrt::mutex> lock(EmergencyCallConnectCallback::mutex_);
+    if (!EmergencyCallConnectCallback::isEccServicePrepared) {
+        return;
+    }
+    TELEPHONY_LOGI("no ecc call bound to the prepared ecc service, disconnect it");
+    DisconnectEccService();
+}
+
+void MyLocationEngine::ConnectEccService(
+    int32_t slotId, const std::string &number, std::chrono::steady_clock::time_point connectBegin)
+{
+    if (EmergencyCallConnectCallback::connectCallbackEcc == nullptr) {
+        EmergencyCallConnectCallback::connectCallbackEcc = sptr<EmergencyCallConnectCallback>::MakeSptr(true);
+    }
+    EmergencyCallConnectCallback::eccConnectBegin = connectBegin;
+    EmergencyCallConnectCallback::isEccConnectPending = true;
     AAFwk::Want want;
-    want.SetParam(PARAMETERS_KEY_SLOTID, std::to_string(info.accountId));
-    want.SetParam(PARAMETERS_KEY_PHONE_NUMBER, std::string(info.phoneNum));
+    want.SetParam(PARAMETERS_KEY_SLOTID, std::to_string(slotId));
+    want.SetParam(PARAMETERS_KEY_PHONE_NUMBER, number);
     ConnectAbility(PARAMETERS_VALUE_ECC, EmergencyCallConnectCallback::connectCallbackEcc, want);
-    EmergencyCallConnectCallback::nowCallId = call->GetCallID();
-    EmergencyCallConnectCallback::isStartEccService = true;
+}
+
+void MyLocationEngine::DisconnectEccService()
+{
+    AAFwk::AbilityManagerClient::GetInstance()->DisconnectAbility(EmergencyCallConnectCallback::connectCallbackEcc);
+    EmergencyCallConnectCallback::connectCallbackEcc = nullptr;
+    EmergencyCallConnectCallback::nowCallId = -1;
+    EmergencyCallConnectCallback::isStartEccService = false;
+    EmergencyCallConnectCallback::isEccServicePrepared = false;
+    EmergencyCallConnectCallback::isEccConnectPending = false;
 }
 
 void MyLocationEngine::StopEccService(int32_t callId)
@@ -394,16 +506,25 @@ void MyLocationEngine::StopEccService(int32_t callId)
         TELEPHONY_LOGE("disconnect callId is not equal now dial callId");
         return;
     }
-    AAFwk::AbilityManagerClient::GetInstance()->DisconnectAbility(EmergencyCallConnectCallback::connectCallbackEcc);
-    EmergencyCallConnectCallback::connectCallbackEcc = nullptr;
-    EmergencyCallConnectCallback::nowCallId = -1;
-    EmergencyCallConnectCallback::isStartEccService = false;
+    DisconnectEccService();
 }
 
 void EmergencyCallConnectCallback::OnAbilityConnectDone(const AppExecFwk::ElementName &element,
     const sptr<IRemoteObject> &remoteObject, int resultCode)
 {
     TELEPHONY_LOGI("connect result code: %{public}d", resultCode);
+    if (!isEccConnection_) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!isEccConnectPending) {
+        return;
+    }
+    isEccConnectPending = false;
+    int64_t latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - eccConnectBegin).count();
+    CallManagerMetrics::GetInstance().Record(MetricHistogram::ECC_SERVICE_CONNECT_LATENCY, latencyUs);
+    TELEPHONY_LOGI("ecc service connected in %{public}lld us", static_cast<long long>(latencyUs));
 }
 
 void EmergencyCallConnectCallback::OnAbilityDisconnectDone(const AppExecFwk::ElementName &element, int resultCode)
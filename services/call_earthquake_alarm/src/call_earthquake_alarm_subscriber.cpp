@@ -178,6 +178,7 @@ void LocationSystemAbilityListener::OnAddSystemAbility(int32_t systemAbilityId,
         }
     }
     startService = true;
+    MyLocationEngine::InitEccSwitchObserver();
     std::string stateValue = MyLocationEngine::INITIAL_FIRST_VALUE;
     auto alarmSwitchState = MyLocationEngine::IsSwitchOn(LocationSubscriber::SWITCH_STATE_KEY, stateValue);
     if (stateValue == MyLocationEngine::INITIAL_FIRST_VALUE) {
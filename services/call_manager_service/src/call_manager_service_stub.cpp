@@ -18,6 +18,7 @@
 #include <string_ex.h>
 
 #include "call_manager_errors.h"
+#include "call_manager_metrics.h"
 #include "telephony_log_wrapper.h"
 
 #include "message_option.h"
@@ -324,6 +325,8 @@ int32_t CallManagerServiceStub::OnRemoteRequest(
     if (itFunc != memberFuncMap_.end()) {
         auto memberFunc = itFunc->second;
         if (memberFunc != nullptr) {
+            CallManagerMetrics::GetInstance().Increase(MetricCounter::IPC_REQUEST);
+            CallManagerMetricsTimer metricsTimer(MetricHistogram::IPC_LATENCY);
             int32_t idTimer = SetTimer(code);
             int32_t result = memberFunc(data, reply);
             CancelTimer(idTimer);
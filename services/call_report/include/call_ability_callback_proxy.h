@@ -31,6 +31,10 @@ public:
 
     int32_t OnCallDetailsChange(const CallAttributeInfo &info) override;
     int32_t OnMeeTimeDetailsChange(const CallAttributeInfo &info) override;
+    int32_t OnMarshalledCallDetailsChange(
+        const CallAttributeInfo &info, const CallAttributeInfoParcel &parcel) override;
+    int32_t OnMarshalledMeeTimeDetailsChange(
+        const CallAttributeInfo &info, const CallAttributeInfoParcel &parcel) override;
     int32_t OnCallEventChange(const CallEventInfo &info) override;
     int32_t OnCallDisconnectedCause(const DisconnectedDetails &details) override;
     int32_t OnReportAsyncResults(CallResultReportId reportId, AppExecFwk::PacMap &resultInfo) override;
@@ -71,6 +71,46 @@ int32_t CallAbilityCallbackProxy::OnMeeTimeDetailsChange(const CallAttributeInfo
     return replyParcel.ReadInt32();
 }
 
+int32_t CallAbilityCallbackProxy::OnMarshalledCallDetailsChange(
+    const CallAttributeInfo &info, const CallAttributeInfoParcel &parcel)
+{
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    MessageOption option(MessageOption::TF_ASYNC);
+    if (!dataParcel.WriteInterfaceToken(CallAbilityCallbackProxy::GetDescriptor())) {
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!parcel.WriteTo(dataParcel)) {
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    int32_t error = SendRequest(static_cast<uint32_t>(CallManagerCallAbilityInterfaceCode::UPDATE_CALL_STATE_INFO),
+        dataParcel, replyParcel, option);
+    if (error != TELEPHONY_SUCCESS) {
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    return replyParcel.ReadInt32();
+}
+
+int32_t CallAbilityCallbackProxy::OnMarshalledMeeTimeDetailsChange(
+    const CallAttributeInfo &info, const CallAttributeInfoParcel &parcel)
+{
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    MessageOption option(MessageOption::TF_ASYNC);
+    if (!dataParcel.WriteInterfaceToken(CallAbilityCallbackProxy::GetDescriptor())) {
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!parcel.WriteTo(dataParcel)) {
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    int32_t error = SendRequest(static_cast<uint32_t>(CallManagerCallAbilityInterfaceCode::UPDATE_MEETIME_STATE_INFO),
+        dataParcel, replyParcel, option);
+    if (error != TELEPHONY_SUCCESS) {
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    return replyParcel.ReadInt32();
+}
+
 int32_t CallAbilityCallbackProxy::OnCallEventChange(const CallEventInfo &info)
 {
     MessageParcel dataParcel;
@@ -22,6 +22,7 @@
 #include "bluetooth_call_manager.h"
 #include "call_ability_callback_death_recipient.h"
 #include "call_manager_errors.h"
+#include "call_manager_utils.h"
 #include "call_dialog.h"
 #include "iservice_registry.h"
 #include "system_ability.h"
@@ -175,12 +176,13 @@ int32_t CallAbilityReportProxy::ReportCallStateInfo(const CallAttributeInfo &inf
     std::string bundleInfo = "";
     CallAttributeInfo newInfo = info;
     UpdateBtCallSlotId(newInfo);
+    CallAttributeInfoParcel infoParcel(newInfo);
     std::lock_guard<ffrt::mutex> lock(mutex_);
     std::list<sptr<ICallAbilityCallback>>::iterator it = callbackPtrList_.begin();
     for (; it != callbackPtrList_.end(); ++it) {
         if ((*it)) {
             bundleInfo = (*it)->GetBundleInfo();
-            ret = (*it)->OnCallDetailsChange(newInfo);
+            ret = (*it)->OnMarshalledCallDetailsChange(newInfo, infoParcel);
             if (ret != TELEPHONY_SUCCESS) {
                 TELEPHONY_LOGD(
                     "OnCallDetailsChange failed, errcode:%{public}d, bundleInfo:%{public}s", ret, bundleInfo.c_str());
@@ -200,12 +202,13 @@ int32_t CallAbilityReportProxy::ReportMeeTimeStateInfo(const CallAttributeInfo &
 {
     int32_t ret = TELEPHONY_ERR_FAIL;
     std::string bundleInfo = "";
+    CallAttributeInfoParcel infoParcel(info);
     std::lock_guard<ffrt::mutex> lock(mutex_);
     std::list<sptr<ICallAbilityCallback>>::iterator it = callbackPtrList_.begin();
     for (; it != callbackPtrList_.end(); ++it) {
         if ((*it)) {
             bundleInfo = (*it)->GetBundleInfo();
-            ret = (*it)->OnMeeTimeDetailsChange(info);
+            ret = (*it)->OnMarshalledMeeTimeDetailsChange(info, infoParcel);
             if (ret != TELEPHONY_SUCCESS) {
                 TELEPHONY_LOGD("OnMeeTimeDetailsChange failed, errcode:%{public}d, bundleInfo:%{public}s",
                     ret, bundleInfo.c_str());
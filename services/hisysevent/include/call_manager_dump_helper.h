@@ -33,6 +33,10 @@ private:
     void ShowHelp(std::string &result) const;
     bool WhetherHasSimCard(const int32_t slotId) const;
     void ShowCallManagerInfo(std::string &result) const;
+    void ShowMetrics(std::string &result) const;
+    void ShowCalls(std::string &result) const;
+    void ShowTimers(std::string &result) const;
+    void ResetMetrics(std::string &result) const;
 };
 } // namespace Telephony
 } // namespace OHOS
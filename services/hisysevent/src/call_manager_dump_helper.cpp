@@ -15,16 +15,44 @@
 
 #include "call_manager_dump_helper.h"
 
+#include "audio_scene_processor.h"
+#include "call_control_manager.h"
+#include "call_manager_metrics.h"
 #include "call_manager_service.h"
+#include "call_object_manager.h"
+#include "call_timer_wheel.h"
 #include "core_service_client.h"
 
 namespace OHOS {
 namespace Telephony {
+static constexpr const char *DUMP_ARG_METRICS = "-metrics";
+static constexpr const char *DUMP_ARG_CALLS = "-calls";
+static constexpr const char *DUMP_ARG_RESET = "-reset";
+static constexpr const char *DUMP_ARG_TIMERS = "-timers";
+
 bool CallManagerDumpHelper::Dump(const std::vector<std::string> &args, std::string &result) const
 {
     result.clear();
-    ShowHelp(result);
-    ShowCallManagerInfo(result);
+    if (args.empty()) {
+        ShowHelp(result);
+        ShowCallManagerInfo(result);
+        return true;
+    }
+    for (const auto &arg : args) {
+        if (arg == DUMP_ARG_METRICS) {
+            ShowMetrics(result);
+        } else if (arg == DUMP_ARG_CALLS) {
+            ShowCalls(result);
+        } else if (arg == DUMP_ARG_RESET) {
+            ResetMetrics(result);
+        } else if (arg == DUMP_ARG_TIMERS) {
+            ShowTimers(result);
+        } else {
+            ShowHelp(result);
+            ShowCallManagerInfo(result);
+            return true;
+        }
+    }
     return true;
 }
 
@@ -55,7 +83,15 @@ void CallManagerDumpHelper::ShowHelp(std::string &result) const
         .append("-set_log_level <level>     ")
         .append("set call_manager SA's log level\n")
         .append("-perf_dump         ")
-        .append("dump performance statistics\n");
+        .append("dump performance statistics\n")
+        .append("-metrics         ")
+        .append("dump call_manager counters, gauges and latency histograms\n")
+        .append("-calls         ")
+        .append("dump the calls currently held by call_manager\n")
+        .append("-reset         ")
+        .append("reset call_manager counters and latency histograms\n")
+        .append("-timers         ")
+        .append("dump the pending call_manager timers\n");
 }
 
 void CallManagerDumpHelper::ShowCallManagerInfo(std::string &result) const
@@ -90,5 +126,62 @@ void CallManagerDumpHelper::ShowCallManagerInfo(std::string &result) const
     result.append(std::to_string(DelayedSingleton<CallManagerService>::GetInstance()->HasCall()));
     result.append("\n");
 }
+
+void CallManagerDumpHelper::ShowMetrics(std::string &result) const
+{
+    result.append("Ohos call_manager metrics:\n");
+    CallManagerMetrics::GetInstance().Dump(result);
+    auto audioSceneProcessor = DelayedSingleton<AudioSceneProcessor>::GetInstance();
+    if (audioSceneProcessor != nullptr) {
+        audioSceneProcessor->DumpEventLatency(result);
+    }
+    auto callControlManager = DelayedSingleton<CallControlManager>::GetInstance();
+    if (callControlManager != nullptr) {
+        callControlManager->DumpRequestLatency(result);
+    }
+}
+
+void CallManagerDumpHelper::ShowCalls(std::string &result) const
+{
+    std::vector<CallAttributeInfo> callList = CallObjectManager::GetAllCallInfoList();
+    result.append("Ohos call_manager calls: ");
+    result.append(std::to_string(callList.size()));
+    result.append("\n");
+    for (const auto &info : callList) {
+        result.append("callId = ");
+        result.append(std::to_string(info.callId));
+        result.append(", callState = ");
+        result.append(std::to_string(static_cast<int32_t>(info.callState)));
+        result.append(", callType = ");
+        result.append(std::to_string(static_cast<int32_t>(info.callType)));
+        result.append(", videoState = ");
+        result.append(std::to_string(static_cast<int32_t>(info.videoState)));
+        result.append(", slotId = ");
+        result.append(std::to_string(info.accountId));
+        result.append("\n");
+    }
+}
+
+void CallManagerDumpHelper::ShowTimers(std::string &result) const
+{
+    auto timerWheel = DelayedSingleton<CallTimerWheel>::GetInstance();
+    if (timerWheel != nullptr) {
+        timerWheel->Dump(result);
+    }
+}
+
+void CallManagerDumpHelper::ResetMetrics(std::string &result) const
+{
+    CallManagerMetrics::GetInstance().Reset();
+    auto audioSceneProcessor = DelayedSingleton<AudioSceneProcessor>::GetInstance();
+    if (audioSceneProcessor != nullptr) {
+        audioSceneProcessor->ResetEventLatency();
+    }
+    auto callControlManager = DelayedSingleton<CallControlManager>::GetInstance();
+    if (callControlManager != nullptr) {
+        callControlManager->ResetRequestLatency();
+    }
+    result.append("call_manager metrics reset\n");
+}
 } // namespace Telephony
 } // namespace OHOS
\ No newline at end of file
@@ -24,14 +24,12 @@
 #include "message_option.h"
 #include "message_parcel.h"
 #include "singleton.h"
-#include <atomic>
 #include <cstdint>
 #include <functional>
 
 namespace OHOS {
 namespace Telephony {
 
-using std::atomic;
 using std::function;
 using ffrt::recursive_mutex;
 using ConnectedCallback = function<void(sptr<IRemoteObject>)>;
@@ -78,10 +76,19 @@ class NumberIdentityConnection : public AAFwk::AbilityConnectionStub {
     sptr<IRemoteObject> remoteObject_;
 };
 
+/**
+ * Coalesces number mark data updates into notifications to the number identity extension. Triggers inside the
+ * coalescing window share one notification, a trigger that arrives while a notification is in flight gets a
+ * trailing one, and the ability connection is kept for an idle period so that bursts reuse it. A timed out
+ * notification is resent a few times with a growing delay and then dropped.
+ */
 class NumberIdentityServiceHelper {
     DECLARE_DELAYED_REF_SINGLETON(NumberIdentityServiceHelper);
 
   public:
+    using AbilityConnector = function<int32_t(const sptr<NumberIdentityConnection> &connection)>;
+    using AbilityDisconnector = function<int32_t(const sptr<NumberIdentityConnection> &connection)>;
+
     void NotifyNumberMarkDataUpdate();
 
   private:
@@ -91,11 +98,33 @@ class NumberIdentityServiceHelper {
 
     int Request(ConnectedCallback connectedCallback);
 
-    atomic<bool> working_ = false;
+    void ScheduleNotifyLocked(int64_t delayMs);
+
+    void FlushNotify();
+
+    void OnNotifyConnected(sptr<IRemoteObject> remote);
+
+    void OnNotifyDone();
+
+    void OnNotifyTimeout();
+
+    void OnConnectionIdle();
+
+    bool working_ = false;
+
+    bool pendingUpdate_ = false;
+
+    int32_t notifyRetryCount_ = 0;
+
+    ffrt::mutex notifyMutex_;
 
     recursive_mutex connectionMutex_;
 
     sptr<NumberIdentityConnection> connection_;
+
+    AbilityConnector abilityConnector_ = nullptr;
+
+    AbilityDisconnector abilityDisconnector_ = nullptr;
 };
 
 enum NumberIdentityServiceMessageCode {
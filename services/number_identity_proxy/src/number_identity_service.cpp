@@ -17,6 +17,7 @@
 #include <new>
 
 #include "c/type_def.h"
+#include "call_timer_wheel.h"
 #include "cpp/task.h"
 #include "errors.h"
 #include "extension_manager_client.h"
@@ -39,6 +40,13 @@ using std::lock_guard;
 inline constexpr const int USER_ID = 100;
 const char *NUMBER_IDENTITY_BUNDLE_NAME = "com.numberidentity";
 const char *NUMBER_IDENTITY_SERVICE_EXT_ABILITY = "NumberIdentityServiceExtAbility";
+constexpr const char *NUMBER_MARK_NOTIFY_TIMER = "number_mark_notify";
+constexpr const char *NUMBER_MARK_NOTIFY_TIMEOUT_TIMER = "number_mark_notify_timeout";
+constexpr const char *NUMBER_MARK_CONNECTION_IDLE_TIMER = "number_mark_connection_idle";
+constexpr int64_t NUMBER_MARK_NOTIFY_COALESCE_MS = 500;
+constexpr int64_t NUMBER_MARK_NOTIFY_TIMEOUT_MS = 10000;
+constexpr int64_t NUMBER_MARK_CONNECTION_IDLE_MS = 10000;
+constexpr int32_t NUMBER_MARK_NOTIFY_MAX_RETRY = 3;
 
 NumberIdentityConnection::NumberIdentityConnection(ConnectedCallback onConnected, DisconnectedCallback onDisconnected)
     : connectedCallback_(onConnected), disconnectedCallback_(onDisconnected)
@@ -115,7 +123,8 @@ int NumberIdentityServiceHelper::Connect(ConnectedCallback onConnected, Disconne
         TELEPHONY_LOGE("new NumberIdentityConnection failed.");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    auto ret = Client::GetInstance().ConnectServiceExtensionAbility(want, connection_, USER_ID);
+    auto ret = abilityConnector_ != nullptr ? abilityConnector_(connection_) :
+        Client::GetInstance().ConnectServiceExtensionAbility(want, connection_, USER_ID);
     if (ret != ERR_OK) {
         TELEPHONY_LOGE("ConnectServiceExtensionAbility failed, errCode = %{public}d", ret);
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
@@ -131,37 +140,132 @@ void NumberIdentityServiceHelper::Disconnect()
         TELEPHONY_LOGI("Already disconnected.");
         return;
     }
-    auto ret = Client::GetInstance().DisconnectAbility(connection_);
+    auto ret = abilityDisconnector_ != nullptr ? abilityDisconnector_(connection_) :
+        Client::GetInstance().DisconnectAbility(connection_);
     TELEPHONY_LOGI("DisconnectAbility errCode = %{public}d", ret);
     connection_ = nullptr;
 }
 
 void NumberIdentityServiceHelper::NotifyNumberMarkDataUpdate()
 {
-    TELEPHONY_LOGI("Notify task update begin.");
-    auto &helper = DelayedRefSingleton<NumberIdentityServiceHelper>::GetInstance();
-    ConnectedCallback onConnected = [&helper](sptr<IRemoteObject> remote) {
-        if (helper.working_) {
-            TELEPHONY_LOGI("NumberIdentityService notify task is working, skip this notify.");
+    lock_guard lock(notifyMutex_);
+    pendingUpdate_ = true;
+    if (working_) {
+        TELEPHONY_LOGI("Notify task is working, send a trailing notify after it.");
+        return;
+    }
+    ScheduleNotifyLocked(NUMBER_MARK_NOTIFY_COALESCE_MS);
+}
+
+void NumberIdentityServiceHelper::ScheduleNotifyLocked(int64_t delayMs)
+{
+    auto timerWheel = DelayedSingleton<CallTimerWheel>::GetInstance();
+    if (timerWheel->IsScheduled(NUMBER_MARK_NOTIFY_TIMER)) {
+        TELEPHONY_LOGI("Notify task already scheduled, coalesce this update.");
+        return;
+    }
+    timerWheel->Schedule(NUMBER_MARK_NOTIFY_TIMER, delayMs, [this]() {
+        ffrt::submit([this]() { FlushNotify(); }, task_attr().qos(qos_default::qos_background));
+    });
+    TELEPHONY_LOGI("Notify task scheduled.");
+}
+
+void NumberIdentityServiceHelper::FlushNotify()
+{
+    sptr<IRemoteObject> remote = nullptr;
+    {
+        lock_guard lock(notifyMutex_);
+        if (working_ || !pendingUpdate_) {
+            return;
+        }
+        working_ = true;
+        pendingUpdate_ = false;
+        auto timerWheel = DelayedSingleton<CallTimerWheel>::GetInstance();
+        timerWheel->Cancel(NUMBER_MARK_CONNECTION_IDLE_TIMER);
+        timerWheel->Schedule(NUMBER_MARK_NOTIFY_TIMEOUT_TIMER, NUMBER_MARK_NOTIFY_TIMEOUT_MS, [this]() {
+            ffrt::submit([this]() { OnNotifyTimeout(); }, task_attr().qos(qos_default::qos_background));
+        });
+        lock_guard connectionLock(connectionMutex_);
+        if (connection_ != nullptr && connection_->IsAlive()) {
+            TELEPHONY_LOGI("Reuse the idle connection.");
+            remote = connection_->GetAbilityProxy();
+        } else {
+            Disconnect();
+            auto ret = Connect([this](sptr<IRemoteObject> proxy) { OnNotifyConnected(proxy); },
+                []() { TELEPHONY_LOGI("NumberIdentityService notify task disconnected."); });
+            if (ret != TELEPHONY_SUCCESS) {
+                TELEPHONY_LOGE("Connect failed: ret = %{public}d", ret);
+                working_ = false;
+                timerWheel->Cancel(NUMBER_MARK_NOTIFY_TIMEOUT_TIMER);
+                connection_ = nullptr;
+            }
+            return;
+        }
+    }
+    OnNotifyConnected(remote);
+}
+
+void NumberIdentityServiceHelper::OnNotifyConnected(sptr<IRemoteObject> remote)
+{
+    {
+        lock_guard lock(notifyMutex_);
+        if (!working_) {
+            TELEPHONY_LOGI("Notify task already finished, skip this notify.");
             return;
         }
-        helper.working_ = true;
-        TELEPHONY_LOGI("NumberIdentityService async notify begin.");
-        NumberIdentityServiceProxy service(remote);
-        service.NotifyNumberMarkDataUpdate();
-        DelayedRefSingleton<NumberIdentityServiceHelper>::GetInstance().Disconnect();
-        TELEPHONY_LOGI("NumberIdentityService async notify end.");
-    };
-    DisconnectedCallback onDisconnected = [&helper]() {
-        TELEPHONY_LOGI("NumberIdentityService notify task disconnected.");
-        helper.working_ = false;
-    };
-    auto ret = helper.Connect(onConnected, onDisconnected);
-    if (ret != TELEPHONY_SUCCESS) {
-        TELEPHONY_LOGE("Connect failed: ret = %{public}d", ret);
+    }
+    TELEPHONY_LOGI("NumberIdentityService async notify begin.");
+    NumberIdentityServiceProxy service(remote);
+    service.NotifyNumberMarkDataUpdate();
+    TELEPHONY_LOGI("NumberIdentityService async notify end.");
+    OnNotifyDone();
+}
+
+void NumberIdentityServiceHelper::OnNotifyDone()
+{
+    lock_guard lock(notifyMutex_);
+    working_ = false;
+    notifyRetryCount_ = 0;
+    auto timerWheel = DelayedSingleton<CallTimerWheel>::GetInstance();
+    timerWheel->Cancel(NUMBER_MARK_NOTIFY_TIMEOUT_TIMER);
+    if (pendingUpdate_) {
+        ScheduleNotifyLocked(NUMBER_MARK_NOTIFY_COALESCE_MS);
         return;
     }
-    TELEPHONY_LOGI("Notify task scheduled.");
+    timerWheel->Schedule(NUMBER_MARK_CONNECTION_IDLE_TIMER, NUMBER_MARK_CONNECTION_IDLE_MS, [this]() {
+        ffrt::submit([this]() { OnConnectionIdle(); }, task_attr().qos(qos_default::qos_background));
+    });
+}
+
+void NumberIdentityServiceHelper::OnNotifyTimeout()
+{
+    lock_guard lock(notifyMutex_);
+    if (!working_) {
+        return;
+    }
+    TELEPHONY_LOGE("Notify task timed out, drop the connection.");
+    working_ = false;
+    Disconnect();
+    if (notifyRetryCount_ >= NUMBER_MARK_NOTIFY_MAX_RETRY) {
+        TELEPHONY_LOGE("Notify failed %{public}d times, drop the pending update.", notifyRetryCount_ + 1);
+        notifyRetryCount_ = 0;
+        pendingUpdate_ = false;
+        return;
+    }
+    // the timed out notify may never have reached the extension, send it again on a new connection with backoff
+    notifyRetryCount_++;
+    pendingUpdate_ = true;
+    ScheduleNotifyLocked(NUMBER_MARK_NOTIFY_COALESCE_MS << notifyRetryCount_);
+}
+
+void NumberIdentityServiceHelper::OnConnectionIdle()
+{
+    lock_guard lock(notifyMutex_);
+    if (working_ || pendingUpdate_) {
+        return;
+    }
+    TELEPHONY_LOGI("Connection idle, disconnect.");
+    Disconnect();
 }
 
 NumberIdentityServiceProxy::NumberIdentityServiceProxy(const sptr<IRemoteObject> &remote)
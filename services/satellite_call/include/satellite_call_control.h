@@ -40,6 +40,7 @@ private:
     void PublishSatelliteConnectEvent();
     int32_t SetSatelliteCallDurationProcessing();
     int32_t SetSatelliteCallCountDownProcessing();
+    static void HangUpSatelliteCalls();
     void RemoveCallDurationEventHandlerTask();
     void RemoveCallCountDownEventHandlerTask();
     void SetUsedModem();
@@ -47,8 +48,6 @@ private:
 private:
     SatCommTempLevel SatCommTempLevel_ = SatCommTempLevel::TEMP_LEVEL_LOW;
     bool isShowingDialog_ = false;
-    std::shared_ptr<AppExecFwk::EventHandler> CallDurationLimitHandler_;
-    std::shared_ptr<AppExecFwk::EventHandler> CallCountDownHandler_;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -20,6 +20,7 @@
 #include "call_dialog.h"
 #include "call_manager_utils.h"
 #include "call_object_manager.h"
+#include "call_timer_wheel.h"
 #include "common_event.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
@@ -40,6 +41,8 @@ namespace OHOS {
 namespace Telephony {
 const int32_t DELAYED_TIME = 270000;
 const int32_t COUNT_DOWN_TIME = 30000;
+constexpr const char *CALL_DURATION_TIMER = "start_satellite_call_duration_dialog";
+constexpr const char *CALL_COUNT_DOWN_TIMER = "satellite_call_count_down";
 const int32_t SATELLITE_CONNECTED = 1;
 const int32_t SATELLITE_MODE_ON = 1;
 constexpr const char *SATELLITE_TYPE_DEFAULT_VALUE = "0";
@@ -188,27 +191,22 @@ int32_t SatelliteCallControl::SetSatelliteCallDurationProcessing()
 {
     auto weak = weak_from_this();
     TELEPHONY_LOGI("start satellite call duration task");
-    auto runner = AppExecFwk::EventRunner::Create("start_satellite_call_duration_dialog");
-    if (CallDurationLimitHandler_ == nullptr) {
-        CallDurationLimitHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
-    }
-    if (CallDurationLimitHandler_ == nullptr) {
-        TELEPHONY_LOGI("CallDurationLimitHandler_ is nullptr");
-        return TELEPHONY_ERROR;
-    }
     auto task = [weak]() {
-        auto strong = weak.lock();
-        if (!strong) {
-            return;
-        }
-        if (!strong->IsShowDialog()) {
-            DelayedSingleton<CallDialog>::GetInstance()->DialogConnectExtension("SATELLITE_CALL_DURATION_LIMIT");
-            strong->SetShowDialog(true);
-        }
+        // connecting the dialog extension is an ability call, keep it off the timer wheel
+        ffrt::submit([weak]() {
+            auto strong = weak.lock();
+            if (!strong) {
+                return;
+            }
+            if (!strong->IsShowDialog()) {
+                DelayedSingleton<CallDialog>::GetInstance()->DialogConnectExtension("SATELLITE_CALL_DURATION_LIMIT");
+                strong->SetShowDialog(true);
+            }
+        });
     };
-    CallDurationLimitHandler_->RemoveTask("start_satellite_call_duration_dialog");
-    bool ret = CallDurationLimitHandler_->PostTask(task, "start_satellite_call_duration_dialog", DELAYED_TIME);
-    if (ret) {
+    uint64_t timerId = DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(CALL_DURATION_TIMER,
+        DELAYED_TIME, task);
+    if (timerId == INVALID_TIMER_ID) {
         TELEPHONY_LOGI("start satellite call duration task failed");
         return TELEPHONY_ERROR;
     }
@@ -217,58 +215,52 @@ int32_t SatelliteCallControl::SetSatelliteCallDurationProcessing()
 
 int32_t SatelliteCallControl::SetSatelliteCallCountDownProcessing()
 {
-        TELEPHONY_LOGI("start satellite call count down task");
-    auto runner = AppExecFwk::EventRunner::Create("satellite_call_count_down");
-    if (CallCountDownHandler_ == nullptr) {
-        CallCountDownHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
-    }
-    if (CallCountDownHandler_ == nullptr) {
-        TELEPHONY_LOGI("CallCountDownHandler_ is nullptr");
-        return TELEPHONY_ERROR;
-    }
+    TELEPHONY_LOGI("start satellite call count down task");
     auto task = []() {
-        std::list<int32_t> satelliteCallIdList;
-        int32_t ret = CallObjectManager::GetSatelliteCallList(satelliteCallIdList);
-        if (ret != TELEPHONY_SUCCESS) {
-            TELEPHONY_LOGI("GetSatelliteCallList failed");
-            return;
-        }
-        for (auto satelliteCallId : satelliteCallIdList) {
-            sptr<CallBase> satelliteCall = CallObjectManager::GetOneCallObject(satelliteCallId);
-            if (satelliteCall == nullptr) {
-                TELEPHONY_LOGE("satelliteCall is nullptr");
-                continue;
-            }
-            if (satelliteCall->GetTelCallState() == TelCallState::CALL_STATUS_INCOMING ||
-                satelliteCall->GetTelCallState() == TelCallState::CALL_STATUS_WAITING) {
-                DelayedSingleton<CallControlManager>::GetInstance()->RejectCall(satelliteCallId,
-                    true, u"satellitecalldurationlimit");
-            } else if (satelliteCall->GetTelCallState() == TelCallState::CALL_STATUS_ACTIVE) {
-                DelayedSingleton<CallControlManager>::GetInstance()->HangUpCall(satelliteCallId);
-            }
-        }
+        // rejecting and hanging up go to the cellular service, keep the loop off the timer wheel
+        ffrt::submit([]() { HangUpSatelliteCalls(); });
     };
-    CallCountDownHandler_->RemoveTask("satellite_call_count_down");
-    bool ret = CallCountDownHandler_->PostTask(task, "satellite_call_count_down", COUNT_DOWN_TIME);
-    if (ret) {
+    uint64_t timerId = DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(CALL_COUNT_DOWN_TIMER,
+        COUNT_DOWN_TIME, task);
+    if (timerId == INVALID_TIMER_ID) {
         TELEPHONY_LOGI("start satellite call count down task failed");
         return TELEPHONY_ERROR;
     }
     return TELEPHONY_SUCCESS;
 }
 
-void SatelliteCallControl::RemoveCallDurationEventHandlerTask()
+void SatelliteCallControl::HangUpSatelliteCalls()
 {
-    if (CallDurationLimitHandler_ != nullptr) {
-        CallDurationLimitHandler_->RemoveTask("start_satellite_call_duration_dialog");
+    std::list<int32_t> satelliteCallIdList;
+    int32_t ret = CallObjectManager::GetSatelliteCallList(satelliteCallIdList);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGI("GetSatelliteCallList failed");
+        return;
+    }
+    for (auto satelliteCallId : satelliteCallIdList) {
+        sptr<CallBase> satelliteCall = CallObjectManager::GetOneCallObject(satelliteCallId);
+        if (satelliteCall == nullptr) {
+            TELEPHONY_LOGE("satelliteCall is nullptr");
+            continue;
+        }
+        if (satelliteCall->GetTelCallState() == TelCallState::CALL_STATUS_INCOMING ||
+            satelliteCall->GetTelCallState() == TelCallState::CALL_STATUS_WAITING) {
+            DelayedSingleton<CallControlManager>::GetInstance()->RejectCall(satelliteCallId,
+                true, u"satellitecalldurationlimit");
+        } else if (satelliteCall->GetTelCallState() == TelCallState::CALL_STATUS_ACTIVE) {
+            DelayedSingleton<CallControlManager>::GetInstance()->HangUpCall(satelliteCallId);
+        }
     }
 }
 
+void SatelliteCallControl::RemoveCallDurationEventHandlerTask()
+{
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Cancel(CALL_DURATION_TIMER);
+}
+
 void SatelliteCallControl::RemoveCallCountDownEventHandlerTask()
 {
-    if (CallCountDownHandler_ != nullptr) {
-        CallCountDownHandler_->RemoveTask("satellite_call_count_down");
-    }
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Cancel(CALL_COUNT_DOWN_TIMER);
 }
 } // namespace Telephony
 } // namespace OHOSss
\ No newline at end of file
@@ -32,6 +32,8 @@ public:
     virtual ~CallStatusCallbackStub();
     int32_t OnRemoteRequest(
         uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override;
+    // calls reports are decoded straight into the call manager layout and handed over by move
+    virtual int32_t UpdateCallsDetailsInfo(CallDetailsInfo &&info) = 0;
 
 private:
     using CallStatusCallbackFunc = std::function<int32_t(MessageParcel &data, MessageParcel &reply)>;
@@ -85,6 +87,8 @@ private:
     void InitSupplementFuncMap();
     void InitImsFuncMap();
     void BuildCallReportInfo(MessageParcel &data, CallReportInfo &parcelPtr);
+    void BuildCallDetailInfo(MessageParcel &data, CallDetailInfo &detailInfo);
+    void ReadVoipCallReportInfo(MessageParcel &data, VoipCallReportInfo &voipCallInfo);
 
     std::map<uint32_t, CallStatusCallbackFunc> memberFuncMap_;
 };
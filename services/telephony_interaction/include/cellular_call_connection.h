@@ -16,6 +16,10 @@
 #ifndef CELLULAR_CALL_CONNECTION_H
 #define CELLULAR_CALL_CONNECTION_H
 
+#include <chrono>
+#include <memory>
+#include <vector>
+
 #include "ffrt.h"
 
 #include "call_status_callback.h"
@@ -582,6 +586,11 @@ public:
 #endif
 
 private:
+    struct ClearAllCallsRequest {
+        std::vector<CellularCallInfo> infos;
+        std::chrono::steady_clock::time_point begin;
+    };
+
     int32_t ConnectService();
     int32_t RegisterCallBackFun();
     void DisconnectService();
@@ -590,6 +599,11 @@ private:
     void Clean();
     void NotifyDeath();
     int32_t ClearAllCalls();
+    void OnServiceReady();
+    std::shared_ptr<ClearAllCallsRequest> TakePendingClear();
+    void PostClearAllCalls(std::shared_ptr<ClearAllCallsRequest> request);
+    void DispatchClearAllCalls(std::shared_ptr<ClearAllCallsRequest> request);
+    void OnClearAllCallsTimeout();
 
 private:
     class SystemAbilityListener : public SystemAbilityStatusChangeStub {
@@ -607,6 +621,8 @@ private:
     sptr<ISystemAbilityStatusChange> statusChangeListener_ = nullptr;
     std::atomic<bool> connectState_;
     ffrt::recursive_mutex clientLock_{};
+    ffrt::mutex clearMutex_{};
+    std::shared_ptr<ClearAllCallsRequest> pendingClear_ = nullptr;
 };
 } // namespace Telephony
 } // namespace OHOS
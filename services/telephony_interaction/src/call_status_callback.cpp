@@ -122,46 +122,57 @@ int32_t CallStatusCallback::ReportCallProcedureEvents(const std::string &callId,
 int32_t CallStatusCallback::UpdateCallsReportInfo(const CallsReportInfo &info)
 {
     CallDetailsInfo detailsInfo;
-    CallDetailInfo detailInfo;
-    detailInfo.index = 0;
-    detailInfo.state = TelCallState::CALL_STATUS_UNKNOWN;
-    CallsReportInfo callsInfo = info;
-    std::vector<CallReportInfo>::iterator it = callsInfo.callVec.begin();
-    for (; it != callsInfo.callVec.end(); ++it) {
-        detailInfo.callType = (*it).callType;
-        detailInfo.accountId = (*it).accountId;
-        detailInfo.index = (*it).index;
-        detailInfo.state = (*it).state;
-        detailInfo.callMode = (*it).callMode;
-        detailInfo.voiceDomain = (*it).voiceDomain;
-        detailInfo.mpty = (*it).mpty;
-        detailInfo.crsType = (*it).crsType;
-        detailInfo.originalCallType = (*it).originalCallType;
-        (void)memcpy_s(detailInfo.phoneNum, kMaxNumberLen, (*it).accountNum, kMaxNumberLen);
-        (void)memset_s(detailInfo.bundleName, kMaxBundleNameLen, 0, kMaxBundleNameLen);
-        detailInfo.name = (*it).name;
-        detailInfo.namePresentation = (*it).namePresentation;
-        detailInfo.reason = (*it).reason;
-        detailInfo.message = (*it).message;
-        detailInfo.newCallUseBox = (*it).newCallUseBox;
-        detailInfo.rttState = (*it).rttState;
-        detailInfo.rttChannelId = (*it).rttChannelId;
-        detailInfo.imsDomain = (*it).imsDomain;
-        detailsInfo.callVec.push_back(detailInfo);
+    detailsInfo.callVec.reserve(info.callVec.size());
+    for (const auto &it : info.callVec) {
+        detailsInfo.callVec.emplace_back();
+        CallDetailInfo &detailInfo = detailsInfo.callVec.back();
+        detailInfo.callType = it.callType;
+        detailInfo.accountId = it.accountId;
+        detailInfo.index = it.index;
+        detailInfo.state = it.state;
+        detailInfo.callMode = it.callMode;
+        detailInfo.voiceDomain = it.voiceDomain;
+        detailInfo.mpty = it.mpty;
+        detailInfo.crsType = it.crsType;
+        detailInfo.originalCallType = it.originalCallType;
+        (void)memcpy_s(detailInfo.phoneNum, kMaxNumberLen, it.accountNum, kMaxNumberLen);
+        detailInfo.name = it.name;
+        detailInfo.namePresentation = it.namePresentation;
+        detailInfo.reason = it.reason;
+        detailInfo.message = it.message;
+        detailInfo.newCallUseBox = it.newCallUseBox;
+        detailInfo.rttState = it.rttState;
+        detailInfo.rttChannelId = it.rttChannelId;
+        detailInfo.imsDomain = it.imsDomain;
+    }
+    detailsInfo.slotId = info.slotId;
+    return UpdateCallsDetailsInfo(std::move(detailsInfo));
+}
+
+int32_t CallStatusCallback::UpdateCallsDetailsInfo(CallDetailsInfo &&info)
+{
+    int32_t index = 0;
+    TelCallState state = TelCallState::CALL_STATUS_UNKNOWN;
+    CallType callType = CallType::TYPE_ERR_CALL;
+    VideoStateType callMode = VideoStateType::TYPE_VOICE;
+    if (!info.callVec.empty()) {
+        const CallDetailInfo &lastInfo = info.callVec.back();
+        index = lastInfo.index;
+        state = lastInfo.state;
+        callType = lastInfo.callType;
+        callMode = lastInfo.callMode;
     }
-    detailsInfo.slotId = callsInfo.slotId;
-    CallManagerHisysevent::WriteCallStateBehaviorEvent(
-        detailsInfo.slotId, static_cast<int32_t>(detailInfo.state), detailInfo.index);
-    (void)memset_s(detailsInfo.bundleName, kMaxBundleNameLen, 0, kMaxBundleNameLen);
+    CallManagerHisysevent::WriteCallStateBehaviorEvent(info.slotId, static_cast<int32_t>(state), index);
+    (void)memset_s(info.bundleName, kMaxBundleNameLen, 0, kMaxBundleNameLen);
 
-    if (detailInfo.state == TelCallState::CALL_STATUS_INCOMING) {
+    if (state == TelCallState::CALL_STATUS_INCOMING) {
         CallManagerHisysevent::WriteIncomingCallBehaviorEvent(
-            detailsInfo.slotId, static_cast<int32_t>(detailInfo.callType), static_cast<int32_t>(detailInfo.callMode));
+            info.slotId, static_cast<int32_t>(callType), static_cast<int32_t>(callMode));
         TELEPHONY_LOGI("CallStatusCallback InComingCall StartAsyncTrace!");
         DelayedSingleton<CallManagerHisysevent>::GetInstance()->SetIncomingStartTime();
         StartAsyncTrace(HITRACE_TAG_OHOS, "InComingCall", getpid());
     }
-    int32_t ret = DelayedSingleton<ReportCallInfoHandler>::GetInstance()->UpdateCallsReportInfo(detailsInfo);
+    int32_t ret = DelayedSingleton<ReportCallInfoHandler>::GetInstance()->UpdateCallsReportInfo(std::move(info));
     if (ret != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("UpdateCallsReportInfo failed! errCode:%{public}d", ret);
     } else {
@@ -205,16 +205,17 @@ int32_t CallStatusCallbackStub::OnUpdateCallsReportInfo(MessageParcel &data, Mes
         return TELEPHONY_ERR_ARGUMENT_INVALID;
     }
     TELEPHONY_LOGI("call list size:%{public}d", cnt);
-    CallsReportInfo callReportInfo;
-    CallReportInfo parcelPtr;
+    CallDetailsInfo detailsInfo;
+    detailsInfo.callVec.reserve(cnt);
     for (int32_t i = 0; i < cnt; i++) {
-        BuildCallReportInfo(data, parcelPtr);
-        callReportInfo.callVec.push_back(parcelPtr);
-        TELEPHONY_LOGW("accountId:%{public}d,state:%{public}d", parcelPtr.accountId, parcelPtr.state);
-    }
-    callReportInfo.slotId = data.ReadInt32();
-    TELEPHONY_LOGI("slotId:%{public}d", callReportInfo.slotId);
-    result = UpdateCallsReportInfo(callReportInfo);
+        detailsInfo.callVec.emplace_back();
+        CallDetailInfo &detailInfo = detailsInfo.callVec.back();
+        BuildCallDetailInfo(data, detailInfo);
+        TELEPHONY_LOGW("accountId:%{public}d,state:%{public}d", detailInfo.accountId, detailInfo.state);
+    }
+    detailsInfo.slotId = data.ReadInt32();
+    TELEPHONY_LOGI("slotId:%{public}d", detailsInfo.slotId);
+    result = UpdateCallsDetailsInfo(std::move(detailsInfo));
     if (!reply.WriteInt32(result)) {
         TELEPHONY_LOGE("writing parcel failed");
         return TELEPHONY_ERR_WRITE_REPLY_FAIL;
@@ -238,22 +239,7 @@ void CallStatusCallbackStub::BuildCallReportInfo(MessageParcel &data, CallReport
     parcelPtr.originalCallType = data.ReadInt32();
     parcelPtr.phoneIndex = data.ReadInt32();
     if (parcelPtr.callType == CallType::TYPE_VOIP) {
-        parcelPtr.voipCallInfo.voipCallId = data.ReadString();
-        parcelPtr.voipCallInfo.userName = data.ReadString();
-        parcelPtr.voipCallInfo.abilityName = data.ReadString();
-        parcelPtr.voipCallInfo.extensionId = data.ReadString();
-        parcelPtr.voipCallInfo.voipBundleName = data.ReadString();
-        parcelPtr.voipCallInfo.showBannerForIncomingCall = data.ReadBool();
-        parcelPtr.voipCallInfo.isConferenceCall = data.ReadBool();
-        parcelPtr.voipCallInfo.isVoiceAnswerSupported = data.ReadBool();
-        parcelPtr.voipCallInfo.isUserMuteRingToneAllowed = data.ReadBool();
-        parcelPtr.voipCallInfo.isDialingAllowedDuringCarrierCall = data.ReadBool();
-        parcelPtr.voipCallInfo.hasMicPermission = data.ReadBool();
-        parcelPtr.voipCallInfo.isCapsuleSticky = data.ReadBool();
-        parcelPtr.voipCallInfo.uid = data.ReadInt32();
-        std::vector<uint8_t> userProfile = {};
-        data.ReadUInt8Vector(&userProfile);
-        (parcelPtr.voipCallInfo.userProfile).assign(userProfile.begin(), userProfile.end());
+        ReadVoipCallReportInfo(data, parcelPtr.voipCallInfo);
     }
     parcelPtr.name = data.ReadString();
     parcelPtr.namePresentation = data.ReadInt32();
@@ -269,6 +255,60 @@ void CallStatusCallbackStub::BuildCallReportInfo(MessageParcel &data, CallReport
     parcelPtr.imsDomain = data.ReadInt32();
 }
 
+void CallStatusCallbackStub::BuildCallDetailInfo(MessageParcel &data, CallDetailInfo &detailInfo)
+{
+    detailInfo.index = data.ReadInt32();
+    const char *accountNum = data.ReadCString();
+    // an over-long number fails the copy and leaves the number empty, as the CallReportInfo decode always did
+    if (accountNum == nullptr ||
+        strncpy_s(detailInfo.phoneNum, kMaxNumberLen + 1, accountNum, kMaxNumberLen + 1) != EOK) {
+        TELEPHONY_LOGE("strncpy_s phoneNum failed");
+    }
+    detailInfo.accountId = data.ReadInt32();
+    detailInfo.callType = static_cast<CallType>(data.ReadInt32());
+    detailInfo.callMode = static_cast<VideoStateType>(data.ReadInt32());
+    detailInfo.state = static_cast<TelCallState>(data.ReadInt32());
+    detailInfo.voiceDomain = data.ReadInt32();
+    detailInfo.mpty = data.ReadInt32();
+    detailInfo.crsType = data.ReadInt32();
+    detailInfo.originalCallType = data.ReadInt32();
+    // the phone index and VoIP details are on the wire but calls reports never passed them to the call manager
+    (void)data.ReadInt32();
+    if (detailInfo.callType == CallType::TYPE_VOIP) {
+        VoipCallReportInfo voipCallInfo;
+        ReadVoipCallReportInfo(data, voipCallInfo);
+    }
+    detailInfo.name = data.ReadString();
+    detailInfo.namePresentation = data.ReadInt32();
+    int32_t reason = static_cast<int32_t>(DisconnectedReason::FAILED_UNKNOWN);
+    if (data.ReadInt32(reason)) {
+        detailInfo.reason = static_cast<DisconnectedReason>(reason);
+    }
+    detailInfo.message = data.ReadString();
+    detailInfo.newCallUseBox = data.ReadInt32();
+    detailInfo.rttState = static_cast<RttCallState>(data.ReadInt32());
+    detailInfo.rttChannelId = data.ReadInt32();
+    detailInfo.imsDomain = data.ReadInt32();
+}
+
+void CallStatusCallbackStub::ReadVoipCallReportInfo(MessageParcel &data, VoipCallReportInfo &voipCallInfo)
+{
+    voipCallInfo.voipCallId = data.ReadString();
+    voipCallInfo.userName = data.ReadString();
+    voipCallInfo.abilityName = data.ReadString();
+    voipCallInfo.extensionId = data.ReadString();
+    voipCallInfo.voipBundleName = data.ReadString();
+    voipCallInfo.showBannerForIncomingCall = data.ReadBool();
+    voipCallInfo.isConferenceCall = data.ReadBool();
+    voipCallInfo.isVoiceAnswerSupported = data.ReadBool();
+    voipCallInfo.isUserMuteRingToneAllowed = data.ReadBool();
+    voipCallInfo.isDialingAllowedDuringCarrierCall = data.ReadBool();
+    voipCallInfo.hasMicPermission = data.ReadBool();
+    voipCallInfo.isCapsuleSticky = data.ReadBool();
+    voipCallInfo.uid = data.ReadInt32();
+    data.ReadUInt8Vector(&voipCallInfo.userProfile);
+}
+
 int32_t CallStatusCallbackStub::OnUpdateDisconnectedCause(MessageParcel &data, MessageParcel &reply)
 {
     int32_t result = TELEPHONY_ERR_FAIL;
@@ -15,10 +15,11 @@
 
 #include "cellular_call_connection.h"
 
-#include <thread>
-
 #include "call_manager_errors.h"
 #include "call_manager_hisysevent.h"
+#include "call_manager_metrics.h"
+#include "call_task_executor.h"
+#include "call_timer_wheel.h"
 #include "cellular_call_proxy.h"
 #include "iservice_registry.h"
 #include "system_ability.h"
@@ -30,7 +31,11 @@ namespace Telephony {
 #ifdef RECONNECT_MAX_TRY_COUNT
 constexpr uint16_t CONNECT_MAX_TRY_COUNT = 5;
 #endif
-constexpr uint16_t DELAY_TIME = 100;
+constexpr const char *CLEAR_ALL_CALLS_TIMER = "clear_all_calls_wait_ready";
+constexpr int64_t CLEAR_ALL_CALLS_WAIT_READY_MS = 3000;
+namespace {
+ffrt::queue clearAllCallsQueue { "cellular_call_clear_all" };
+} // namespace
 
 CellularCallConnection::CellularCallConnection()
     : systemAbilityId_(TELEPHONY_CELLULAR_CALL_SYS_ABILITY_ID), cellularCallCallbackPtr_(nullptr),
@@ -114,6 +119,7 @@ int32_t CellularCallConnection::ConnectService()
         return ret;
     }
     connectState_ = true;
+    OnServiceReady();
     return TELEPHONY_SUCCESS;
 }
 
@@ -882,40 +888,105 @@ int32_t CellularCallConnection::ClearAllCalls()
         TELEPHONY_LOGI("no call exist, no need to clear");
         return TELEPHONY_SUCCESS;
     }
-    std::vector<CellularCallInfo> callsInfo;
-    std::vector<CallAttributeInfo> infos = CallObjectManager::GetAllCallInfoList();
-    for (auto &info : infos) {
-        CellularCallInfo callInfo;
-        callInfo.callId = info.callId;
-        if (memset_s(callInfo.phoneNum, kMaxNumberLen, 0, kMaxNumberLen) != EOK) {
-            TELEPHONY_LOGE("memset_s fail");
-            return TELEPHONY_ERR_MEMSET_FAIL;
-        }
-        if (memcpy_s(callInfo.phoneNum, kMaxNumberLen, info.accountNumber, strlen(info.accountNumber)) != EOK) {
-            TELEPHONY_LOGE("memcpy_s fail");
-            return TELEPHONY_ERR_MEMCPY_FAIL;
-        }
-        callInfo.slotId = info.accountId;
-        callInfo.accountId = info.accountId;
-        callInfo.callType = info.callType;
-        callInfo.videoState = static_cast<int32_t>(info.videoState);
-        callInfo.index = info.index;
-        callsInfo.push_back(callInfo);
-    }
-    if (callsInfo.empty()) {
+    auto request = std::make_shared<ClearAllCallsRequest>();
+    request->begin = std::chrono::steady_clock::now();
+    int32_t ret = CallObjectManager::GetCellularCallInfoList(request->infos);
+    if (ret != TELEPHONY_SUCCESS) {
+        return ret;
+    }
+    if (request->infos.empty()) {
         TELEPHONY_LOGE("callsInfo is empty");
         return TELEPHONY_ERR_ARGUMENT_INVALID;
     }
-    std::this_thread::sleep_for(std::chrono::milliseconds(DELAY_TIME));
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
-        TELEPHONY_LOGE("ipc reconnect failed!");
-        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    bool isReady = false;
+    {
+        // only decide under the lock, the timer wheel is never called while holding it
+        std::lock_guard<ffrt::mutex> lock(clearMutex_);
+        if (pendingClear_ != nullptr) {
+            TELEPHONY_LOGI("replace the clear request still waiting for the service");
+        }
+        isReady = connectState_;
+        pendingClear_ = isReady ? nullptr : request;
+    }
+    if (isReady) {
+        PostClearAllCalls(request);
+        return TELEPHONY_SUCCESS;
+    }
+    TELEPHONY_LOGI("cellular call service not ready, clear %{public}zu calls once ready", request->infos.size());
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(CLEAR_ALL_CALLS_TIMER, CLEAR_ALL_CALLS_WAIT_READY_MS,
+        [weak = weak_from_this()]() {
+            auto connection = weak.lock();
+            if (connection != nullptr) {
+                connection->OnClearAllCallsTimeout();
+            }
+        });
+    return TELEPHONY_SUCCESS;
+}
+
+/*
+ * The clear request used to sleep 100 ms after the reconnect in the SA listener. The callback registration had
+ * already succeeded at that point, so the sleep was no readiness check, it only gave the restarted cellular call
+ * service some settling time. The registration reply is the first point where the service is known to take
+ * requests, and it is the signal the parked request waits for.
+ */
+void CellularCallConnection::OnServiceReady()
+{
+    std::shared_ptr<ClearAllCallsRequest> request = TakePendingClear();
+    if (request != nullptr) {
+        PostClearAllCalls(request);
     }
-    int32_t errCode = cellularCallInterfacePtr_->ClearAllCalls(callsInfo);
+}
+
+std::shared_ptr<CellularCallConnection::ClearAllCallsRequest> CellularCallConnection::TakePendingClear()
+{
+    std::lock_guard<ffrt::mutex> lock(clearMutex_);
+    std::shared_ptr<ClearAllCallsRequest> request = std::move(pendingClear_);
+    pendingClear_ = nullptr;
+    return request;
+}
+
+void CellularCallConnection::PostClearAllCalls(std::shared_ptr<ClearAllCallsRequest> request)
+{
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Cancel(CLEAR_ALL_CALLS_TIMER);
+    std::function<void()> task = [weak = weak_from_this(), request]() {
+        auto connection = weak.lock();
+        if (connection != nullptr) {
+            connection->DispatchClearAllCalls(request);
+        }
+    };
+    DelayedSingleton<CallTaskExecutor>::GetInstance()->Submit(clearAllCallsQueue, task);
+}
+
+void CellularCallConnection::DispatchClearAllCalls(std::shared_ptr<ClearAllCallsRequest> request)
+{
+    int32_t errCode = TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    {
+        std::lock_guard<ffrt::recursive_mutex> lock(clientLock_);
+        if (ReConnectService() != TELEPHONY_SUCCESS || cellularCallInterfacePtr_ == nullptr) {
+            TELEPHONY_LOGE("ipc reconnect failed!");
+        } else {
+            errCode = cellularCallInterfacePtr_->ClearAllCalls(request->infos);
+        }
+    }
+    int64_t latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - request->begin).count();
+    CallManagerMetrics::GetInstance().Record(MetricHistogram::CLEAR_ALL_CALLS_LATENCY, latencyUs);
+    // the cellular call service answers the whole batch with a single result
     if (errCode != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("ClearAllCalls fail, errcode:%{public}d", errCode);
+        return;
+    }
+    TELEPHONY_LOGI("clear %{public}zu calls success", request->infos.size());
+}
+
+void CellularCallConnection::OnClearAllCallsTimeout()
+{
+    std::shared_ptr<ClearAllCallsRequest> request = TakePendingClear();
+    if (request == nullptr) {
+        return;
     }
-    return errCode;
+    TELEPHONY_LOGE("cellular call service not ready in time, try to clear calls anyway");
+    PostClearAllCalls(request);
 }
 
 void CellularCallConnection::SystemAbilityListener::OnAddSystemAbility(
@@ -15,8 +15,11 @@
 
 #include "report_call_info_handler.h"
 
+#include <chrono>
+
 #include "call_manager_errors.h"
 #include "call_manager_hisysevent.h"
+#include "call_manager_metrics.h"
 #include "call_manager_service.h"
 #include "ffrt.h"
 #include "ffrt_inner.h"
@@ -29,6 +32,21 @@ namespace OHOS {
 namespace Telephony {
 namespace {
 ffrt::queue reportCallInfoQueue { "report_call_info_queue", ffrt::queue_attr().qos(ffrt_qos_user_interactive)};
+
+template<typename Task>
+void SubmitReportTask(Task &&task)
+{
+    CallManagerMetrics::GetInstance().GaugeIncrease(MetricGauge::REPORT_QUEUE_DEPTH);
+    auto enqueueTime = std::chrono::steady_clock::now();
+    reportCallInfoQueue.submit([reportTask = std::forward<Task>(task), enqueueTime]() {
+        CallManagerMetrics &metrics = CallManagerMetrics::GetInstance();
+        metrics.GaugeDecrease(MetricGauge::REPORT_QUEUE_DEPTH);
+        metrics.Increase(MetricCounter::REPORT_QUEUE_TASK);
+        metrics.Record(MetricHistogram::REPORT_QUEUE_WAIT, std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - enqueueTime).count());
+        reportTask();
+    });
+}
 }
 ReportCallInfoHandler::ReportCallInfoHandler() {}
 
@@ -66,7 +84,7 @@ int32_t ReportCallInfoHandler::UpdateCallReportInfo(const CallDetailInfo &info)
     CallDetailInfo callDetailInfo = info;
     std::weak_ptr<CallStatusManager> callStatusManagerPtr = callStatusManagerPtr_;
     TELEPHONY_LOGW("UpdateCallReportInfo submit task enter");
-    reportCallInfoQueue.submit([callStatusManagerPtr, callDetailInfo]() {
+    SubmitReportTask([callStatusManagerPtr, callDetailInfo]() {
         std::shared_ptr<CallStatusManager> managerPtr = callStatusManagerPtr.lock();
         if (managerPtr == nullptr) {
             TELEPHONY_LOGE("managerPtr is null");
@@ -120,6 +138,7 @@ int32_t ReportCallInfoHandler::ReportCallProcedureEvents(const std::string &call
 void ReportCallInfoHandler::BuildCallDetailsInfo(CallDetailsInfo &info, CallDetailsInfo &callDetailsInfo)
 {
     CallDetailInfo callDetailInfo;
+    callDetailsInfo.callVec.reserve(info.callVec.size());
     std::vector<CallDetailInfo>::iterator iter = info.callVec.begin();
     for (; iter != info.callVec.end(); ++iter) {
         callDetailInfo.callType = (*iter).callType;
@@ -156,9 +175,28 @@ int32_t ReportCallInfoHandler::UpdateCallsReportInfo(CallDetailsInfo &info)
     callDetailsInfo.slotId = info.slotId;
     (void)memcpy_s(callDetailsInfo.bundleName, kMaxBundleNameLen, info.bundleName, kMaxBundleNameLen);
     BuildCallDetailsInfo(info, callDetailsInfo);
+    return UpdateCallsReportInfo(std::move(callDetailsInfo));
+}
+
+int32_t ReportCallInfoHandler::UpdateCallsReportInfo(CallDetailsInfo &&info)
+{
+    if (callStatusManagerPtr_ == nullptr) {
+        TELEPHONY_LOGE("callStatusManagerPtr_ is null");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    bool isIncoming = false;
+    CallType callType = CallType::TYPE_ERR_CALL;
+    VideoStateType callMode = VideoStateType::TYPE_VOICE;
+    if (!info.callVec.empty()) {
+        const CallDetailInfo &lastInfo = info.callVec.back();
+        isIncoming = lastInfo.state == TelCallState::CALL_STATUS_INCOMING;
+        callType = lastInfo.callType;
+        callMode = lastInfo.callMode;
+    }
+    int32_t slotId = info.slotId;
     std::weak_ptr<CallStatusManager> callStatusManagerPtr = callStatusManagerPtr_;
     TELEPHONY_LOGW("UpdateCallsReportInfo submit task enter");
-    reportCallInfoQueue.submit([callStatusManagerPtr, callDetailsInfo]() {
+    SubmitReportTask([callStatusManagerPtr, callDetailsInfo = std::move(info)]() {
         std::shared_ptr<CallStatusManager> managerPtr = callStatusManagerPtr.lock();
         if (managerPtr == nullptr) {
             TELEPHONY_LOGE("managerPtr is null");
@@ -169,20 +207,9 @@ int32_t ReportCallInfoHandler::UpdateCallsReportInfo(CallDetailsInfo &info)
             TELEPHONY_LOGE("HandleCallsReportInfo failed! ret:%{public}d", ret);
         }
     });
-
-    CallDetailInfo detailInfo;
-    detailInfo.state = TelCallState::CALL_STATUS_UNKNOWN;
-    std::vector<CallDetailInfo>::iterator it = info.callVec.begin();
-    for (; it != info.callVec.end(); ++it) {
-        detailInfo.callType = (*it).callType;
-        detailInfo.accountId = (*it).accountId;
-        detailInfo.state = (*it).state;
-        detailInfo.callMode = (*it).callMode;
-    }
-    if (detailInfo.state == TelCallState::CALL_STATUS_INCOMING) {
-        CallManagerHisysevent::WriteIncomingCallFaultEvent(info.slotId, static_cast<int32_t>(detailInfo.callType),
-            static_cast<int32_t>(detailInfo.callMode), CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE,
-            "ID HANDLER_UPDATE_CALL_INFO_LIST");
+    if (isIncoming) {
+        CallManagerHisysevent::WriteIncomingCallFaultEvent(slotId, static_cast<int32_t>(callType),
+            static_cast<int32_t>(callMode), CALL_ERR_SYSTEM_EVENT_HANDLE_FAILURE, "ID HANDLER_UPDATE_CALL_INFO_LIST");
     }
     return TELEPHONY_SUCCESS;
 }
@@ -199,7 +226,7 @@ int32_t ReportCallInfoHandler::UpdateDisconnectedCause(const DisconnectedDetails
     }
     std::weak_ptr<CallStatusManager> callStatusManagerPtr = callStatusManagerPtr_;
     TELEPHONY_LOGI("UpdateDisconnectedCause submit task enter");
-    reportCallInfoQueue.submit([callStatusManagerPtr, disconnectedDetails]() {
+    SubmitReportTask([callStatusManagerPtr, disconnectedDetails]() {
         std::shared_ptr<CallStatusManager> managerPtr = callStatusManagerPtr.lock();
         if (managerPtr == nullptr) {
             TELEPHONY_LOGE("managerPtr is null");
@@ -222,7 +249,7 @@ int32_t ReportCallInfoHandler::UpdateEventResultInfo(const CellularCallEventInfo
     }
     std::weak_ptr<CallStatusManager> callStatusManagerPtr = callStatusManagerPtr_;
     TELEPHONY_LOGI("UpdateEventResultInfo submit task enter");
-    reportCallInfoQueue.submit([callStatusManagerPtr, info]() {
+    SubmitReportTask([callStatusManagerPtr, info]() {
         std::shared_ptr<CallStatusManager> managerPtr = callStatusManagerPtr.lock();
         if (managerPtr == nullptr) {
             TELEPHONY_LOGE("managerPtr is null");
@@ -246,7 +273,7 @@ int32_t ReportCallInfoHandler::UpdateOttEventInfo(const OttCallEventInfo &info)
     OttCallEventInfo ottCallEventInfo = info;
     std::weak_ptr<CallStatusManager> callStatusManagerPtr = callStatusManagerPtr_;
     TELEPHONY_LOGI("UpdateOttEventInfo submit task enter");
-    reportCallInfoQueue.submit([callStatusManagerPtr, ottCallEventInfo]() {
+    SubmitReportTask([callStatusManagerPtr, ottCallEventInfo]() {
         std::shared_ptr<CallStatusManager> managerPtr = callStatusManagerPtr.lock();
         if (managerPtr == nullptr) {
             TELEPHONY_LOGE("managerPtr is null");
@@ -264,7 +291,7 @@ int32_t ReportCallInfoHandler::UpdateOttEventInfo(const OttCallEventInfo &info)
 int32_t ReportCallInfoHandler::ReceiveImsCallModeRequest(const CallModeReportInfo &response)
 {
     TELEPHONY_LOGI("ReceiveImsCallModeRequest submit task enter");
-    reportCallInfoQueue.submit([response]() {
+    SubmitReportTask([response]() {
         CallModeReportInfo reportInfo = response;
         sptr<CallBase> call = CallObjectManager::GetOneCallObjectByIndex(response.callIndex);
         if (call == nullptr) {
@@ -282,7 +309,7 @@ int32_t ReportCallInfoHandler::ReceiveImsCallModeRequest(const CallModeReportInf
 int32_t ReportCallInfoHandler::ReceiveImsCallModeResponse(const CallModeReportInfo &response)
 {
     TELEPHONY_LOGI("ReceiveImsCallModeResponse submit task enter");
-    reportCallInfoQueue.submit([response]() {
+    SubmitReportTask([response]() {
         CallModeReportInfo reportInfo = response;
         sptr<CallBase> call = nullptr;
         if (response.slotId != -1) {
@@ -312,7 +339,7 @@ int32_t ReportCallInfoHandler::UpdateVoipEventInfo(const VoipCallEventInfo &info
     VoipCallEventInfo voipCallEventInfo = info;
     std::weak_ptr<CallStatusManager> callStatusManagerPtr = callStatusManagerPtr_;
     TELEPHONY_LOGI("UpdateVoipEventInfo submit task enter");
-    reportCallInfoQueue.submit([callStatusManagerPtr, voipCallEventInfo]() {
+    SubmitReportTask([callStatusManagerPtr, voipCallEventInfo]() {
         std::shared_ptr<CallStatusManager> managerPtr = callStatusManagerPtr.lock();
         if (managerPtr == nullptr) {
             TELEPHONY_LOGE("managerPtr is null");
@@ -336,7 +363,7 @@ void ReportCallInfoHandler::UpdateRttEventInfo(const ImsRTTEventType &eventType)
     ImsRTTEventType currEventType = eventType;
     std::weak_ptr<CallStatusManager> callStatusManagerPtr = callStatusManagerPtr_;
     TELEPHONY_LOGI("UpdateRttEventInfo submit task enter");
-    reportCallInfoQueue.submit([callStatusManagerPtr, currEventType]() {
+    SubmitReportTask([callStatusManagerPtr, currEventType]() {
         std::shared_ptr<CallStatusManager> managerPtr = callStatusManagerPtr.lock();
         if (managerPtr == nullptr) {
             TELEPHONY_LOGE("managerPtr is null");
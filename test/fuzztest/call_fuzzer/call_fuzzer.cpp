@@ -558,17 +558,17 @@ void AntiFraudServiceFunc(FuzzedDataProvider& provider)
     antiFraudService->IsSwitchOn(provider.ConsumeRandomLengthString());
     antiFraudService->IsAntiFraudSwitchOn(videoState);
     antiFraudService->IsUserImprovementPlanSwitchOn();
-    antiFraudService->InitParams();
-    antiFraudService->GetStoppedSlotId();
-    antiFraudService->GetStoppedIndex();
-    antiFraudService->AnonymizeText();
+    antiFraudService->IsDetecting(slotId, count);
+    antiFraudService->GetSession(slotId, count);
+    std::string detectText = provider.ConsumeRandomLengthString();
+    antiFraudService->AnonymizeText(detectText);
     OHOS::AntiFraudService::StartDetectionResult antiFraudResult;
     antiFraudResult.voiceDetectionResult.modelVersion = provider.ConsumeIntegral<int32_t>();
     antiFraudResult.voiceDetectionResult.fraudType = provider.ConsumeIntegral<int32_t>();
     antiFraudService->RecordDetectResult(antiFraudResult, provider.ConsumeRandomLengthString(), slotId, count);
     antiFraudService->StopAntiFraudService(slotId, count);
-    antiFraudService->SetStoppedSlotId(slotId);
-    antiFraudService->SetStoppedIndex(count);
+    antiFraudService->ClaimDetectSession(slotId, count);
+    antiFraudService->ReleaseSession(slotId, count);
     auto antiFraudAdapter = DelayedSingleton<AntiFraudAdapter>::GetInstance();
     antiFraudAdapter->ReleaseAntiFraud();
     auto listener = std::make_shared<Telephony::AntiFraudService::AntiFraudStartDetectResListenerImpl>(
@@ -21,10 +21,20 @@
 #include "antifraud_adapter.h"
 #include "anonymize_adapter.h"
 #include "antifraud_cloud_service.h"
+#include "antifraud_uploader.h"
+#include "call_timer_wheel.h"
+#include "fake_call_task_executor.h"
 #include "common_type.h"
 #include "telephony_log_wrapper.h"
 #include "gtest/gtest.h"
 
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
 namespace OHOS {
 namespace Telephony {
 using namespace testing::ext;
@@ -32,6 +42,17 @@ using namespace testing::ext;
 constexpr int32_t VALID_SLOT_ID = 0;
 constexpr int32_t VALID_INDEX = 0;
 constexpr int32_t INVALID_SLOT_ID = -1;
+constexpr int32_t SECOND_SLOT_ID = 1;
+constexpr int32_t SECOND_INDEX = 1;
+constexpr int32_t STRESS_WRITER_NUM = 4;
+constexpr int32_t STRESS_READER_NUM = 4;
+constexpr int32_t STRESS_ROUND_NUM = 2000;
+constexpr int64_t FIRST_RETRY_DELAY_MS = 30000;
+constexpr int64_t RETRY_MARGIN_MS = 100;
+constexpr int64_t THIRD_RETRY_DELAY_MS = 120000;
+constexpr int32_t UPLOAD_ROUND_NUM = 10;
+constexpr const char *UPLOAD_QUEUE_TEST_PATH = "/data/local/tmp/antifraud_upload_queue_test.json";
+constexpr const char *UPLOAD_RETRY_TIMER = "antifraud_upload_retry";
 
 class AntiFraudServiceTest : public testing::Test {
 public:
@@ -52,14 +73,14 @@ void AntiFraudServiceTest::SetUp()
 {
     antiFraudService_ = DelayedSingleton<AntiFraudService>::GetInstance();
     ASSERT_TRUE(antiFraudService_ != nullptr);
-    antiFraudService_->InitParams();
+    antiFraudService_->sessionTable_.Clear();
 }
 
 void AntiFraudServiceTest::TearDown()
 {
     // 清理状态,确保用例之间不互相影响
     if (antiFraudService_ != nullptr) {
-        antiFraudService_->InitParams();
+        antiFraudService_->sessionTable_.Clear();
         antiFraudService_->SetCallStatusManager(nullptr);
     }
 }
@@ -78,39 +99,31 @@ HWTEST_F(AntiFraudServiceTest, AntiFraudService_SetCallStatusManager_0100, TestS
 }
 
 /**
- * @tc.number   AntiFraudService_InitParams_0200
- * @tc.name     Test InitParams resets all state to default values
+ * @tc.number   AntiFraudService_DetectSession_0500
+ * @tc.name     Test ClaimDetectSession/IsDetecting/ReleaseSession default and round-trip
  * @tc.desc     Function test
  */
-HWTEST_F(AntiFraudServiceTest, AntiFraudService_InitParams_0200, TestSize.Level1)
-{
-    /* 故意设置非默认值 */
-    antiFraudService_->fraudDetectText_ = "dirty";;
-    antiFraudService_->antiFraudState_ = 99;
-
-    antiFraudService_->InitParams();
-
-    EXPECT_EQ(antiFraudService_->fraudDetectText_, "");
-    EXPECT_EQ(antiFraudService_->antiFraudState_,
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_DEFAULT));
-}
-
-/**
- * @tc.number   AntiFraudService_StoppedSlotId_0500
- * @tc.name     Test GetStoppedSlotId/Index default and round-trip
- * @tc.desc     Function test
- */
-HWTEST_F(AntiFraudServiceTest, AntiFraudService_StoppedSlotId_0500, TestSize.Level1)
+HWTEST_F(AntiFraudServiceTest, AntiFraudService_DetectSession_0500, TestSize.Level1)
 {
     /* 默认值校验 */
-    EXPECT_EQ(antiFraudService_->GetStoppedSlotId(), -1);
-    EXPECT_EQ(antiFraudService_->GetStoppedIndex(), -1);
+    EXPECT_FALSE(antiFraudService_->IsDetecting(VALID_SLOT_ID, VALID_INDEX));
+    EXPECT_EQ(antiFraudService_->GetSession(VALID_SLOT_ID, VALID_INDEX), nullptr);
+    EXPECT_FALSE(antiFraudService_->ClaimDetectSession(INVALID_SLOT_ID, VALID_INDEX));
 
     /* 写后读一致性 */
-    antiFraudService_->SetStoppedSlotId(VALID_SLOT_ID);
-    antiFraudService_->SetStoppedIndex(VALID_INDEX);
-    EXPECT_EQ(antiFraudService_->GetStoppedSlotId(), VALID_SLOT_ID);
-    EXPECT_EQ(antiFraudService_->GetStoppedIndex(), VALID_INDEX);
+    EXPECT_TRUE(antiFraudService_->ClaimDetectSession(VALID_SLOT_ID, VALID_INDEX));
+    EXPECT_TRUE(antiFraudService_->IsDetecting(VALID_SLOT_ID, VALID_INDEX));
+    auto session = antiFraudService_->GetSession(VALID_SLOT_ID, VALID_INDEX);
+    ASSERT_TRUE(session != nullptr);
+    EXPECT_EQ(session->slotId, VALID_SLOT_ID);
+    EXPECT_EQ(session->index, VALID_INDEX);
+    EXPECT_EQ(session->state, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_DEFAULT));
+
+    /* 检测中时其他通话不能再开始检测 */
+    EXPECT_FALSE(antiFraudService_->ClaimDetectSession(SECOND_SLOT_ID, SECOND_INDEX));
+    antiFraudService_->ReleaseSession(VALID_SLOT_ID, VALID_INDEX);
+    EXPECT_FALSE(antiFraudService_->IsDetecting(VALID_SLOT_ID, VALID_INDEX));
+    EXPECT_TRUE(antiFraudService_->ClaimDetectSession(SECOND_SLOT_ID, SECOND_INDEX));
 }
 
 /* ============================================================
@@ -210,9 +223,133 @@ HWTEST_F(AntiFraudServiceTest, AntiFraudService_StopAntiFraudService_0100, TestS
     int32_t ret = antiFraudService_->StopAntiFraudService(VALID_SLOT_ID, VALID_INDEX);
     /* 测试环境下 dlopen 失败,B18-T 命中 */
     EXPECT_NE(ret, 0);
-    /* B18-T 命中时 stoppedSlotId/Index 不应被设置 */
-    EXPECT_EQ(antiFraudService_->GetStoppedSlotId(), 0);
-    EXPECT_NE(antiFraudService_->GetStoppedIndex(), -1);
+}
+
+/**
+ * @tc.number   AntiFraudService_StopAntiFraudService_0102
+ * @tc.name     Test StopAntiFraudService drops the session of the stopped call only
+ * @tc.desc     Function test
+ */
+HWTEST_F(AntiFraudServiceTest, AntiFraudService_StopAntiFraudService_0102, TestSize.Level1)
+{
+    ASSERT_TRUE(antiFraudService_->ClaimDetectSession(VALID_SLOT_ID, VALID_INDEX));
+    OHOS::AntiFraudService::AntiFraudResultExt resultExt {};
+    resultExt.isXoipFraud = true;
+    ASSERT_TRUE(antiFraudService_->sessionTable_.Update(VALID_SLOT_ID, VALID_INDEX,
+        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK), resultExt, "") != nullptr);
+    /* 有结果后检测仍在进行,停止前其他通话不能开始检测 */
+    EXPECT_FALSE(antiFraudService_->ClaimDetectSession(SECOND_SLOT_ID, SECOND_INDEX));
+
+    antiFraudService_->StopAntiFraudService(SECOND_SLOT_ID, SECOND_INDEX);
+    auto session = antiFraudService_->GetSession(VALID_SLOT_ID, VALID_INDEX);
+    ASSERT_TRUE(session != nullptr);
+    EXPECT_EQ(session->state, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
+    EXPECT_TRUE(session->resultExt.isXoipFraud);
+
+    antiFraudService_->StopAntiFraudService(VALID_SLOT_ID, VALID_INDEX);
+    EXPECT_EQ(antiFraudService_->GetSession(VALID_SLOT_ID, VALID_INDEX), nullptr);
+    EXPECT_TRUE(antiFraudService_->ClaimDetectSession(SECOND_SLOT_ID, SECOND_INDEX));
+}
+
+/**
+ * @tc.number   AntiFraudService_RecordDetectResult_0100
+ * @tc.name     Test RecordDetectResult records the result per call and drops late results of stopped calls
+ * @tc.desc     Function test
+ */
+HWTEST_F(AntiFraudServiceTest, AntiFraudService_RecordDetectResult_0100, TestSize.Level1)
+{
+    OHOS::AntiFraudService::StartDetectionResult detectResult {};
+    detectResult.speechSynthesisResult.result = true;
+    detectResult.voiceDetectionResult.voiceText = "speech text";
+    antiFraudService_->RecordDetectResult(detectResult, "10086", VALID_SLOT_ID, VALID_INDEX);
+    EXPECT_EQ(antiFraudService_->GetSession(VALID_SLOT_ID, VALID_INDEX), nullptr);
+
+    ASSERT_TRUE(antiFraudService_->ClaimDetectSession(VALID_SLOT_ID, VALID_INDEX));
+    antiFraudService_->RecordDetectResult(detectResult, "10086", VALID_SLOT_ID, VALID_INDEX);
+    auto session = antiFraudService_->GetSession(VALID_SLOT_ID, VALID_INDEX);
+    ASSERT_TRUE(session != nullptr);
+    EXPECT_EQ(session->state, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
+    EXPECT_TRUE(session->resultExt.isSpeechSynthesisFraud);
+    EXPECT_EQ(session->detectText, "speech text");
+
+    /* 风险结果不会被之后的非风险结果覆盖,之后的风险结果仍会记录 */
+    OHOS::AntiFraudService::StartDetectionResult lateResult {};
+    antiFraudService_->RecordDetectResult(lateResult, "10086", VALID_SLOT_ID, VALID_INDEX);
+    EXPECT_EQ(antiFraudService_->GetSession(VALID_SLOT_ID, VALID_INDEX), session);
+    OHOS::AntiFraudService::StartDetectionResult xoipResult {};
+    xoipResult.voipCallTransferResult.result = true;
+    antiFraudService_->RecordDetectResult(xoipResult, "10086", VALID_SLOT_ID, VALID_INDEX);
+    session = antiFraudService_->GetSession(VALID_SLOT_ID, VALID_INDEX);
+    ASSERT_TRUE(session != nullptr);
+    EXPECT_TRUE(session->resultExt.isXoipFraud);
+
+    /* 停止后的迟到结果被丢弃 */
+    antiFraudService_->StopAntiFraudService(VALID_SLOT_ID, VALID_INDEX);
+    antiFraudService_->RecordDetectResult(xoipResult, "10086", VALID_SLOT_ID, VALID_INDEX);
+    EXPECT_EQ(antiFraudService_->GetSession(VALID_SLOT_ID, VALID_INDEX), nullptr);
+}
+
+/**
+ * @tc.number   AntiFraudService_SessionTable_Stress_0100
+ * @tc.name     Test concurrent readers always see a consistent session while calls claim, finish and release
+ * @tc.desc     Stress test
+ */
+HWTEST_F(AntiFraudServiceTest, AntiFraudService_SessionTable_Stress_0100, TestSize.Level1)
+{
+    AntiFraudSessionTable table;
+    std::atomic<bool> isStopped(false);
+    std::atomic<int32_t> detectingNum(0);
+    std::atomic<int32_t> errorNum(0);
+    std::vector<std::thread> readers;
+    for (int32_t i = 0; i < STRESS_READER_NUM; i++) {
+        readers.emplace_back([&table, &isStopped, &errorNum]() {
+            while (!isStopped.load()) {
+                for (int32_t index = 0; index < STRESS_WRITER_NUM; index++) {
+                    auto session = table.Find(index % SLOT_NUM, index);
+                    if (session == nullptr) {
+                        continue;
+                    }
+                    bool isRisk = session->state == static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK);
+                    if (session->index != index || isRisk != session->resultExt.isXoipFraud) {
+                        errorNum++;
+                    }
+                }
+                table.HasDetectingSession();
+            }
+        });
+    }
+    std::vector<std::thread> writers;
+    for (int32_t i = 0; i < STRESS_WRITER_NUM; i++) {
+        writers.emplace_back([&table, &detectingNum, &errorNum, i]() {
+            int32_t slotId = i % SLOT_NUM;
+            OHOS::AntiFraudService::AntiFraudResultExt resultExt {};
+            for (int32_t round = 0; round < STRESS_ROUND_NUM; round++) {
+                if (table.Claim(slotId, i)) {
+                    /* 同一时刻只允许一路通话处于检测中 */
+                    if (detectingNum.fetch_add(1) != 0) {
+                        errorNum++;
+                    }
+                    resultExt.isXoipFraud = false;
+                    table.Update(slotId, i, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_STARTED),
+                        resultExt, "");
+                    detectingNum.fetch_sub(1);
+                    resultExt.isXoipFraud = true;
+                    table.Update(slotId, i, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK),
+                        resultExt, "");
+                }
+                table.Release(slotId, i);
+            }
+        });
+    }
+    for (auto &writer : writers) {
+        writer.join();
+    }
+    isStopped.store(true);
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(errorNum.load(), 0);
+    EXPECT_EQ(table.GetSize(), 0u);
 }
 
 /**
@@ -233,8 +370,8 @@ HWTEST_F(AntiFraudServiceTest, AntiFraudService_StopAntiFraudService_0101, TestS
  */
 HWTEST_F(AntiFraudServiceTest, AntiFraudService_AnonymizeText_0100, TestSize.Level1)
 {
-    antiFraudService_->fraudDetectText_ = "test text";
-    int ret = antiFraudService_->AnonymizeText();
+    std::string text = "test text";
+    int ret = antiFraudService_->AnonymizeText(text);
     /* 测试环境下 AnonymizeAdapter dlopen 失败,B21-T 命中 */
     EXPECT_NE(ret, 0);
 }
@@ -246,8 +383,8 @@ HWTEST_F(AntiFraudServiceTest, AntiFraudService_AnonymizeText_0100, TestSize.Lev
  */
 HWTEST_F(AntiFraudServiceTest, AntiFraudService_AnonymizeText_0101, TestSize.Level1)
 {
-    antiFraudService_->fraudDetectText_ = "";
-    int ret = antiFraudService_->AnonymizeText();
+    std::string text = "";
+    int ret = antiFraudService_->AnonymizeText(text);
     EXPECT_NE(ret, 0);
 }
 
@@ -263,7 +400,6 @@ public:
     {
         antiFraudService_ = DelayedSingleton<AntiFraudService>::GetInstance();
         ASSERT_TRUE(antiFraudService_ != nullptr);
-        antiFraudService_->InitParams();
     }
     void TearDown() {}
 
@@ -316,16 +452,159 @@ HWTEST_F(AntiFraudServiceTest, AntiFraudService_AddRuleToConfig_0100, TestSize.L
 /**
  * @tc.number   AntiFraudService_AnonymizeText_0200
  * @tc.name     Test AnonymizeText preserves text on IdentifyAnonymize failure
- * @tc.desc     Exception test (B21-T 副作用: fraudDetectText_ 不应被修改)
+ * @tc.desc     Exception test (B21-T 副作用: 传入的文本不应被修改)
  */
 HWTEST_F(AntiFraudServiceTest, AntiFraudService_AnonymizeText_0200, TestSize.Level1)
 {
-    antiFraudService_->fraudDetectText_ = "test text for identify";
-    int ret = antiFraudService_->AnonymizeText();
+    std::string text = "test text for identify";
+    int ret = antiFraudService_->AnonymizeText(text);
     /* 测试环境下 InitConfig 已失败, B21-T 优先命中 */
     EXPECT_NE(ret, 0);
-    /* fraudDetectText_ 不应被修改 */
-    EXPECT_EQ(antiFraudService_->fraudDetectText_, "test text for identify");
+    /* 传入的文本不应被修改 */
+    EXPECT_EQ(text, "test text for identify");
+}
+
+/**
+ * @tc.number   AntiFraudService_Uploader_0100
+ * @tc.name     Test uploader anonymizes once, batches and retries with back-off
+ * @tc.desc     Function test
+ */
+HWTEST_F(AntiFraudServiceTest, AntiFraudService_Uploader_0100, TestSize.Level1)
+{
+    FakeCallTaskExecutor fake;
+    auto uploader = std::make_shared<AntiFraudUploader>();
+    uploader->queuePath_ = "";
+    uploader->switchFunc_ = []() { return true; };
+    uploader->anonymizeFunc_ = [](std::string &text) {
+        text = "anonymized " + text;
+        return 0;
+    };
+    bool isCloudReachable = false;
+    std::vector<std::string> uploaded;
+    uploader->uploadFunc_ = [&isCloudReachable, &uploaded](const std::string &phoneNum,
+        const OHOS::AntiFraudService::AntiFraudResult &result) {
+        if (!isCloudReachable) {
+            return false;
+        }
+        uploaded.push_back(result.voiceText);
+        return true;
+    };
+    OHOS::AntiFraudService::AntiFraudResult result {};
+    result.voiceText = "first";
+    uploader->Enqueue("10086", result);
+    result.voiceText = "second";
+    uploader->Enqueue("10086", result);
+    EXPECT_EQ(fake.GetPendingCount(), 1u);
+    EXPECT_EQ(uploader->GetPendingCount(), 2u);
+
+    fake.RunPending();
+    EXPECT_TRUE(uploaded.empty());
+    auto timerWheel = DelayedSingleton<CallTimerWheel>::GetInstance();
+    EXPECT_TRUE(timerWheel->IsScheduled(UPLOAD_RETRY_TIMER));
+
+    /* 首次退避到期前不重试 */
+    isCloudReachable = true;
+    fake.AdvanceMs(FIRST_RETRY_DELAY_MS - RETRY_MARGIN_MS);
+    EXPECT_TRUE(uploaded.empty());
+    fake.AdvanceMs(RETRY_MARGIN_MS * 2);
+    EXPECT_FALSE(timerWheel->IsScheduled(UPLOAD_RETRY_TIMER));
+    std::vector<std::string> expected = { "anonymized first", "anonymized second" };
+    EXPECT_EQ(uploaded, expected);
+    EXPECT_EQ(uploader->GetPendingCount(), 0u);
+    EXPECT_EQ(uploader->GetRetryDelayMs(3), THIRD_RETRY_DELAY_MS);
+}
+
+/**
+ * @tc.number   AntiFraudService_Uploader_0200
+ * @tc.name     Test uploader persists only anonymized results without the caller number and restores them
+ * @tc.desc     Function test
+ */
+HWTEST_F(AntiFraudServiceTest, AntiFraudService_Uploader_0200, TestSize.Level1)
+{
+    std::remove(UPLOAD_QUEUE_TEST_PATH);
+    FakeCallTaskExecutor fake;
+    auto uploader = std::make_shared<AntiFraudUploader>();
+    uploader->queuePath_ = UPLOAD_QUEUE_TEST_PATH;
+    uploader->switchFunc_ = []() { return true; };
+    uploader->anonymizeFunc_ = [](std::string &text) { return text == "raw" ? -1 : 0; };
+    uploader->uploadFunc_ = [](const std::string &phoneNum, const OHOS::AntiFraudService::AntiFraudResult &result) {
+        return false;
+    };
+    OHOS::AntiFraudService::AntiFraudResult result {};
+    result.voiceText = "raw";
+    uploader->Enqueue("10086", result);
+    result.voiceText = "kept";
+    uploader->Enqueue("10086", result);
+    ASSERT_EQ(fake.GetPendingCount(), 1u);
+    fake.RunPending();
+    EXPECT_EQ(uploader->GetPendingCount(), 1u);
+
+    auto restored = std::make_shared<AntiFraudUploader>();
+    restored->queuePath_ = UPLOAD_QUEUE_TEST_PATH;
+    restored->LoadQueue();
+    ASSERT_EQ(restored->GetPendingCount(), 1u);
+    EXPECT_EQ(restored->items_.front().result.voiceText, "kept");
+    EXPECT_EQ(restored->items_.front().attempts, 1u);
+    EXPECT_TRUE(restored->items_.front().isAnonymized);
+    /* 落盘队列只保存号码摘要, 不保存原始号码 */
+    std::ifstream file(UPLOAD_QUEUE_TEST_PATH);
+    std::stringstream content;
+    content << file.rdbuf();
+    EXPECT_EQ(content.str().find("10086"), std::string::npos);
+    EXPECT_EQ(restored->items_.front().phoneNum, AntiFraudCloudService::CalculateDigest("10086"));
+
+    restored->switchFunc_ = []() { return false; };
+    restored->Drain();
+    EXPECT_EQ(restored->GetPendingCount(), 0u);
+    std::remove(UPLOAD_QUEUE_TEST_PATH);
+}
+
+/**
+ * @tc.number   AntiFraudService_RecordDetectResult_Upload_0100
+ * @tc.name     Test RecordDetectResult only enqueues the result, anonymizing and uploading run later on the uploader
+ * @tc.desc     Function test
+ */
+HWTEST_F(AntiFraudServiceTest, AntiFraudService_RecordDetectResult_Upload_0100, TestSize.Level1)
+{
+    FakeCallTaskExecutor fake;
+    auto uploader = DelayedSingleton<AntiFraudUploader>::GetInstance();
+    std::string queuePath = uploader->queuePath_;
+    uploader->queuePath_ = "";
+    uploader->switchFunc_ = []() { return true; };
+    int32_t anonymizedNum = 0;
+    uploader->anonymizeFunc_ = [&anonymizedNum](std::string &text) {
+        anonymizedNum++;
+        return 0;
+    };
+    int32_t uploadedNum = 0;
+    uploader->uploadFunc_ = [&uploadedNum](const std::string &phoneNum,
+        const OHOS::AntiFraudService::AntiFraudResult &result) {
+        uploadedNum++;
+        return true;
+    };
+    OHOS::AntiFraudService::StartDetectionResult detectResult {};
+    detectResult.voiceDetectionResult.result = true;
+    detectResult.voiceDetectionResult.voiceText = "fraud text";
+    for (int32_t round = 0; round < UPLOAD_ROUND_NUM; round++) {
+        ASSERT_TRUE(antiFraudService_->ClaimDetectSession(VALID_SLOT_ID, VALID_INDEX));
+        antiFraudService_->RecordDetectResult(detectResult, "10086", VALID_SLOT_ID, VALID_INDEX);
+        antiFraudService_->ReleaseSession(VALID_SLOT_ID, VALID_INDEX);
+    }
+    /* 检测回调返回时尚未脱敏和上传, 只投递了一个上传任务 */
+    EXPECT_EQ(anonymizedNum, 0);
+    EXPECT_EQ(uploadedNum, 0);
+    EXPECT_EQ(uploader->GetPendingCount(), static_cast<size_t>(UPLOAD_ROUND_NUM));
+    EXPECT_EQ(fake.GetPendingCount(), 1u);
+
+    fake.RunPending();
+    EXPECT_EQ(anonymizedNum, UPLOAD_ROUND_NUM);
+    EXPECT_EQ(uploadedNum, UPLOAD_ROUND_NUM);
+    EXPECT_EQ(uploader->GetPendingCount(), 0u);
+    EXPECT_FALSE(uploader->isDrainPosted_);
+    uploader->switchFunc_ = nullptr;
+    uploader->anonymizeFunc_ = nullptr;
+    uploader->uploadFunc_ = nullptr;
+    uploader->queuePath_ = queuePath;
 }
 
 } // namespace Telephony
@@ -1272,7 +1272,8 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudHsdrHelper_0002, TestSize.Level0)
 HWTEST_F(CallManagerGtest, Telephony_AnonymizeAdapter_0100, TestSize.Level0)
 {
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
-    EXPECT_EQ(antiFraudService->AnonymizeText(), 1000);
+    std::string text = "test text";
+    EXPECT_EQ(antiFraudService->AnonymizeText(text), 1000);
 
     auto anonymizeAdapter = DelayedSingleton<AnonymizeAdapter>::GetInstance();
     anonymizeAdapter->ReleaseLibAnonymize();
@@ -1305,17 +1306,24 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraud_0100, TestSize.Level0)
 
     OHOS::AntiFraudService::StartDetectionResult fraudResult;
     std::string phoneNum = "123456";
-    antiFraudService->stoppedSlotId_ = 0;
-    antiFraudService->stoppedIndex_ = 0;
+    antiFraudService->sessionTable_.Clear();
     antiFraudService->RecordDetectResult(fraudResult, phoneNum, 1, 1);
-    EXPECT_EQ(antiFraudService->antiFraudState_, 3);
+    EXPECT_EQ(antiFraudService->GetSession(1, 1), nullptr);
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
     antiFraudService->RecordDetectResult(fraudResult, phoneNum, 0, 1);
-    EXPECT_EQ(antiFraudService->antiFraudState_, 3);
+    ASSERT_TRUE(antiFraudService->GetSession(0, 1) != nullptr);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1)->state, 3);
     fraudResult.voiceDetectionResult.result = true;
+    EXPECT_FALSE(antiFraudService->ClaimDetectSession(1, 0));
+    antiFraudService->ReleaseSession(0, 1);
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(1, 0));
     antiFraudService->RecordDetectResult(fraudResult, phoneNum, 1, 0);
-    EXPECT_EQ(antiFraudService->antiFraudState_, 2);
+    ASSERT_TRUE(antiFraudService->GetSession(1, 0) != nullptr);
+    EXPECT_EQ(antiFraudService->GetSession(1, 0)->state, 2);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1), nullptr);
     antiFraudService->RecordDetectResult(fraudResult, phoneNum, 0, 0);
-    EXPECT_EQ(antiFraudService->stoppedIndex_, -1);
+    EXPECT_EQ(antiFraudService->GetSession(0, 0), nullptr);
+    antiFraudService->sessionTable_.Clear();
 
     OHOS::AntiFraudService::AfsDetectType detectType;
     detectType.type_ = 0;
@@ -1436,26 +1444,26 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_CheckAntiFraudService_0100
 }
  
 /**
- * @tc.number   Telephony_AntiFraudService_StoppedSlotIdIndex_0100
- * @tc.name     Test AntiFraudService GetStoppedSlotId/GetStoppedIndex/SetStoppedSlotId/SetStoppedIndex
+ * @tc.number   Telephony_AntiFraudService_DetectSession_0100
+ * @tc.name     Test AntiFraudService ClaimDetectSession/IsDetecting/GetSession/ReleaseSession
  * @tc.desc     Function test
  */
-HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_StoppedSlotIdIndex_0100, TestSize.Level0)
+HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_DetectSession_0100, TestSize.Level0)
 {
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
-    antiFraudService->SetStoppedSlotId(0);
-    EXPECT_EQ(antiFraudService->GetStoppedSlotId(), 0);
-    antiFraudService->SetStoppedSlotId(1);
-    EXPECT_EQ(antiFraudService->GetStoppedSlotId(), 1);
-    antiFraudService->SetStoppedSlotId(-1);
-    EXPECT_EQ(antiFraudService->GetStoppedSlotId(), -1);
+    antiFraudService->sessionTable_.Clear();
+    EXPECT_FALSE(antiFraudService->ClaimDetectSession(-1, 0));
+    EXPECT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
+    EXPECT_TRUE(antiFraudService->IsDetecting(0, 1));
+    EXPECT_FALSE(antiFraudService->IsDetecting(1, 1));
+    EXPECT_FALSE(antiFraudService->ClaimDetectSession(1, 1));
  
-    antiFraudService->SetStoppedIndex(0);
-    EXPECT_EQ(antiFraudService->GetStoppedIndex(), 0);
-    antiFraudService->SetStoppedIndex(1);
-    EXPECT_EQ(antiFraudService->GetStoppedIndex(), 1);
-    antiFraudService->SetStoppedIndex(-1);
-    EXPECT_EQ(antiFraudService->GetStoppedIndex(), -1);
+    antiFraudService->ReleaseSession(0, 1);
+    EXPECT_FALSE(antiFraudService->IsDetecting(0, 1));
+    EXPECT_EQ(antiFraudService->GetSession(0, 1), nullptr);
+    EXPECT_TRUE(antiFraudService->ClaimDetectSession(1, 1));
+    antiFraudService->ReleaseSession(1, 1);
+    EXPECT_EQ(antiFraudService->sessionTable_.GetSize(), 0u);
 }
  
 /**
@@ -1480,8 +1488,8 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_AddRuleToConfig_0100, Test
     antiFraudService->AddRuleToConfig("BIRTH_CERTIFICATE", config);
     antiFraudService->AddRuleToConfig("SEAFARER_PASSPORT", config);
     antiFraudService->AddRuleToConfig("POLICE_OFFICER_CARD", config);
-    antiFraudService->SetStoppedIndex(-1);
-    EXPECT_EQ(antiFraudService->GetStoppedIndex(), -1);
+    antiFraudService->ReleaseSession(0, 0);
+    EXPECT_EQ(antiFraudService->GetSession(0, 0), nullptr);
 }
  
 /**
@@ -1544,9 +1552,8 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleResLi
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
     auto callStatusManager = std::make_shared<CallStatusManager>();
     antiFraudService->SetCallStatusManager(callStatusManager);
-    antiFraudService->antiFraudState_ = 0;
-    antiFraudService->stoppedSlotId_ = -1;
-    antiFraudService->stoppedIndex_ = -1;
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
  
     auto listener = std::make_shared<AntiFraudService::AntiFraudStartDetectResListenerImpl>("123456", 0, 1);
     OHOS::AntiFraudService::StartDetectionResult detectionResult;
@@ -1555,9 +1562,11 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleResLi
     detectionResult.voipCallTransferResult.result = false;
     OHOS::AntiFraudService::ListenerResult listenerResult = detectionResult;
     listener->HandleResListener(listenerResult);
-    EXPECT_EQ(antiFraudService->antiFraudState_,
+    ASSERT_TRUE(antiFraudService->GetSession(0, 1) != nullptr);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1)->state,
         static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED));
  
+    antiFraudService->ReleaseSession(0, 1);
     antiFraudService->SetCallStatusManager(nullptr);
 }
  
@@ -1572,9 +1581,8 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleAntiF
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
     auto callStatusManager = std::make_shared<CallStatusManager>();
     antiFraudService->SetCallStatusManager(callStatusManager);
-    antiFraudService->antiFraudState_ = 0;
-    antiFraudService->stoppedSlotId_ = -1;
-    antiFraudService->stoppedIndex_ = -1;
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
  
     auto listener = std::make_shared<AntiFraudService::AntiFraudStartDetectResListenerImpl>("123456", 0, 1);
     OHOS::AntiFraudService::StartDetectionResult detectionResult;
@@ -1582,9 +1590,10 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleAntiF
     detectionResult.speechSynthesisResult.result = false;
     detectionResult.voipCallTransferResult.result = false;
     listener->HandleAntiFraudStartDetectRes(detectionResult);
-    EXPECT_EQ(antiFraudService->antiFraudState_,
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
+    ASSERT_TRUE(antiFraudService->GetSession(0, 1) != nullptr);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1)->state, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
  
+    antiFraudService->ReleaseSession(0, 1);
     antiFraudService->SetCallStatusManager(nullptr);
 }
  
@@ -1599,9 +1608,8 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleAntiF
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
     auto callStatusManager = std::make_shared<CallStatusManager>();
     antiFraudService->SetCallStatusManager(callStatusManager);
-    antiFraudService->antiFraudState_ = 0;
-    antiFraudService->stoppedSlotId_ = -1;
-    antiFraudService->stoppedIndex_ = -1;
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
  
     auto listener = std::make_shared<AntiFraudService::AntiFraudStartDetectResListenerImpl>("123456", 0, 1);
     OHOS::AntiFraudService::StartDetectionResult detectionResult;
@@ -1609,9 +1617,11 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleAntiF
     detectionResult.speechSynthesisResult.result = false;
     detectionResult.voipCallTransferResult.result = false;
     listener->HandleAntiFraudStartDetectRes(detectionResult);
-    EXPECT_EQ(antiFraudService->antiFraudState_,
+    ASSERT_TRUE(antiFraudService->GetSession(0, 1) != nullptr);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1)->state,
         static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED));
  
+    antiFraudService->ReleaseSession(0, 1);
     antiFraudService->SetCallStatusManager(nullptr);
 }
  
@@ -1626,9 +1636,8 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleAntiF
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
     auto callStatusManager = std::make_shared<CallStatusManager>();
     antiFraudService->SetCallStatusManager(callStatusManager);
-    antiFraudService->antiFraudState_ = 0;
-    antiFraudService->stoppedSlotId_ = -1;
-    antiFraudService->stoppedIndex_ = -1;
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
  
     auto listener = std::make_shared<AntiFraudService::AntiFraudStartDetectResListenerImpl>("123456", 0, 1);
     OHOS::AntiFraudService::StartDetectionResult detectionResult;
@@ -1637,10 +1646,11 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleAntiF
     detectionResult.speechSynthesisResult.pvalue = 0.95f;
     detectionResult.voipCallTransferResult.result = false;
     listener->HandleAntiFraudStartDetectRes(detectionResult);
-    EXPECT_EQ(antiFraudService->antiFraudState_,
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
-    EXPECT_TRUE(antiFraudService->antiFraudResultExt_.isSpeechSynthesisFraud);
+    ASSERT_TRUE(antiFraudService->GetSession(0, 1) != nullptr);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1)->state, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
+    EXPECT_TRUE(antiFraudService->GetSession(0, 1)->resultExt.isSpeechSynthesisFraud);
  
+    antiFraudService->ReleaseSession(0, 1);
     antiFraudService->SetCallStatusManager(nullptr);
 }
  
@@ -1655,9 +1665,8 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleAntiF
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
     auto callStatusManager = std::make_shared<CallStatusManager>();
     antiFraudService->SetCallStatusManager(callStatusManager);
-    antiFraudService->antiFraudState_ = 0;
-    antiFraudService->stoppedSlotId_ = -1;
-    antiFraudService->stoppedIndex_ = -1;
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
  
     auto listener = std::make_shared<AntiFraudService::AntiFraudStartDetectResListenerImpl>("123456", 0, 1);
     OHOS::AntiFraudService::StartDetectionResult detectionResult;
@@ -1665,10 +1674,11 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleAntiF
     detectionResult.speechSynthesisResult.result = false;
     detectionResult.voipCallTransferResult.result = true;
     listener->HandleAntiFraudStartDetectRes(detectionResult);
-    EXPECT_EQ(antiFraudService->antiFraudState_,
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
-    EXPECT_TRUE(antiFraudService->antiFraudResultExt_.isXoipFraud);
+    ASSERT_TRUE(antiFraudService->GetSession(0, 1) != nullptr);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1)->state, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
+    EXPECT_TRUE(antiFraudService->GetSession(0, 1)->resultExt.isXoipFraud);
  
+    antiFraudService->ReleaseSession(0, 1);
     antiFraudService->SetCallStatusManager(nullptr);
 }
  
@@ -1681,9 +1691,9 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleAntiF
     TestSize.Level0)
 {
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
-    antiFraudService->stoppedSlotId_ = 0;
-    antiFraudService->stoppedIndex_ = 1;
-    antiFraudService->antiFraudState_ = 0;
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
+    antiFraudService->StopAntiFraudService(0, 1);
  
     auto listener = std::make_shared<AntiFraudService::AntiFraudStartDetectResListenerImpl>("123456", 0, 1);
     OHOS::AntiFraudService::StartDetectionResult detectionResult;
@@ -1691,8 +1701,7 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudStartDetectResListener_HandleAntiF
     detectionResult.speechSynthesisResult.result = false;
     detectionResult.voipCallTransferResult.result = false;
     listener->HandleAntiFraudStartDetectRes(detectionResult);
-    EXPECT_EQ(antiFraudService->stoppedSlotId_, -1);
-    EXPECT_EQ(antiFraudService->stoppedIndex_, -1);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1), nullptr);
 }
  
 /**
@@ -1705,9 +1714,8 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_RecordDetectResult_0200, T
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
     auto callStatusManager = std::make_shared<CallStatusManager>();
     antiFraudService->SetCallStatusManager(callStatusManager);
-    antiFraudService->antiFraudState_ = 0;
-    antiFraudService->stoppedSlotId_ = -1;
-    antiFraudService->stoppedIndex_ = -1;
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
  
     OHOS::AntiFraudService::StartDetectionResult fraudResult;
     fraudResult.voiceDetectionResult.result = true;
@@ -1716,10 +1724,11 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_RecordDetectResult_0200, T
     fraudResult.voipCallTransferResult.result = false;
     std::string phoneNum = "123456";
     antiFraudService->RecordDetectResult(fraudResult, phoneNum, 0, 1);
-    EXPECT_EQ(antiFraudService->antiFraudState_,
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
-    EXPECT_EQ(antiFraudService->fraudDetectText_, "hello this is a test voice text");
+    ASSERT_TRUE(antiFraudService->GetSession(0, 1) != nullptr);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1)->state, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
+    EXPECT_EQ(antiFraudService->GetSession(0, 1)->detectText, "hello this is a test voice text");
  
+    antiFraudService->ReleaseSession(0, 1);
     antiFraudService->SetCallStatusManager(nullptr);
 }
  
@@ -1731,7 +1740,11 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_RecordDetectResult_0200, T
 HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_StartAntiFraudService_0200, TestSize.Level0)
 {
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
-    antiFraudService->antiFraudState_ = static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK);
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
+    OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt {};
+    antiFraudService->sessionTable_.Update(0, 1, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK),
+        antiFraudResultExt, "");
     OHOS::AntiFraudService::AfsDetectType detectType;
     detectType.type_ = 0;
     detectType.isFirstTime_ = true;
@@ -1739,7 +1752,8 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_StartAntiFraudService_0200
     detectType.voiceType_ = 0;
     int32_t ret = antiFraudService->StartAntiFraudService("123456", 0, 1, detectType);
     EXPECT_NE(ret, 0);
-    antiFraudService->antiFraudState_ = 0;
+    EXPECT_FALSE(antiFraudService->IsDetecting(0, 1));
+    antiFraudService->ReleaseSession(0, 1);
 }
  
 /**
@@ -1750,8 +1764,11 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_StartAntiFraudService_0200
 HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_StartAntiFraudService_0300, TestSize.Level0)
 {
     auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
-    antiFraudService->antiFraudState_ =
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED);
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
+    OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt {};
+    antiFraudService->sessionTable_.Update(0, 1,
+        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED), antiFraudResultExt, "");
     OHOS::AntiFraudService::AfsDetectType detectType;
     detectType.type_ = 0;
     detectType.isFirstTime_ = true;
@@ -1759,68 +1776,101 @@ HWTEST_F(CallManagerGtest, Telephony_AntiFraudService_StartAntiFraudService_0300
     detectType.voiceType_ = 0;
     int32_t ret = antiFraudService->StartAntiFraudService("123456", 0, 1, detectType);
     EXPECT_NE(ret, 0);
-    antiFraudService->antiFraudState_ = 0;
+    EXPECT_FALSE(antiFraudService->IsDetecting(0, 1));
+    antiFraudService->ReleaseSession(0, 1);
 }
  
 /**
- * @tc.number   Telephony_CallStatusManager_AntiFraudSlotIdIndex_0100
- * @tc.name     Test CallStatusManager GetAntiFraudSlotId/GetAntiFraudIndex/SetAntiFraudSlotId/SetAntiFraudIndex
+ * @tc.number   Telephony_CallStatusManager_AntiFraudSession_0100
+ * @tc.name     Test CallStatusManager keeps the anti-fraud session claimed after a result until the call stops it
  * @tc.desc     Function test
  */
-HWTEST_F(CallManagerGtest, Telephony_CallStatusManager_AntiFraudSlotIdIndex_0100, TestSize.Level0)
+HWTEST_F(CallManagerGtest, Telephony_CallStatusManager_AntiFraudSession_0100, TestSize.Level0)
 {
-    auto callStatusManager = std::make_shared<CallStatusManager>();
-    EXPECT_EQ(callStatusManager->GetAntiFraudSlotId(), -1);
-    EXPECT_EQ(callStatusManager->GetAntiFraudIndex(), -1);
+    auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
+    OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt {};
+    antiFraudResultExt.isXoipFraud = true;
+    antiFraudService->sessionTable_.Update(0, 1, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK),
+        antiFraudResultExt, "");
+    EXPECT_FALSE(antiFraudService->IsDetecting(0, 1));
+    EXPECT_FALSE(antiFraudService->ClaimDetectSession(1, 1));
+ 
+    OHOS::AntiFraudService::AntiFraudResultExt notRiskResultExt {};
+    EXPECT_EQ(antiFraudService->sessionTable_.Update(0, 1,
+        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED), notRiskResultExt, ""), nullptr);
+    ASSERT_TRUE(antiFraudService->GetSession(0, 1) != nullptr);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1)->state, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
+    EXPECT_TRUE(antiFraudService->GetSession(0, 1)->resultExt.isXoipFraud);
+ 
+    antiFraudService->ReleaseSession(0, 1);
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(1, 1));
+    EXPECT_TRUE(antiFraudService->IsDetecting(1, 1));
+    EXPECT_FALSE(antiFraudService->GetSession(1, 1)->resultExt.isXoipFraud);
+    antiFraudService->sessionTable_.Clear();
+}
  
-    callStatusManager->SetAntiFraudSlotId(0);
-    EXPECT_EQ(callStatusManager->GetAntiFraudSlotId(), 0);
-    callStatusManager->SetAntiFraudIndex(1);
-    EXPECT_EQ(callStatusManager->GetAntiFraudIndex(), 1);
+/**
+ * @tc.number   Telephony_CallStatusManager_StopAntiFraudDetect_0100
+ * @tc.name     Test StopAntiFraudDetect stops the detector after a result and keeps the risk state of the call
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallManagerGtest, Telephony_CallStatusManager_StopAntiFraudDetect_0100, TestSize.Level0)
+{
+    auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
+    antiFraudService->sessionTable_.Clear();
+    std::shared_ptr<CallStatusManager> manager = std::make_shared<CallStatusManager>();
+    CallDetailInfo info;
+    info.state = TelCallState::CALL_STATUS_ACTIVE;
+    info.callType = CallType::TYPE_IMS;
+    info.index = 1;
+    sptr<CallBase> call = manager->CreateNewCall(info, CallDirection::CALL_DIRECTION_IN);
+    ASSERT_TRUE(call != nullptr);
+    call->SetSlotId(0);
+    call->SetCallIndex(1);
+    call->SetAntiFraudState(static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 1));
+    OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt {};
+    antiFraudService->sessionTable_.Update(0, 1, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK),
+        antiFraudResultExt, "");
  
-    callStatusManager->SetAntiFraudSlotId(-1);
-    callStatusManager->SetAntiFraudIndex(-1);
-    EXPECT_EQ(callStatusManager->GetAntiFraudSlotId(), -1);
-    EXPECT_EQ(callStatusManager->GetAntiFraudIndex(), -1);
+    manager->StopAntiFraudDetect(call, info);
+    EXPECT_EQ(antiFraudService->GetSession(0, 1), nullptr);
+    EXPECT_EQ(call->GetAntiFraudState(), static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
+    EXPECT_TRUE(antiFraudService->ClaimDetectSession(1, 1));
+    antiFraudService->sessionTable_.Clear();
 }
  
 /**
  * @tc.number   Telephony_CallStatusManager_TriggerAntiFraud_0100
- * @tc.name     Test CallStatusManager TriggerAntiFraud with invalid slotId
+ * @tc.name     Test CallStatusManager TriggerAntiFraud updates the call on the given slot and index only
  * @tc.desc     Function test
  */
 HWTEST_F(CallManagerGtest, Telephony_CallStatusManager_TriggerAntiFraud_0100, TestSize.Level0)
 {
     auto callStatusManager = std::make_shared<CallStatusManager>();
-    callStatusManager->SetAntiFraudSlotId(-1);
-    OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt;
+    CallDetailInfo info;
+    info.index = 1;
+    info.antiFraudState = 0;
+    callStatusManager->callDetailsInfo_[0].callVec.push_back(info);
+    OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt {};
     callStatusManager->TriggerAntiFraud(
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_STARTED), antiFraudResultExt);
-    EXPECT_EQ(callStatusManager->GetAntiFraudSlotId(), -1);
-    callStatusManager->SetAntiFraudSlotId(2);
+        -1, 1, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_STARTED), antiFraudResultExt);
+    EXPECT_EQ(callStatusManager->callDetailsInfo_[0].callVec[0].antiFraudState, 0);
     callStatusManager->TriggerAntiFraud(
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_STARTED), antiFraudResultExt);
-    EXPECT_EQ(callStatusManager->GetAntiFraudSlotId(), 2);
-    callStatusManager->SetAntiFraudSlotId(0);
-    callStatusManager->SetAntiFraudIndex(1);
+        2, 1, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_STARTED), antiFraudResultExt);
+    EXPECT_EQ(callStatusManager->callDetailsInfo_[0].callVec[0].antiFraudState, 0);
     callStatusManager->TriggerAntiFraud(
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK), antiFraudResultExt);
-    EXPECT_EQ(callStatusManager->GetAntiFraudSlotId(), -1);
-    EXPECT_EQ(callStatusManager->GetAntiFraudIndex(), -1);
-    callStatusManager->SetAntiFraudSlotId(0);
-    callStatusManager->SetAntiFraudIndex(1);
+        0, 1, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK), antiFraudResultExt);
+    EXPECT_EQ(callStatusManager->callDetailsInfo_[0].callVec[0].antiFraudState,
+        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
     callStatusManager->TriggerAntiFraud(
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED), antiFraudResultExt);
-    EXPECT_EQ(callStatusManager->GetAntiFraudSlotId(), -1);
-    EXPECT_EQ(callStatusManager->GetAntiFraudIndex(), -1);
-    callStatusManager->SetAntiFraudSlotId(0);
-    callStatusManager->SetAntiFraudIndex(1);
+        1, 1, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED), antiFraudResultExt);
     callStatusManager->TriggerAntiFraud(
-        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_DEFAULT), antiFraudResultExt);
-    EXPECT_EQ(callStatusManager->GetAntiFraudSlotId(), 0);
-    EXPECT_EQ(callStatusManager->GetAntiFraudIndex(), 1);
-    callStatusManager->SetAntiFraudSlotId(-1);
-    callStatusManager->SetAntiFraudIndex(-1);
+        0, 0, static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED), antiFraudResultExt);
+    EXPECT_EQ(callStatusManager->callDetailsInfo_[0].callVec[0].antiFraudState,
+        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK));
 }
  
 /**
@@ -96,12 +96,29 @@
 #include "fold_status_manager.h"
 #include "audio_control_manager.h"
 #include "call_state_processor.h"
+#include "call_timer_wheel.h"
 
 namespace OHOS {
 namespace Telephony {
 using namespace testing::ext;
 const int PERMS_NUM = 6;
 
+class FakeNumberIdentityExtension : public MockRemoteObject {
+public:
+    FakeNumberIdentityExtension() : MockRemoteObject(0) {}
+
+    int SendRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        notifyCount_++;
+        reply.WriteInt32(0);
+        return 0;
+    }
+
+    int32_t connectCount_ = 0;
+    int32_t disconnectCount_ = 0;
+    int32_t notifyCount_ = 0;
+};
+
 class SpecialBranch0Test : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -227,6 +244,86 @@ HWTEST_F(SpecialBranch0Test, Telephony_NumberIdentityConnection_002, TestSize.Le
     ASSERT_TRUE(connection != nullptr);
 }
 
+/**
+ * @tc.number   Telephony_NumberIdentityServiceHelper_004
+ * @tc.name     test number mark updates are coalesced and reuse the idle connection
+ * @tc.desc     Function test
+ */
+HWTEST_F(SpecialBranch0Test, Telephony_NumberIdentityServiceHelper_004, TestSize.Level0)
+{
+    auto &help = DelayedRefSingleton<NumberIdentityServiceHelper>::GetInstance();
+    auto timerWheel = DelayedSingleton<CallTimerWheel>::GetInstance();
+    sptr<FakeNumberIdentityExtension> extension = new FakeNumberIdentityExtension();
+    help.abilityConnector_ = [&extension](const sptr<NumberIdentityConnection> &connection) {
+        extension->connectCount_++;
+        connection->remoteObject_ = extension;
+        return 0;
+    };
+    help.abilityDisconnector_ = [&extension](const sptr<NumberIdentityConnection> &connection) {
+        extension->disconnectCount_++;
+        return 0;
+    };
+    help.connection_ = nullptr;
+    help.working_ = false;
+    help.pendingUpdate_ = false;
+    help.notifyRetryCount_ = 0;
+    help.NotifyNumberMarkDataUpdate();
+    help.NotifyNumberMarkDataUpdate();
+    help.NotifyNumberMarkDataUpdate();
+    EXPECT_TRUE(timerWheel->IsScheduled("number_mark_notify"));
+    EXPECT_EQ(extension->connectCount_, 0);
+    timerWheel->Cancel("number_mark_notify");
+    help.FlushNotify();
+    EXPECT_EQ(extension->connectCount_, 1);
+    EXPECT_TRUE(help.working_);
+    help.NotifyNumberMarkDataUpdate();
+    EXPECT_FALSE(timerWheel->IsScheduled("number_mark_notify"));
+    help.OnNotifyConnected(extension);
+    EXPECT_EQ(extension->notifyCount_, 1);
+    EXPECT_TRUE(timerWheel->IsScheduled("number_mark_notify"));
+    timerWheel->Cancel("number_mark_notify");
+    help.FlushNotify();
+    EXPECT_EQ(extension->connectCount_, 1);
+    EXPECT_EQ(extension->notifyCount_, 2);
+    EXPECT_FALSE(help.working_);
+    EXPECT_TRUE(timerWheel->IsScheduled("number_mark_connection_idle"));
+    timerWheel->Cancel("number_mark_connection_idle");
+    help.OnConnectionIdle();
+    EXPECT_TRUE(help.connection_ == nullptr);
+    EXPECT_EQ(extension->disconnectCount_, 1);
+
+    /* 通知超时后断开连接, 并在新连接上重发该通知 */
+    help.NotifyNumberMarkDataUpdate();
+    timerWheel->Cancel("number_mark_notify");
+    help.FlushNotify();
+    EXPECT_EQ(extension->connectCount_, 2);
+    EXPECT_TRUE(help.working_);
+    EXPECT_FALSE(help.pendingUpdate_);
+    timerWheel->Cancel("number_mark_notify_timeout");
+    help.OnNotifyTimeout();
+    EXPECT_FALSE(help.working_);
+    EXPECT_TRUE(help.pendingUpdate_);
+    EXPECT_EQ(extension->disconnectCount_, 2);
+    EXPECT_TRUE(timerWheel->IsScheduled("number_mark_notify"));
+    EXPECT_EQ(help.notifyRetryCount_, 1);
+
+    /* 重发次数达到上限后丢弃该通知, 不再无限重发 */
+    for (int32_t retry = 1; retry <= 3; retry++) {
+        timerWheel->Cancel("number_mark_notify");
+        help.FlushNotify();
+        EXPECT_TRUE(help.working_);
+        timerWheel->Cancel("number_mark_notify_timeout");
+        help.OnNotifyTimeout();
+    }
+    EXPECT_EQ(extension->connectCount_, 5);
+    EXPECT_FALSE(help.pendingUpdate_);
+    EXPECT_FALSE(timerWheel->IsScheduled("number_mark_notify"));
+    EXPECT_EQ(help.notifyRetryCount_, 0);
+    help.pendingUpdate_ = false;
+    help.abilityConnector_ = nullptr;
+    help.abilityDisconnector_ = nullptr;
+}
+
 /**
  * @tc.number   Telephony_CallManagerHisysevent_001
  * @tc.name     test branch
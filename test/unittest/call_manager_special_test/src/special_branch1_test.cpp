@@ -29,7 +29,9 @@
 #include "call_connect_ability.h"
 #include "call_control_manager.h"
 #include "call_manager_client.h"
+#include "call_manager_dump_helper.h"
 #include "call_manager_hisysevent.h"
+#include "call_manager_metrics.h"
 #include "call_number_utils.h"
 #include "call_policy.h"
 #include "call_records_manager.h"
@@ -330,6 +332,42 @@ HWTEST_F(SpecialBranch1Test, CallManagerService_NormalFuncTest, TestSize.Level0)
     EXPECT_EQ(callManagerService->GetStartServiceSpent(), "123");
 }
 
+/**
+ * @tc.number   Telephony_CallManagerMetrics_001
+ * @tc.name     test metrics registry and dump sub-commands
+ * @tc.desc     Function test
+ */
+HWTEST_F(SpecialBranch1Test, Telephony_CallManagerMetrics_001, TestSize.Level0)
+{
+    CallManagerMetrics &metrics = CallManagerMetrics::GetInstance();
+    metrics.Reset();
+    metrics.Increase(MetricCounter::IPC_REQUEST);
+    metrics.Increase(MetricCounter::IPC_REQUEST, 2);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::IPC_REQUEST), 3);
+    metrics.GaugeIncrease(MetricGauge::REPORT_QUEUE_DEPTH);
+    metrics.GaugeIncrease(MetricGauge::REPORT_QUEUE_DEPTH);
+    metrics.GaugeDecrease(MetricGauge::REPORT_QUEUE_DEPTH);
+    EXPECT_EQ(metrics.GetGauge(MetricGauge::REPORT_QUEUE_DEPTH), 1);
+    metrics.Record(MetricHistogram::IPC_LATENCY, 50);
+    metrics.Record(MetricHistogram::IPC_LATENCY, 1000000);
+    {
+        CallManagerMetricsTimer timer(MetricHistogram::IPC_LATENCY);
+    }
+    EXPECT_EQ(metrics.GetHistogramCount(MetricHistogram::IPC_LATENCY), 3);
+
+    CallManagerDumpHelper dumpHelper;
+    std::string result;
+    EXPECT_TRUE(dumpHelper.Dump({ "-metrics" }, result));
+    EXPECT_NE(result.find("ipc_request"), std::string::npos);
+    EXPECT_TRUE(dumpHelper.Dump({ "-calls" }, result));
+    EXPECT_NE(result.find("calls"), std::string::npos);
+    EXPECT_TRUE(dumpHelper.Dump({ "-reset" }, result));
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::IPC_REQUEST), 0);
+    EXPECT_EQ(metrics.GetHistogramCount(MetricHistogram::IPC_LATENCY), 0);
+    EXPECT_EQ(metrics.GetGauge(MetricGauge::REPORT_QUEUE_DEPTH), 1);
+    metrics.GaugeDecrease(MetricGauge::REPORT_QUEUE_DEPTH);
+}
+
 /**
  * @tc.number   Telephony_SatelliteCall_001
  * @tc.name     test branch
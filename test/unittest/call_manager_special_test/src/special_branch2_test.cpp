@@ -48,6 +48,9 @@
 #include "gtest/gtest.h"
 #include "i_voip_call_manager_service.h"
 #include "ims_call.h"
+#include "call_earthquake_alarm_locator.h"
+#include "call_manager_metrics.h"
+#include "call_timer_wheel.h"
 #include "ims_conference.h"
 #include "incoming_call_notification.h"
 #include "missed_call_notification.h"
@@ -368,6 +371,56 @@ HWTEST_F(SpecialBranch2Test, Telephony_MyLocationEngine_006, TestSize.Level0)
     ASSERT_TRUE(myLocationEngine != nullptr);
 }
 
+/**
+ * @tc.number   Telephony_MyLocationEngine_007
+ * @tc.name     test ecc service prepared at dial is bound to the ecc call and measured on connect
+ * @tc.desc     Function test
+ */
+HWTEST_F(SpecialBranch2Test, Telephony_MyLocationEngine_007, TestSize.Level0)
+{
+    EmergencyCallConnectCallback::isStartEccService = false;
+    EmergencyCallConnectCallback::isEccServicePrepared = false;
+    EmergencyCallConnectCallback::connectCallbackEcc = nullptr;
+    MyLocationEngine::eccSwitchState_ = MyLocationEngine::ECC_SWITCH_OFF;
+    auto dialBegin = std::chrono::steady_clock::now();
+    MyLocationEngine::PrepareEccService(0, "112", dialBegin);
+    EXPECT_FALSE(EmergencyCallConnectCallback::isStartEccService);
+    MyLocationEngine::eccSwitchState_ = MyLocationEngine::ECC_SWITCH_ON;
+    /* 拨号失败时断开提前连接的 ecc 服务 */
+    MyLocationEngine::PrepareEccService(0, "112", dialBegin);
+    EXPECT_TRUE(EmergencyCallConnectCallback::isEccServicePrepared);
+    MyLocationEngine::CancelPreparedEccService();
+    EXPECT_FALSE(EmergencyCallConnectCallback::isEccServicePrepared);
+    EXPECT_FALSE(EmergencyCallConnectCallback::isStartEccService);
+    EXPECT_FALSE(DelayedSingleton<CallTimerWheel>::GetInstance()->IsScheduled("ecc_service_prepare_expire"));
+    MyLocationEngine::CancelPreparedEccService();
+    /* 连接耗时从拨号请求开始计算 */
+    MyLocationEngine::PrepareEccService(0, "112", dialBegin);
+    EXPECT_TRUE(EmergencyCallConnectCallback::isEccServicePrepared);
+    EXPECT_TRUE(EmergencyCallConnectCallback::eccConnectBegin == dialBegin);
+    EXPECT_TRUE(DelayedSingleton<CallTimerWheel>::GetInstance()->IsScheduled("ecc_service_prepare_expire"));
+    ASSERT_TRUE(EmergencyCallConnectCallback::connectCallbackEcc != nullptr);
+    DialParaInfo info;
+    info.isEcc = true;
+    AppExecFwk::PacMap extras;
+    sptr<CallBase> call = (std::make_unique<IMSCall>(info, extras)).release();
+    call->callId_ = 5;
+    CallDetailInfo detailInfo;
+    MyLocationEngine::StartEccService(call, detailInfo);
+    EXPECT_FALSE(EmergencyCallConnectCallback::isEccServicePrepared);
+    EXPECT_FALSE(DelayedSingleton<CallTimerWheel>::GetInstance()->IsScheduled("ecc_service_prepare_expire"));
+    EXPECT_EQ(EmergencyCallConnectCallback::nowCallId, 5);
+    auto &metrics = CallManagerMetrics::GetInstance();
+    uint64_t latencyCount = metrics.GetHistogramCount(MetricHistogram::ECC_SERVICE_CONNECT_LATENCY);
+    AppExecFwk::ElementName element;
+    EmergencyCallConnectCallback::connectCallbackEcc->OnAbilityConnectDone(element, nullptr, 0);
+    EmergencyCallConnectCallback::connectCallbackEcc->OnAbilityConnectDone(element, nullptr, 0);
+    EXPECT_EQ(metrics.GetHistogramCount(MetricHistogram::ECC_SERVICE_CONNECT_LATENCY), latencyCount + 1);
+    MyLocationEngine::StopEccService(5);
+    EXPECT_FALSE(EmergencyCallConnectCallback::isStartEccService);
+    MyLocationEngine::eccSwitchState_ = MyLocationEngine::ECC_SWITCH_UNKNOWN;
+}
+
 /**
  * @tc.number   Telephony_NetCallBase_001
  * @tc.name     test branch
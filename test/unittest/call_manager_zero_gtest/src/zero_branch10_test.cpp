@@ -35,7 +35,9 @@
 #include "token_setproc.h"
 #include "call_state_report_proxy.h"
 #include "distributed_call_manager.h"
+#include "fake_call_task_executor.h"
 #include "call_manager_client.h"
+#include "call_manager_metrics.h"
 #include "call_manager_service_proxy.h"
 #include "call_manager_proxy.h"
 #include "call_manager_service.h"
@@ -44,6 +46,7 @@ namespace OHOS::Telephony {
 using namespace testing::ext;
 constexpr int WAIT_TIME = 3;
 constexpr int32_t CRS_TYPE = 2;
+constexpr int32_t SETTLE_WINDOW_MS = 10000;
 class ZeroBranch10Test : public testing::Test {
 public:
     void SetUp();
@@ -53,7 +56,12 @@ public:
 };
 void ZeroBranch10Test::SetUp() {}
 
-void ZeroBranch10Test::TearDown() {}
+void ZeroBranch10Test::TearDown()
+{
+    // 丢弃用例遗留的稳定窗口上报, 避免延迟任务在后续用例中触发
+    auto audioDeviceManager = DelayedSingleton<AudioDeviceManager>::GetInstance();
+    audioDeviceManager->SetAudioDeviceReportSettleWindow(0);
+}
 
 void ZeroBranch10Test::SetUpTestCase()
 {
@@ -468,6 +476,7 @@ HWTEST_F(ZeroBranch10Test, Telephony_AudioDeviceManager_001, TestSize.Level0)
     device.deviceType = AudioDeviceType::DEVICE_BLUETOOTH_SCO;
     audioDeviceManager->info_.audioDeviceList.clear();
     audioDeviceManager->info_.audioDeviceList.push_back(device);
+    audioDeviceManager->deviceRegistry_.Rebuild();
     audioDeviceManager->audioDeviceType_ = AudioDeviceType::DEVICE_BLUETOOTH_SCO;
     audioDeviceManager->ResetNearlinkAudioDevicesList();
 #ifdef SUPPORT_HEARING_AID
@@ -475,6 +484,7 @@ HWTEST_F(ZeroBranch10Test, Telephony_AudioDeviceManager_001, TestSize.Level0)
 #endif
     device.deviceType = AudioDeviceType::DEVICE_NEARLINK;
     audioDeviceManager->info_.audioDeviceList.push_back(device);
+    audioDeviceManager->deviceRegistry_.Rebuild();
     audioDeviceManager->audioDeviceType_ = AudioDeviceType::DEVICE_NEARLINK;
     audioDeviceManager->ResetNearlinkAudioDevicesList();
     EXPECT_EQ(audioDeviceManager->info_.audioDeviceList.size(), 1);
@@ -482,6 +492,7 @@ HWTEST_F(ZeroBranch10Test, Telephony_AudioDeviceManager_001, TestSize.Level0)
     audioDeviceManager->ReportAudioDeviceChange(device);
     device.deviceType = AudioDeviceType::DEVICE_BLUETOOTH_HEARING_AID;
     audioDeviceManager->info_.audioDeviceList.push_back(device);
+    audioDeviceManager->deviceRegistry_.Rebuild();
     audioDeviceManager->audioDeviceType_ = AudioDeviceType::DEVICE_BLUETOOTH_HEARING_AID;
     audioDeviceManager->ResetBtHearingAidDeviceList();
     EXPECT_EQ(audioDeviceManager->info_.audioDeviceList.size(), 1);
@@ -535,6 +546,7 @@ HWTEST_F(ZeroBranch10Test, Telephony_AudioDeviceManager_002, TestSize.Level0)
     };
     audioDeviceManager->info_.audioDeviceList.clear();
     audioDeviceManager->info_.audioDeviceList.push_back(deviceHearingAid);
+    audioDeviceManager->deviceRegistry_.Rebuild();
     audioDeviceManager->UpdateBluetoothDeviceName("addr", "nameReplace");
     EXPECT_EQ(audioDeviceManager->info_.audioDeviceList.size(), 1);
     EXPECT_EQ(std::string(audioDeviceManager->info_.audioDeviceList.front().deviceName), "nameReplace");
@@ -555,6 +567,7 @@ HWTEST_F(ZeroBranch10Test, Telephony_AudioDeviceManager_003, TestSize.Level0)
     };
     audioDeviceManager->info_.audioDeviceList.clear();
     audioDeviceManager->info_.audioDeviceList.push_back(deviceNearlink);
+    audioDeviceManager->deviceRegistry_.Rebuild();
     audioDeviceManager->UpdateNearlinkDeviceName("addr", "nameReplace");
     EXPECT_EQ(audioDeviceManager->info_.audioDeviceList.size(), 1);
 
@@ -567,6 +580,158 @@ HWTEST_F(ZeroBranch10Test, Telephony_AudioDeviceManager_003, TestSize.Level0)
     EXPECT_NE(std::string(audioDeviceManager->info_.audioDeviceList.front().deviceName), deviceLongName);
 }
 
+/**
+ * @tc.number   Telephony_AudioDeviceManager_004
+ * @tc.name     test AudioDeviceManager device registry and batch report
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch10Test, Telephony_AudioDeviceManager_004, TestSize.Level0)
+{
+    auto audioDeviceManager = DelayedSingleton<AudioDeviceManager>::GetInstance();
+    audioDeviceManager->info_.audioDeviceList.clear();
+    audioDeviceManager->deviceRegistry_.Rebuild();
+    uint64_t generation = audioDeviceManager->GetAudioDeviceGeneration();
+    {
+        AudioDeviceBatch batch;
+        audioDeviceManager->AddAudioDeviceList("addr1", AudioDeviceType::DEVICE_BLUETOOTH_SCO, "name1");
+        audioDeviceManager->AddAudioDeviceList("addr2", AudioDeviceType::DEVICE_BLUETOOTH_SCO, "name2");
+        audioDeviceManager->AddAudioDeviceList("addr2", AudioDeviceType::DEVICE_BLUETOOTH_SCO, "name2");
+        audioDeviceManager->RemoveAudioDeviceList("addr2", AudioDeviceType::DEVICE_BLUETOOTH_SCO);
+        EXPECT_EQ(audioDeviceManager->deviceBatchDepth_, 1);
+        EXPECT_TRUE(audioDeviceManager->hasPendingDeviceReport_);
+    }
+    /* 批处理结束后只上报一次 */
+    EXPECT_FALSE(audioDeviceManager->hasPendingDeviceReport_);
+    EXPECT_GT(audioDeviceManager->GetAudioDeviceGeneration(), generation);
+    EXPECT_EQ(audioDeviceManager->info_.audioDeviceList.size(), 1);
+    EXPECT_NE(audioDeviceManager->deviceRegistry_.Find("addr1", AudioDeviceType::DEVICE_BLUETOOTH_SCO), nullptr);
+    EXPECT_EQ(audioDeviceManager->deviceRegistry_.Find("addr2", AudioDeviceType::DEVICE_BLUETOOTH_SCO), nullptr);
+    EXPECT_TRUE(audioDeviceManager->deviceRegistry_.HasDeviceType(AudioDeviceType::DEVICE_BLUETOOTH_SCO));
+
+    generation = audioDeviceManager->GetAudioDeviceGeneration();
+    audioDeviceManager->UpdateBluetoothDeviceName("addr1", "nameReplace");
+    EXPECT_GT(audioDeviceManager->GetAudioDeviceGeneration(), generation);
+    EXPECT_EQ(std::string(audioDeviceManager->info_.audioDeviceList[0].deviceName), "nameReplace");
+    audioDeviceManager->ResetBtAudioDevicesList();
+    EXPECT_FALSE(audioDeviceManager->deviceRegistry_.HasDeviceType(AudioDeviceType::DEVICE_BLUETOOTH_SCO));
+    audioDeviceManager->EndDeviceBatch();
+    EXPECT_EQ(audioDeviceManager->deviceBatchDepth_, 0);
+}
+
+/**
+ * @tc.number   Telephony_AudioDeviceRegistry_001
+ * @tc.name     test AudioDeviceRegistry keeps the index in step on remove
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch10Test, Telephony_AudioDeviceRegistry_001, TestSize.Level0)
+{
+    std::vector<AudioDevice> deviceList;
+    AudioDeviceRegistry registry(deviceList);
+    const std::vector<std::string> addresses = { "addr1", "addr2", "addr3", "addr4", "addr5" };
+    for (const auto &address : addresses) {
+        AudioDevice device;
+        ASSERT_EQ(strcpy_s(device.address, kMaxAddressLen + 1, address.c_str()), EOK);
+        device.deviceType = address == "addr5" ? AudioDeviceType::DEVICE_NEARLINK :
+            AudioDeviceType::DEVICE_BLUETOOTH_SCO;
+        EXPECT_TRUE(registry.Add(device));
+    }
+    EXPECT_TRUE(registry.Remove("addr1", AudioDeviceType::DEVICE_BLUETOOTH_SCO));
+    EXPECT_FALSE(registry.Remove("addr1", AudioDeviceType::DEVICE_BLUETOOTH_SCO));
+    /* 删除后索引逐项平移, 不需要重建 */
+    EXPECT_EQ(registry.index_.size(), deviceList.size());
+    const AudioDevice *device = registry.Find("addr4", AudioDeviceType::DEVICE_BLUETOOTH_SCO);
+    ASSERT_NE(device, nullptr);
+    EXPECT_EQ(device, &deviceList[2]);
+
+    EXPECT_EQ(registry.RemoveIf([](const AudioDevice &device) {
+        return std::string(device.address) == "addr2" || std::string(device.address) == "addr4";
+    }), 2);
+    ASSERT_EQ(deviceList.size(), 2);
+    EXPECT_EQ(registry.index_.size(), deviceList.size());
+    EXPECT_EQ(registry.Find("addr3", AudioDeviceType::DEVICE_BLUETOOTH_SCO), &deviceList[0]);
+    EXPECT_EQ(registry.Find("addr5", AudioDeviceType::DEVICE_NEARLINK), &deviceList[1]);
+    EXPECT_TRUE(registry.HasDeviceType(AudioDeviceType::DEVICE_BLUETOOTH_SCO));
+    EXPECT_EQ(registry.RemoveIf([](const AudioDevice &device) {
+        return device.deviceType == AudioDeviceType::DEVICE_BLUETOOTH_SCO;
+    }), 1);
+    EXPECT_FALSE(registry.HasDeviceType(AudioDeviceType::DEVICE_BLUETOOTH_SCO));
+    EXPECT_EQ(registry.Find("addr5", AudioDeviceType::DEVICE_NEARLINK), &deviceList[0]);
+}
+
+/**
+ * @tc.number   Telephony_AudioDeviceRegistry_002
+ * @tc.name     test AudioDeviceRegistry reports a stale index as a miss
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch10Test, Telephony_AudioDeviceRegistry_002, TestSize.Level0)
+{
+    std::vector<AudioDevice> deviceList;
+    AudioDeviceRegistry registry(deviceList);
+    AudioDevice device;
+    ASSERT_EQ(strcpy_s(device.address, kMaxAddressLen + 1, "addr1"), EOK);
+    device.deviceType = AudioDeviceType::DEVICE_BLUETOOTH_SCO;
+    /* 绕过注册表直接修改列表, 索引失效时按未命中处理, 不会静默重建 */
+    deviceList.push_back(device);
+    EXPECT_EQ(registry.Find("addr1", AudioDeviceType::DEVICE_BLUETOOTH_SCO), nullptr);
+    EXPECT_FALSE(registry.HasDeviceType(AudioDeviceType::DEVICE_BLUETOOTH_SCO));
+    EXPECT_FALSE(registry.Add(device));
+    EXPECT_EQ(deviceList.size(), 1);
+    EXPECT_EQ(registry.index_.size(), 0);
+    registry.Rebuild();
+    EXPECT_EQ(registry.Find("addr1", AudioDeviceType::DEVICE_BLUETOOTH_SCO), &deviceList[0]);
+    EXPECT_TRUE(registry.HasDeviceType(AudioDeviceType::DEVICE_BLUETOOTH_SCO));
+}
+
+/**
+ * @tc.number   Telephony_AudioDeviceManager_005
+ * @tc.name     test AudioDeviceManager debounced device report
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch10Test, Telephony_AudioDeviceManager_005, TestSize.Level0)
+{
+    FakeCallTaskExecutor fakeExecutor;
+    auto audioDeviceManager = DelayedSingleton<AudioDeviceManager>::GetInstance();
+    CallManagerMetrics &metrics = CallManagerMetrics::GetInstance();
+    metrics.Reset();
+    audioDeviceManager->SetAudioDeviceReportSettleWindow(SETTLE_WINDOW_MS);
+    AudioDeviceInfo info;
+    info.currentAudioDevice.deviceType = AudioDeviceType::DEVICE_SPEAKER;
+    audioDeviceManager->SubmitAudioDeviceReport(info);
+    info.currentAudioDevice.deviceType = AudioDeviceType::DEVICE_EARPIECE;
+    audioDeviceManager->SubmitAudioDeviceReport(info);
+    info.currentAudioDevice.deviceType = AudioDeviceType::DEVICE_BLUETOOTH_SCO;
+    audioDeviceManager->SubmitAudioDeviceReport(info);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::AUDIO_DEVICE_REPORT_REQUEST), 3);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::AUDIO_DEVICE_REPORT_SENT), 0);
+    EXPECT_TRUE(audioDeviceManager->hasPendingReport_);
+    EXPECT_EQ(audioDeviceManager->pendingReportInfo_.currentAudioDevice.deviceType,
+        AudioDeviceType::DEVICE_BLUETOOTH_SCO);
+    /* 三次上报只投递一次稳定窗口任务 */
+    EXPECT_EQ(fakeExecutor.GetPendingCount(), 1);
+    fakeExecutor.AdvanceMs(SETTLE_WINDOW_MS);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::AUDIO_DEVICE_REPORT_SENT), 1);
+    EXPECT_FALSE(audioDeviceManager->hasPendingReport_);
+    EXPECT_FALSE(audioDeviceManager->isReportFlushScheduled_);
+
+    /* 关闭稳定窗口时立即发送未到期的上报 */
+    audioDeviceManager->SubmitAudioDeviceReport(info);
+    audioDeviceManager->SetAudioDeviceReportSettleWindow(0);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::AUDIO_DEVICE_REPORT_SENT), 2);
+    EXPECT_FALSE(audioDeviceManager->hasPendingReport_);
+    fakeExecutor.AdvanceMs(SETTLE_WINDOW_MS);
+    EXPECT_EQ(fakeExecutor.GetPendingCount(), 0);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::AUDIO_DEVICE_REPORT_SENT), 2);
+    audioDeviceManager->SendAudioDeviceReport(info, 1);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::AUDIO_DEVICE_REPORT_SENT), 2);
+    EXPECT_GE(metrics.GetRatePeak(MetricRate::AUDIO_DEVICE_REPORT_REQUEST), 1);
+
+    std::string result;
+    metrics.Dump(result);
+    EXPECT_NE(result.find("audio_device_report_sent"), std::string::npos);
+    audioDeviceManager->SubmitAudioDeviceReport(info);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::AUDIO_DEVICE_REPORT_SENT), 3);
+}
+
 /**
  * @tc.number   Telephony_AudioProxy_001
  * @tc.name     test AudioProxy
@@ -674,9 +839,8 @@ HWTEST_F(ZeroBranch10Test, Telephony_IncomingFlashReminder_001, TestSize.Level1)
     DelayedSingleton<CallControlManager>::GetInstance()->incomingFlashReminder_ = nullptr;
     DelayedSingleton<CallControlManager>::GetInstance()->StartFlashRemind();
     DelayedSingleton<CallControlManager>::GetInstance()->StopFlashRemind();
-    auto runner = AppExecFwk::EventRunner::Create("handler_incoming_flash_reminder");
     DelayedSingleton<CallControlManager>::GetInstance()->incomingFlashReminder_ =
-        std::make_shared<IncomingFlashReminder>(runner, nullptr);
+        std::make_shared<IncomingFlashReminder>(nullptr);
     DelayedSingleton<CallControlManager>::GetInstance()->StopFlashRemind();
     DelayedSingleton<CallControlManager>::GetInstance()->StartFlashRemind();
     DelayedSingleton<CallControlManager>::GetInstance()->StopFlashRemind();
@@ -37,12 +37,16 @@
 #include "call_setting_manager.h"
 #include "call_state_report_proxy.h"
 #include "call_status_manager.h"
+#include "call_timer_wheel.h"
+#include "call_manager_metrics.h"
 #include "cellular_call_connection.h"
+#include "cellular_call_proxy.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
 #include "cs_call.h"
 #include "cs_conference.h"
 #include "distributed_call_manager.h"
+#include "fake_call_task_executor.h"
 #include "gtest/gtest.h"
 #include "i_voip_call_manager_service.h"
 #include "ims_call.h"
@@ -102,6 +106,43 @@ public:
     void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event) {}
 };
 
+class FakeCellularCallStub : public IRemoteObject {
+public:
+    FakeCellularCallStub() : IRemoteObject(u"default") {}
+
+    int SendRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        requestCount_++;
+        data.ReadInterfaceToken();
+        lastCallNum_ = data.ReadInt32();
+        reply.WriteInt32(TELEPHONY_SUCCESS);
+        return 0;
+    }
+
+    int32_t GetObjectRefCount() override
+    {
+        return 0;
+    }
+
+    bool AddDeathRecipient(const sptr<DeathRecipient> &recipient) override
+    {
+        return true;
+    }
+
+    bool RemoveDeathRecipient(const sptr<DeathRecipient> &recipient) override
+    {
+        return true;
+    }
+
+    int Dump(int fd, const std::vector<std::u16string> &args) override
+    {
+        return 0;
+    }
+
+    int32_t requestCount_ = 0;
+    int32_t lastCallNum_ = 0;
+};
+
 class ZeroBranch2Test : public testing::Test {
 public:
     void SetUp();
@@ -180,6 +221,159 @@ HWTEST_F(ZeroBranch2Test, Telephony_CallRequestHandler_001, Function | MediumTes
     ASSERT_NE(callRequestHandler->JoinConference(1, emptyRecords), TELEPHONY_ERR_SUCCESS);
 }
 
+/**
+ * @tc.number   Telephony_CallRequestExecutor_001
+ * @tc.name     test per call ordering, merge and cancel of queued call requests
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch2Test, Telephony_CallRequestExecutor_001, Function | MediumTest | Level1)
+{
+    FakeCallTaskExecutor fake;
+    auto executor = std::make_shared<CallRequestExecutor>();
+    std::vector<std::string> order;
+    auto record = [&order](const std::string &name) { return [&order, name]() { order.push_back(name); }; };
+    EXPECT_FALSE(executor->Submit(CallRequestScope::CALL, 1, CallRequestType::REQUEST_TYPE_BUTT, record("invalid")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 1, CallRequestType::HOLD, record("hold")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 1, CallRequestType::UN_HOLD, record("unhold")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 1, CallRequestType::UN_HOLD, record("unhold_again")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 2, CallRequestType::ANSWER, record("answer")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 2, CallRequestType::HANG_UP, record("hangup")));
+    EXPECT_EQ(fake.GetPendingCount(), 2u);
+    EXPECT_EQ(executor->GetPendingCount(), 3u);
+    fake.RunPending();
+    // 每次排空只执行一个请求, 两个通话的请求交替执行
+    std::vector<std::string> expected = { "hold", "hangup", "unhold" };
+    EXPECT_EQ(order, expected);
+    EXPECT_EQ(executor->GetPendingCount(), 0u);
+    EXPECT_TRUE(executor->queues_.empty());
+    std::string result;
+    executor->Dump(result);
+    EXPECT_NE(result.find("un_hold: count 1"), std::string::npos);
+    EXPECT_NE(result.find("merged 1"), std::string::npos);
+    EXPECT_NE(result.find("cancelled 1"), std::string::npos);
+}
+
+/**
+ * @tc.number   Telephony_CallRequestExecutor_002
+ * @tc.name     test only the newest queued request is merged and payload requests are never merged
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch2Test, Telephony_CallRequestExecutor_002, Function | MediumTest | Level1)
+{
+    FakeCallTaskExecutor fake;
+    auto executor = std::make_shared<CallRequestExecutor>();
+    std::vector<std::string> order;
+    auto record = [&order](const std::string &name) { return [&order, name]() { order.push_back(name); }; };
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 1, CallRequestType::HOLD, record("hold")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 1, CallRequestType::UN_HOLD, record("unhold")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 1, CallRequestType::HOLD, record("hold_again")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 2, CallRequestType::ANSWER, record("answer_voice")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 2, CallRequestType::ANSWER, record("answer_video")));
+    EXPECT_EQ(executor->GetPendingCount(), 5u);
+    fake.RunPending();
+    std::vector<std::string> expected = { "hold", "answer_voice", "unhold", "answer_video", "hold_again" };
+    EXPECT_EQ(order, expected);
+    std::string result;
+    executor->Dump(result);
+    EXPECT_EQ(result.find("merged 1"), std::string::npos);
+}
+
+/**
+ * @tc.number   Telephony_CallRequestExecutor_003
+ * @tc.name     test conference requests of different calls on one slot and switch requests are never merged
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch2Test, Telephony_CallRequestExecutor_003, Function | MediumTest | Level1)
+{
+    FakeCallTaskExecutor fake;
+    auto executor = std::make_shared<CallRequestExecutor>();
+    std::vector<std::string> order;
+    auto record = [&order](const std::string &name) { return [&order, name]() { order.push_back(name); }; };
+    /* 同一卡槽上两个通话的分离/踢出请求按卡槽排队, 不能合并 */
+    EXPECT_TRUE(executor->Submit(CallRequestScope::SLOT, 0, CallRequestType::SEPARATE_CONFERENCE, record("sep_a")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::SLOT, 0, CallRequestType::SEPARATE_CONFERENCE, record("sep_b")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::SLOT, 0, CallRequestType::KICK_OUT_CONFERENCE, record("kick_a")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::SLOT, 0, CallRequestType::KICK_OUT_CONFERENCE, record("kick_b")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::SLOT, 0, CallRequestType::COMBINE_CONFERENCE, record("combine_a")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::SLOT, 0, CallRequestType::COMBINE_CONFERENCE, record("combine_b")));
+    /* 切换是翻转操作, 两次切换不能合并为一次 */
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 1, CallRequestType::SWITCH, record("switch")));
+    EXPECT_TRUE(executor->Submit(CallRequestScope::CALL, 1, CallRequestType::SWITCH, record("switch_again")));
+    EXPECT_EQ(executor->GetPendingCount(), 8u);
+    fake.RunPending();
+    EXPECT_EQ(order.size(), 8u);
+    std::vector<std::string> slotOrder;
+    for (const auto &name : order) {
+        if (name.find("switch") == std::string::npos) {
+            slotOrder.push_back(name);
+        }
+    }
+    std::vector<std::string> expected = { "sep_a", "sep_b", "kick_a", "kick_b", "combine_a", "combine_b" };
+    EXPECT_EQ(slotOrder, expected);
+    std::string result;
+    executor->Dump(result);
+    EXPECT_EQ(result.find("merged 1"), std::string::npos);
+}
+
+/**
+ * @tc.number   Telephony_CallTimerWheel_001
+ * @tc.name     test named call timers fire on time, replace and cancel
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch2Test, Telephony_CallTimerWheel_001, Function | MediumTest | Level1)
+{
+    FakeCallTaskExecutor fake;
+    auto timerWheel = std::make_shared<CallTimerWheel>();
+    int64_t startMs = fake.GetNowUs() / 1000;
+    std::map<std::string, int64_t> fired;
+    auto record = [&fired, &fake, startMs](const std::string &name) {
+        return [&fired, &fake, startMs, name]() { fired[name] = fake.GetNowUs() / 1000 - startMs; };
+    };
+    EXPECT_EQ(timerWheel->Schedule("invalid", 10, nullptr), INVALID_TIMER_ID);
+    timerWheel->Schedule("short", 300, record("short"), 1);
+    timerWheel->Schedule("long", 270000, record("long"));
+    timerWheel->Schedule("replaced", 1000, record("replaced"));
+    timerWheel->Schedule("replaced", 3000, record("replaced"));
+    timerWheel->Schedule("call_a", 500, record("call_a"), 2);
+    timerWheel->Schedule("call_b", 600, record("call_b"), 2);
+    uint64_t cancelledId = timerWheel->Schedule("cancelled", 100, record("cancelled"));
+    EXPECT_TRUE(timerWheel->Cancel(cancelledId));
+    EXPECT_EQ(timerWheel->CancelCallTimers(2), 2u);
+    EXPECT_EQ(timerWheel->GetTimerCount(), 3u);
+    std::string result;
+    timerWheel->Dump(result);
+    EXPECT_NE(result.find("short callId 1 remain 300ms"), std::string::npos);
+    fake.AdvanceMs(300000);
+    EXPECT_EQ(fired.size(), 3u);
+    EXPECT_EQ(fired["short"], 300);
+    EXPECT_EQ(fired["replaced"], 3000);
+    EXPECT_EQ(fired["long"], 270000);
+    EXPECT_EQ(timerWheel->GetTimerCount(), 0u);
+    EXPECT_EQ(fake.GetPendingCount(), 0u);
+}
+
+/**
+ * @tc.number   Telephony_CallTimerWheel_002
+ * @tc.name     test timers gone due before their wake task are fired on the executor, not by Schedule
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch2Test, Telephony_CallTimerWheel_002, Function | MediumTest | Level1)
+{
+    FakeCallTaskExecutor fake;
+    auto timerWheel = std::make_shared<CallTimerWheel>();
+    bool isFired = false;
+    timerWheel->Schedule("due", 100, [&isFired]() { isFired = true; });
+    // 时钟越过到期时间但唤醒任务尚未执行
+    fake.state_->nowUs += 200000;
+    timerWheel->Schedule("next", 1000, []() {});
+    EXPECT_FALSE(isFired);
+    EXPECT_FALSE(timerWheel->IsScheduled("due"));
+    fake.RunPending();
+    EXPECT_TRUE(isFired);
+    EXPECT_TRUE(timerWheel->IsScheduled("next"));
+    EXPECT_TRUE(timerWheel->Cancel("next"));
+}
+
 /**
  * @tc.number   Telephony_CallRequestProcess_001
  * @tc.name     test error branch
@@ -813,6 +1007,53 @@ HWTEST_F(ZeroBranch2Test, Telephony_CellularCallConnection_003, Function | Mediu
     ASSERT_NE(cellularCallConnection->PostDialProceed(mCellularCallInfo, true), TELEPHONY_ERR_SUCCESS);
 }
 
+/**
+ * @tc.number   Telephony_CellularCallConnection_ClearAllCalls_001
+ * @tc.name     test clear all calls waits for the service ready signal and sends one batch
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch2Test, Telephony_CellularCallConnection_ClearAllCalls_001, Function | MediumTest | Level1)
+{
+    auto connection = std::make_shared<CellularCallConnection>();
+    sptr<FakeCellularCallStub> stub = new FakeCellularCallStub();
+    connection->cellularCallInterfacePtr_ = new CellularCallProxy(stub);
+    connection->connectState_ = false;
+    FakeCallTaskExecutor fake;
+    CallObjectManager::callObjectPtrList_.clear();
+    EXPECT_EQ(connection->ClearAllCalls(), TELEPHONY_SUCCESS);
+    EXPECT_EQ(fake.GetPendingCount(), 0u);
+    DialParaInfo dialInfo;
+    for (int32_t callId = 1; callId <= 2; callId++) {
+        sptr<CallBase> call = new IMSCall(dialInfo);
+        call->callId_ = callId;
+        call->SetCallIndex(callId);
+        call->SetSlotId(0);
+        call->SetTelCallState(TelCallState::CALL_STATUS_ACTIVE);
+        call->SetAccountNumber("10086");
+        CallObjectManager::AddOneCallObject(call);
+    }
+    uint64_t latencyCount = CallManagerMetrics::GetInstance().GetHistogramCount(
+        MetricHistogram::CLEAR_ALL_CALLS_LATENCY);
+    EXPECT_EQ(connection->ClearAllCalls(), TELEPHONY_SUCCESS);
+    auto timerWheel = DelayedSingleton<CallTimerWheel>::GetInstance();
+    EXPECT_TRUE(timerWheel->IsScheduled("clear_all_calls_wait_ready"));
+    fake.RunPending();
+    EXPECT_EQ(stub->requestCount_, 0);
+    connection->connectState_ = true;
+    connection->OnServiceReady();
+    EXPECT_FALSE(timerWheel->IsScheduled("clear_all_calls_wait_ready"));
+    EXPECT_EQ(stub->requestCount_, 0);
+    // 服务就绪后清理任务才投递, 定时轮的唤醒仍未到期
+    fake.RunPending();
+    EXPECT_EQ(stub->requestCount_, 1);
+    EXPECT_EQ(stub->lastCallNum_, 2);
+    EXPECT_EQ(CallManagerMetrics::GetInstance().GetHistogramCount(MetricHistogram::CLEAR_ALL_CALLS_LATENCY),
+        latencyCount + 1);
+    CallObjectManager::callObjectPtrList_.clear();
+    connection->cellularCallInterfacePtr_ = nullptr;
+    connection->connectState_ = false;
+}
+
 /**
  * @tc.number   Telephony_CellularCallConnection_004
  * @tc.name     test error branch
@@ -1414,6 +1655,29 @@ HWTEST_F(ZeroBranch2Test, Telephony_EdmCallPolicy_002, Function | MediumTest | L
     EXPECT_EQ(edmCallPolicy->IsIncomingEnable(number), true);
 }
 
+/**
+ * @tc.number   Telephony_EdmCallPolicy_003
+ * @tc.name     test policy lists match numbers exactly and the disable switch applies immediately
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch2Test, Telephony_EdmCallPolicy_003, Function | MediumTest | Level1)
+{
+    std::vector<std::string> dialingList = { "13800000000", "400*", "" };
+    std::vector<std::string> incomingList = { "13900000000" };
+    std::shared_ptr<EdmCallPolicy> edmCallPolicy = std::make_shared<EdmCallPolicy>();
+    EXPECT_EQ(edmCallPolicy->SetCallPolicy(false, dialingList, true, incomingList), TELEPHONY_ERR_SUCCESS);
+    EXPECT_FALSE(edmCallPolicy->IsDialingEnable("13800000000"));
+    EXPECT_FALSE(edmCallPolicy->IsDialingEnable("400*"));
+    EXPECT_TRUE(edmCallPolicy->IsDialingEnable("4001234567"));
+    EXPECT_TRUE(edmCallPolicy->IsDialingEnable("+86 138-0000-0000"));
+    EXPECT_TRUE(edmCallPolicy->IsIncomingEnable("13900000000"));
+    EXPECT_FALSE(edmCallPolicy->IsIncomingEnable("13800000000"));
+    system::SetParameter("persist.edm.telephony_call_disable", "true");
+    EXPECT_FALSE(edmCallPolicy->IsIncomingEnable("13900000000"));
+    system::SetParameter("persist.edm.telephony_call_disable", "false");
+    EXPECT_TRUE(edmCallPolicy->IsIncomingEnable("13900000000"));
+}
+
 /**
  * @tc.number   Telephony_CallPolicy_DialPolicy_001
  * @tc.name     Test CheckDialType - invalid dial type
@@ -36,6 +36,7 @@
 #include "call_request_process.h"
 #include "call_setting_manager.h"
 #include "call_state_report_proxy.h"
+#include "call_timer_wheel.h"
 #include "call_status_manager.h"
 #include "cellular_call_connection.h"
 #include "common_event_manager.h"
@@ -49,6 +50,7 @@
 #include "ims_conference.h"
 #include "incoming_call_notification.h"
 #include "missed_call_notification.h"
+#include "motion_recognition.h"
 #include "ott_call.h"
 #include "ott_conference.h"
 #include "reject_call_sms.h"
@@ -80,6 +82,8 @@
 #include "datashare_helper.h"
 #include "incoming_flash_reminder.h"
 
+#include <chrono>
+
 namespace OHOS {
 namespace Telephony {
 using namespace testing::ext;
@@ -1326,12 +1330,11 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallControlManager_012, Function | MediumTes
     int32_t state = 0;
     EXPECT_EQ(callControlManager->GetVoNRState(-1, state), CALL_ERR_INVALID_SLOT_ID);
     EXPECT_EQ(callControlManager->CloseUnFinishedUssd(-1), CALL_ERR_INVALID_SLOT_ID);
-    CallControlManager::alarmSeted_ = true;
     callControlManager->ConnectCallUiService(true);
-    CallControlManager::alarmSeted_ = true;
     callControlManager->ConnectCallUiService(false);
-    CallControlManager::alarmSeted_ = true;
+    EXPECT_TRUE(DelayedSingleton<CallTimerWheel>::GetInstance()->IsScheduled("disconnect_call_ui"));
     callControlManager->ConnectCallUiService(true);
+    EXPECT_FALSE(DelayedSingleton<CallTimerWheel>::GetInstance()->IsScheduled("disconnect_call_ui"));
     EXPECT_NE(callControlManager->RemoveMissedIncomingCallNotification(), TELEPHONY_SUCCESS);
 }
 
@@ -1817,6 +1820,81 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_008, TestSize.Level0)
     EXPECT_GT(callStatusManager->HandleVoipCallReportInfo(info), TELEPHONY_ERROR);
 }
 
+/**
+ * @tc.number   Telephony_CallStatusManager_ReportFingerprint_001
+ * @tc.name     test IsCallReportChanged
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_ReportFingerprint_001, TestSize.Level0)
+{
+    CallDetailInfo oldInfo;
+    oldInfo.index = 1;
+    oldInfo.state = TelCallState::CALL_STATUS_ACTIVE;
+    oldInfo.callType = CallType::TYPE_IMS;
+    CallDetailInfo newInfo = oldInfo;
+    EXPECT_EQ(CallStatusManager::GetCallReportFingerprint(oldInfo),
+        CallStatusManager::GetCallReportFingerprint(newInfo));
+    EXPECT_FALSE(CallStatusManager::IsCallReportChanged(oldInfo, newInfo));
+    newInfo.mpty = 1;
+    EXPECT_TRUE(CallStatusManager::IsCallReportChanged(oldInfo, newInfo));
+    newInfo.mpty = 0;
+    newInfo.callMode = VideoStateType::TYPE_VIDEO;
+    EXPECT_TRUE(CallStatusManager::IsCallReportChanged(oldInfo, newInfo));
+    newInfo.callMode = oldInfo.callMode;
+    newInfo.state = TelCallState::CALL_STATUS_HOLDING;
+    EXPECT_TRUE(CallStatusManager::IsCallReportChanged(oldInfo, newInfo));
+    newInfo.state = TelCallState::CALL_STATUS_ALERTING;
+    EXPECT_TRUE(CallStatusManager::IsCallReportChanged(newInfo, newInfo));
+    newInfo.state = oldInfo.state;
+    newInfo.callType = CallType::TYPE_VOIP;
+    EXPECT_TRUE(CallStatusManager::IsCallReportChanged(newInfo, newInfo));
+}
+
+/**
+ * @tc.number   Telephony_CallStatusManager_ReportReplay_001
+ * @tc.name     replay a recorded modem report sequence through HandleCallsReportInfo
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_ReportReplay_001, TestSize.Level1)
+{
+    std::shared_ptr<CallStatusManager> callStatusManager = std::make_shared<CallStatusManager>();
+    CallObjectManager::callObjectPtrList_.clear();
+    auto makeInfo = [](int32_t index, TelCallState state, int32_t mpty) {
+        CallDetailInfo info;
+        info.index = index;
+        info.state = state;
+        info.mpty = mpty;
+        info.accountId = SIM1_SLOTID;
+        info.callType = CallType::TYPE_IMS;
+        return info;
+    };
+    // dial, alerting, active, call waiting, swap, merge, hang up all
+    std::vector<std::vector<CallDetailInfo>> sequence = {
+        { makeInfo(1, TelCallState::CALL_STATUS_DIALING, 0) },
+        { makeInfo(1, TelCallState::CALL_STATUS_ALERTING, 0) },
+        { makeInfo(1, TelCallState::CALL_STATUS_ACTIVE, 0) },
+        { makeInfo(1, TelCallState::CALL_STATUS_ACTIVE, 0), makeInfo(2, TelCallState::CALL_STATUS_WAITING, 0) },
+        { makeInfo(1, TelCallState::CALL_STATUS_HOLDING, 0), makeInfo(2, TelCallState::CALL_STATUS_ACTIVE, 0) },
+        { makeInfo(1, TelCallState::CALL_STATUS_ACTIVE, 1), makeInfo(2, TelCallState::CALL_STATUS_ACTIVE, 1) },
+        { makeInfo(2, TelCallState::CALL_STATUS_ACTIVE, 0) },
+        {},
+    };
+    std::vector<size_t> expectedSize = { 1, 1, 1, 2, 2, 2, 1, 0 };
+    auto begin = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < sequence.size(); i++) {
+        CallDetailsInfo infos;
+        infos.slotId = SIM1_SLOTID;
+        infos.callVec = sequence[i];
+        EXPECT_EQ(callStatusManager->HandleCallsReportInfo(infos), TELEPHONY_SUCCESS);
+        EXPECT_EQ(callStatusManager->callDetailsInfo_[SIM1_SLOTID].callVec.size(), expectedSize[i]);
+    }
+    auto costUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    TELEPHONY_LOGI("replayed %{public}zu reports in %{public}lld us", sequence.size(),
+        static_cast<long long>(costUs));
+    CallObjectManager::callObjectPtrList_.clear();
+}
+
 HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_009, TestSize.Level0)
 {
     std::shared_ptr<CallStatusManager> callStatusManager = std::make_shared<CallStatusManager>();
@@ -1842,8 +1920,9 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_009, TestSize.Level0)
     info.callType = CallType::TYPE_VOIP;
     sptr<CallBase> voipCall = callStatusManager->CreateNewCall(info, CallDirection::CALL_DIRECTION_IN);
     ASSERT_TRUE(voipCall != nullptr);
-    callStatusManager->antiFraudSlotId_ = 0;
-    callStatusManager->antiFraudIndex_ = 0;
+    auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
+    antiFraudService->sessionTable_.Clear();
+    antiFraudService->ClaimDetectSession(0, 0);
     CallObjectManager::AddOneCallObject(voipCall);
     callStatusManager->SetupAntiFraudService(voipCall, info);
     callStatusManager->StopAntiFraudDetect(voipCall, info);
@@ -1853,10 +1932,10 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_009, TestSize.Level0)
     voipCall->SetCallRunningState(CallRunningState::CALL_RUNNING_STATE_CREATE);
     EXPECT_EQ(callStatusManager->HandleVoipEventReportInfo(voipCallEventInfo), TELEPHONY_ERR_FAIL);
     voipCall->SetCallRunningState(CallRunningState::CALL_RUNNING_STATE_ACTIVE);
-    callStatusManager->StartInComingCallMotionRecognition();
+    callStatusManager->StartInComingCallMotionRecognition(voipCall->GetCallID());
     EXPECT_EQ(callStatusManager->HandleVoipEventReportInfo(voipCallEventInfo), TELEPHONY_SUCCESS);
     voipCall->SetCallRunningState(CallRunningState::CALL_RUNNING_STATE_DIALING);
-    callStatusManager->StartInComingCallMotionRecognition();
+    callStatusManager->StartInComingCallMotionRecognition(voipCall->GetCallID());
     voipCallEventInfo.voipCallEvent = VoipCallEvent::VOIP_CALL_EVENT_MUTED;
     EXPECT_EQ(callStatusManager->HandleVoipEventReportInfo(voipCallEventInfo), TELEPHONY_SUCCESS);
     voipCallEventInfo.voipCallEvent = VoipCallEvent::VOIP_CALL_EVENT_UNMUTED;
@@ -1867,6 +1946,8 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_009, TestSize.Level0)
     EXPECT_NE(callStatusManager->OutgoingVoipCallHandle(info), TELEPHONY_SUCCESS);
     info.callMode = VideoStateType::TYPE_VIDEO;
     EXPECT_NE(callStatusManager->OutgoingVoipCallHandle(info), TELEPHONY_ERR_LOCAL_PTR_NULL);
+    /* 释放本用例在单例上申请的传感器 */
+    DelayedSingleton<MotionSensorSubscriptionManager>::GetInstance()->ReleaseCall(voipCall->GetCallID());
 }
 
 HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_010, TestSize.Level0)
@@ -1890,7 +1971,15 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_010, TestSize.Level0)
 HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_011, TestSize.Level0)
 {
     std::shared_ptr<CallStatusManager> callStatusManager = std::make_shared<CallStatusManager>();
-    callStatusManager->StopCallMotionRecognition(TelCallState::CALL_STATUS_ALERTING);
+    callStatusManager->StopCallMotionRecognition(TelCallState::CALL_STATUS_ALERTING, INVALID_CALLID);
+    /* 没有蜂窝通话时, 挂断兜底释放所有传感器, 包括未按通话释放的持有者 */
+    auto sensorManager = DelayedSingleton<MotionSensorSubscriptionManager>::GetInstance();
+    sensorManager->sensorLoader_ = []() { return true; };
+    CallObjectManager::callObjectPtrList_.clear();
+    EXPECT_TRUE(sensorManager->Acquire(MotionSensorType::FLIP, VALID_CALLID));
+    callStatusManager->StopCallMotionRecognition(TelCallState::CALL_STATUS_DISCONNECTED, INVALID_CALLID);
+    EXPECT_EQ(sensorManager->GetHolderCount(MotionSensorType::FLIP), 0u);
+    sensorManager->sensorLoader_ = nullptr;
     std::string message = "call answered elsewhere";
     sptr<CallBase> call = nullptr;
     callStatusManager->SetOriginalCallTypeForActiveState(call);
@@ -1932,19 +2021,17 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_012, TestSize.Level0)
     std::shared_ptr<CallStatusManager> callStatusManager = std::make_shared<CallStatusManager>();
     CallDetailInfo info;
     callStatusManager->callDetailsInfo_[0].callVec.push_back(info);
-    callStatusManager->antiFraudSlotId_ = 0;
     OHOS::AntiFraudService::AntiFraudResultExt antiFraudResultExt;
-    callStatusManager->TriggerAntiFraud(
+    callStatusManager->TriggerAntiFraud(0, info.index,
         static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_DEFAULT), antiFraudResultExt);
-    callStatusManager->antiFraudIndex_ = -1;
-    callStatusManager->antiFraudSlotId_ = 0;
-    callStatusManager->TriggerAntiFraud(
+    callStatusManager->TriggerAntiFraud(0, -1,
         static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_RISK), antiFraudResultExt);
-    EXPECT_EQ(callStatusManager->antiFraudSlotId_, -1);
-    callStatusManager->antiFraudSlotId_ = 0;
-    callStatusManager->TriggerAntiFraud(
+    EXPECT_EQ(callStatusManager->callDetailsInfo_[0].callVec[0].antiFraudState,
+        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_DEFAULT));
+    callStatusManager->TriggerAntiFraud(0, info.index,
         static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED), antiFraudResultExt);
-    EXPECT_EQ(callStatusManager->antiFraudSlotId_, -1);
+    EXPECT_EQ(callStatusManager->callDetailsInfo_[0].callVec[0].antiFraudState,
+        static_cast<int32_t>(AntiFraudState::ANTIFRAUD_STATE_NOT_RISK_OR_STOPPED));
     sleep(WAIT_TIME);
 }
 
@@ -1970,9 +2057,9 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_013, TestSize.Level0)
     EXPECT_TRUE(callStatusManager->CreateNewCallByCallTypeEx(paraInfo, info, CallDirection::CALL_DIRECTION_IN,
         extras) == nullptr);
     CallObjectManager::AddOneCallObject(call);
-    callStatusManager->StartInComingCallMotionRecognition();
+    callStatusManager->StartInComingCallMotionRecognition(call->GetCallID());
     EXPECT_FALSE(callStatusManager->GetConferenceCallList(0).empty());
-    callStatusManager->StopCallMotionRecognition(TelCallState::CALL_STATUS_DISCONNECTED);
+    callStatusManager->StopCallMotionRecognition(TelCallState::CALL_STATUS_DISCONNECTED, call->GetCallID());
     EXPECT_GT(callStatusManager->RefreshOldCall(info, isExistedOldCall), TELEPHONY_ERROR);
     info.callType = CallType::TYPE_CS;
     EXPECT_GT(callStatusManager->RefreshOldCall(info, isExistedOldCall), TELEPHONY_ERROR);
@@ -1987,7 +2074,7 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_013, TestSize.Level0)
     info.callMode = VideoStateType::TYPE_VOICE;
     EXPECT_GT(callStatusManager->RefreshOldCall(info, isExistedOldCall), TELEPHONY_ERROR);
     call->SetCallRunningState(CallRunningState::CALL_RUNNING_STATE_HOLD);
-    callStatusManager->StartInComingCallMotionRecognition();
+    callStatusManager->StartInComingCallMotionRecognition(call->GetCallID());
     callStatusManager->BtCallDialingHandleFirst(call, info);
     info.state = TelCallState::CALL_STATUS_ALERTING;
     callStatusManager->BtCallDialingHandleFirst(call, info);
@@ -1996,6 +2083,7 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_013, TestSize.Level0)
     EXPECT_EQ(call->GetTelCallState(), TelCallState::CALL_STATUS_DIALING);
     callStatusManager->BtCallDialingHandle(call, info);
     EXPECT_EQ(call->phoneOrWatch_, static_cast<int32_t>(PhoneOrWatchDial::WATCH_DIAL));
+    DelayedSingleton<MotionSensorSubscriptionManager>::GetInstance()->ReleaseCall(call->GetCallID());
 }
 
 HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_014, TestSize.Level0)
@@ -2006,8 +2094,9 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_014, TestSize.Level0)
     info.callType = CallType::TYPE_IMS;
     sptr<CallBase> call = manager->CreateNewCall(info, CallDirection::CALL_DIRECTION_IN);
     ASSERT_TRUE(call != nullptr);
-    manager->antiFraudSlotId_ = 0;
-    manager->antiFraudIndex_ = 0;
+    auto antiFraudService = DelayedSingleton<AntiFraudService>::GetInstance();
+    antiFraudService->sessionTable_.Clear();
+    ASSERT_TRUE(antiFraudService->ClaimDetectSession(0, 0));
     call->SetSlotId(1);
     manager->StopAntiFraudDetect(call, info);
     manager->HandleCeliaCall(call);
@@ -2018,7 +2107,7 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_014, TestSize.Level0)
     call->SetSlotId(0);
     manager->StopAntiFraudDetect(call, info);
     manager->HandleCeliaCall(call);
-    EXPECT_EQ(manager->antiFraudIndex_, 0);
+    EXPECT_TRUE(antiFraudService->IsDetecting(0, 0));
 
     NumberMarkInfo markInfo;
     markInfo.markType = MarkType::MARK_TYPE_FRAUD;
@@ -2033,9 +2122,10 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_014, TestSize.Level0)
     markInfo.markType = MarkType::MARK_TYPE_TAXI;
     call->SetNumberMarkInfo(markInfo);
     manager->SetupAntiFraudService(call, info);
-    EXPECT_EQ(manager->antiFraudIndex_, 0);
+    EXPECT_TRUE(antiFraudService->IsDetecting(0, 0));
     call->SetAntiFraudState(2);
     manager->SetupAntiFraudService(call, info);
+    antiFraudService->sessionTable_.Clear();
 }
 
 HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_015, TestSize.Level0)
@@ -2141,13 +2231,12 @@ HWTEST_F(ZeroBranch4Test, Telephony_CallStatusManager_ActiveHandle_StopTorch, Te
 {
     CallObjectManager::callObjectPtrList_.clear();
     CallObjectManager::voipCallObjectList_.clear();
-    auto runner = AppExecFwk::EventRunner::Create("handler_incoming_flash_reminder");
     bool stopped = false;
     auto task = [&stopped]() {
         stopped = true;
     };
     DelayedSingleton<CallControlManager>::GetInstance()->incomingFlashReminder_ =
-        std::make_shared<IncomingFlashReminder>(runner, task);
+        std::make_shared<IncomingFlashReminder>(task);
     std::shared_ptr<CallStatusManager> callStatusManager = std::make_shared<CallStatusManager>();
     CallDetailInfo info;
     EXPECT_EQ(callStatusManager->ActiveHandle(info), TELEPHONY_ERR_LOCAL_PTR_NULL);
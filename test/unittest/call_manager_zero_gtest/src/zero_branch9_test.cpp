@@ -19,6 +19,7 @@
 #include "call_state_processor.h"
 #include "call_control_manager.h"
 #include "common_event_manager.h"
+#include "fake_call_task_executor.h"
 #include "gtest/gtest.h"
 #include "ims_call.h"
 #include "voip_call.h"
@@ -74,7 +75,7 @@ HWTEST_F(ZeroBranch9Test, Telephony_AudioControlManager_001, TestSize.Level0)
     DialParaInfo mDialParaInfo;
     mDialParaInfo.accountId = 0;
     sptr<OHOS::Telephony::CallBase> callObjectPtr = nullptr;
-    DelayedSingleton<CallStateProcessor>::GetInstance()->holdingCalls_.insert(1);
+    DelayedSingleton<CallStateProcessor>::GetInstance()->AddCall(1, TelCallState::CALL_STATUS_HOLDING);
     auto audioControl = DelayedSingleton<AudioControlManager>::GetInstance();
     audioControl->VideoStateUpdated(callObjectPtr, VideoStateType::TYPE_VOICE, VideoStateType::TYPE_VIDEO);
     callObjectPtr = new IMSCall(mDialParaInfo);
@@ -262,8 +263,8 @@ HWTEST_F(ZeroBranch9Test, Telephony_AudioControlManager_006, TestSize.Level0)
     auto audioDeviceManager = DelayedSingleton<AudioDeviceManager>::GetInstance();
     audioDeviceManager->isWiredHeadsetConnected_ = true;
     auto callStateProcessor = DelayedSingleton<CallStateProcessor>::GetInstance();
-    callStateProcessor->incomingCalls_.insert(1);
-    callStateProcessor->alertingCalls_.clear();
+    callStateProcessor->AddCall(1, TelCallState::CALL_STATUS_INCOMING);
+    callStateProcessor->ClearCalls(TelCallState::CALL_STATUS_ALERTING);
     ringingCall->SetCallRunningState(CallRunningState::CALL_RUNNING_STATE_RINGING);
     CallPolicy callPolicy;
     callPolicy.AddOneCallObject(ringingCall);
@@ -570,6 +571,76 @@ HWTEST_F(ZeroBranch9Test, Telephony_AudioControlManager_014, Function | MediumTe
 }
 
 #ifdef CALL_MANAGER_SOS_NO_RINGBACK_TONE
+/**
+ * @tc.number   Telephony_AudioControlManager_015
+ * @tc.name     test timed call ended tone and deferred ring driven by a fake clock
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranch9Test, Telephony_AudioControlManager_015, Function | MediumTest | Level3)
+{
+    FakeCallTaskExecutor fake;
+    auto audioControl = std::make_shared<AudioControlManager>();
+    audioControl->tone_ = nullptr;
+    audioControl->toneState_ = ToneState::CALLENDED;
+    audioControl->callEndedToneId_ = 2;
+    audioControl->StopCallEndedTone(1);
+    EXPECT_EQ(audioControl->toneState_, ToneState::CALLENDED);
+    audioControl->StopCallEndedTone(2);
+    EXPECT_EQ(audioControl->toneState_, ToneState::TONEING);
+
+    /* 结束音开始播放后, 300ms 定时器到期才结束 CALLENDED 状态 */
+    audioControl->toneState_ = ToneState::TONEING;
+    audioControl->StartCallEndedToneTimer();
+    ASSERT_EQ(audioControl->toneState_, ToneState::CALLENDED);
+    ASSERT_EQ(fake.GetPendingCount(), 1u);
+    fake.AdvanceUs(299999);
+    EXPECT_EQ(audioControl->toneState_, ToneState::CALLENDED);
+    fake.AdvanceUs(1);
+    EXPECT_NE(audioControl->toneState_, ToneState::CALLENDED);
+    EXPECT_EQ(fake.GetPendingCount(), 0u);
+
+    /* 新的结束音使旧定时器失效 */
+    audioControl->toneState_ = ToneState::TONEING;
+    audioControl->StartCallEndedToneTimer();
+    fake.AdvanceUs(200000);
+    audioControl->toneState_ = ToneState::TONEING;
+    audioControl->StartCallEndedToneTimer();
+    fake.AdvanceUs(200000);
+    EXPECT_EQ(audioControl->toneState_, ToneState::CALLENDED);
+    fake.AdvanceUs(100000);
+    EXPECT_NE(audioControl->toneState_, ToneState::CALLENDED);
+
+    /* DTMF 音依次播放, 不会重叠 */
+    audioControl->isDtmfPlaying_ = true;
+    EXPECT_EQ(audioControl->PlayDtmfTone('1'), TELEPHONY_SUCCESS);
+    EXPECT_EQ(audioControl->PlayDtmfTone('2'), TELEPHONY_SUCCESS);
+    EXPECT_EQ(audioControl->pendingDtmfChars_.size(), 2u);
+    EXPECT_EQ(fake.GetPendingCount(), 0u);
+    audioControl->PlayNextDtmfTone();
+    fake.AdvanceUs(1000000);
+    EXPECT_TRUE(audioControl->pendingDtmfChars_.empty());
+    EXPECT_FALSE(audioControl->isDtmfPlaying_);
+    EXPECT_EQ(fake.GetPendingCount(), 0u);
+
+    DialParaInfo dialPara;
+    sptr<CallBase> incomingCall = new IMSCall(dialPara);
+    incomingCall->SetTelCallState(TelCallState::CALL_STATUS_ACTIVE);
+    CallAttributeInfo info;
+    ContactInfo contactInfo;
+    audioControl->DeferRing(incomingCall, info, contactInfo);
+    audioControl->DeferRing(incomingCall, info, contactInfo);
+    EXPECT_EQ(audioControl->pendingRing_.ringId, 2u);
+    /* 每次延迟响铃只挂一个 200ms 检查, 检查到期后再续下一次 */
+    EXPECT_EQ(fake.GetPendingCount(), 2u);
+    AudioControlManager::PendingRing pendingRing;
+    EXPECT_FALSE(audioControl->TakePendingRing(1, pendingRing));
+    audioControl->PlayPendingRing(0);
+    EXPECT_EQ(audioControl->pendingRing_.ringId, 0u);
+    fake.AdvanceUs(1000000);
+    EXPECT_EQ(fake.GetPendingCount(), 0u);
+    EXPECT_FALSE(audioControl->TakePendingRing(0, pendingRing));
+}
+
 /**
  * @tc.number Telephony_AudioControlManager_sos_noringback_tone
  * @tc.name   test error branch
@@ -747,9 +818,9 @@ HWTEST_F(ZeroBranch9Test, Telephony_PlayRingtone_CallNumberExceed1, Function | M
     auto audioControl = DelayedSingleton<AudioControlManager>::GetInstance();
     audioControl->Init();
     auto callStateProcessor = DelayedSingleton<CallStateProcessor>::GetInstance();
-    callStateProcessor->alertingCalls_.clear();
-    callStateProcessor->incomingCalls_.clear();
-    callStateProcessor->incomingCalls_.insert(CRS_TYPE);
+    callStateProcessor->ClearCalls(TelCallState::CALL_STATUS_ALERTING);
+    callStateProcessor->ClearCalls(TelCallState::CALL_STATUS_INCOMING);
+    callStateProcessor->AddCall(CRS_TYPE, TelCallState::CALL_STATUS_INCOMING);
     DelayedSingleton<AudioSceneProcessor>::GetInstance()->SwitchIncoming();
     CallObjectManager::callObjectPtrList_.clear();
     DialParaInfo info;
@@ -759,7 +830,7 @@ HWTEST_F(ZeroBranch9Test, Telephony_PlayRingtone_CallNumberExceed1, Function | M
     CallObjectManager::AddOneCallObject(call);
     audioControl->SetRingState(RingState::STOPPED);
     audioControl->SetSoundState(SoundState::STOPPED);
-    callStateProcessor->incomingCalls_.clear();
+    callStateProcessor->ClearCalls(TelCallState::CALL_STATUS_INCOMING);
     audioControl->CallStateUpdated(call, TelCallState::CALL_STATUS_INCOMING, TelCallState::CALL_STATUS_DIALING);
     EXPECT_TRUE(audioControl->PlayRingtone());
     audioControl->UnInit();
@@ -19,6 +19,7 @@
 #include <memory>
 #include "gtest/gtest.h"
 
+#include "call_timer_wheel.h"
 #include "incoming_flash_reminder.h"
 #include "telephony_errors.h"
 #include "telephony_log_wrapper.h"
@@ -27,6 +28,7 @@ namespace OHOS {
 namespace Telephony {
 using namespace testing::ext;
 constexpr int WAIT_TIME = 1;
+constexpr int64_t DELAY_SET_TORCH_TIME = 300;
 
 class IncomingFlashReminderTest : public testing::Test {
 public:
@@ -38,8 +40,7 @@ public:
     void SetUp() override
     {
         callbackCalled_ = false;
-        runner_ = AppExecFwk::EventRunner::Create("test_runner");
-        reminder_ = std::make_shared<IncomingFlashReminder>(runner_, [this]() {
+        reminder_ = std::make_shared<IncomingFlashReminder>([this]() {
             callbackCalled_ = true;
         });
     }
@@ -48,12 +49,10 @@ public:
         if (reminder_ != nullptr) {
             reminder_->ReleaseDepsAdapter();
         }
-        runner_ = nullptr;
         reminder_ = nullptr;
     }
 
 protected:
-    std::shared_ptr<AppExecFwk::EventRunner> runner_;
     std::shared_ptr<IncomingFlashReminder> reminder_;
     bool callbackCalled_ = false;
 };
@@ -198,16 +197,20 @@ HWTEST_F(IncomingFlashReminderTest, RealLib, TestSize.Level0)
 }
 
 /**
- * @tc.number   Telephony_IncomingFlashReminder_ProcessUnknownEvent_001
- * @tc.name     test process unknown event
+ * @tc.number   Telephony_IncomingFlashReminder_ScheduleSetTorchMode_001
+ * @tc.name     test set torch mode timer is cancelled by stop
  * @tc.desc     Function test
  */
-HWTEST_F(IncomingFlashReminderTest, ProcessUnknownEvent, TestSize.Level0)
+HWTEST_F(IncomingFlashReminderTest, ScheduleSetTorchMode, TestSize.Level0)
 {
+    auto timerWheel = DelayedSingleton<CallTimerWheel>::GetInstance();
     reminder_->libAdapterHandler_ = nullptr;
-    auto event = AppExecFwk::InnerEvent::Get(99999, 0);
-    reminder_->ProcessEvent(event);
-    EXPECT_EQ(reminder_->libAdapterHandler_, nullptr);
+    reminder_->isFlashRemindUsed_ = true;
+    reminder_->ScheduleSetTorchMode(DELAY_SET_TORCH_TIME);
+    EXPECT_TRUE(timerWheel->IsScheduled("incoming_flash_set_torch_mode"));
+    reminder_->HandleStopFlashRemind();
+    EXPECT_FALSE(timerWheel->IsScheduled("incoming_flash_set_torch_mode"));
+    EXPECT_FALSE(reminder_->isFlashRemindUsed_);
 }
 
 /**
@@ -256,14 +259,13 @@ HWTEST_F(IncomingFlashReminderTest, FlashRemind, TestSize.Level0)
 
 /**
  * @tc.number   Telephony_IncomingFlashReminder_Constructor_001
- * @tc.name     test constructor with valid runner and callback
+ * @tc.name     test constructor with valid callback
  * @tc.desc     Function test - verifies object is constructed properly
  */
 HWTEST_F(IncomingFlashReminderTest, Constructor, TestSize.Level0)
 {
-    auto testRunner = AppExecFwk::EventRunner::Create("constructor_test");
     bool testCallbackCalled = false;
-    auto testReminder = std::make_shared<IncomingFlashReminder>(testRunner, [&testCallbackCalled]() {
+    auto testReminder = std::make_shared<IncomingFlashReminder>([&testCallbackCalled]() {
         testCallbackCalled = true;
     });
     EXPECT_NE(testReminder, nullptr);
@@ -19,6 +19,7 @@
 #include "audio_control_manager.h"
 #include "bluetooth_device_state.h"
 #include "call_ability_callback_stub.h"
+#include "call_manager_metrics.h"
 #include "call_policy.h"
 #include "call_request_process.h"
 #include "call_object_manager.h"
@@ -29,6 +30,7 @@
 #include "cs_call_state.h"
 #include "dialing_state.h"
 #include "earpiece_device_state.h"
+#include "fake_call_task_executor.h"
 #include "holding_state.h"
 #include "ims_call.h"
 #include "ims_call_state.h"
@@ -42,6 +44,7 @@
 #include "system_ability_definition.h"
 #include "telephony_log_wrapper.h"
 #include "tone.h"
+#include "volume_ramp_scheduler.h"
 #ifdef SUPPORT_DSOFTBUS
 #include "distributed_communication_manager.h"
 #endif
@@ -60,6 +63,62 @@ constexpr int WAIT_TIME = 3;
 constexpr int DEFAULT_SLOT_ID = 0;
 constexpr const char* NAME = "test";
 
+class FakeRingtonePlayer : public Media::RingtonePlayer {
+public:
+    Media::RingtoneState GetRingtoneState() override
+    {
+        return Media::RingtoneState::STATE_NEW;
+    }
+    int32_t Configure(const float &volume, const bool &loop) override
+    {
+        configureCount++;
+        return TELEPHONY_SUCCESS;
+    }
+    int32_t Start() override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+    int32_t Start(const Media::HapticStartupMode startupMode) override
+    {
+        startCount++;
+        return TELEPHONY_SUCCESS;
+    }
+    int32_t Stop() override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+    int32_t GetAudioRendererInfo(AudioStandard::AudioRendererInfo &rendererInfo) const override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+    std::string GetTitle() override
+    {
+        return "";
+    }
+    int32_t Release() override
+    {
+        releaseCount++;
+        return TELEPHONY_SUCCESS;
+    }
+    int32_t SetRingtonePlayerInterruptCallback(
+        const std::shared_ptr<Media::RingtonePlayerInterruptCallback> &interruptCallback) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+    int32_t SetRingtoneHapticsFeature(const Media::RingtoneHapticsFeature &feature) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+    int32_t SetRingtoneHapticsRamp(int32_t duration, float startIntensity, float endIntensity) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t configureCount = 0;
+    int32_t startCount = 0;
+    int32_t releaseCount = 0;
+};
+
 class CallStateTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -464,6 +523,41 @@ HWTEST_F(CallStateTest, Telephony_AudioSceneProcessor_001, TestSize.Level0)
     ASSERT_TRUE(audioSceneProcessor->SwitchIncoming());
 }
 
+/**
+ * @tc.number   Telephony_AudioEventScheduler_001
+ * @tc.name     test audio event lanes, ordering and collapsing
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateTest, Telephony_AudioEventScheduler_001, TestSize.Level0)
+{
+    AudioEventScheduler scheduler;
+    std::vector<int32_t> executed;
+    auto record = [&executed](int32_t event) { return [&executed, event]() { executed.push_back(event); }; };
+    EXPECT_EQ(AudioEventScheduler::GetLane(AudioEvent::NEW_INCOMING_CALL), AudioEventLane::RING);
+    EXPECT_EQ(AudioEventScheduler::GetLane(AudioEvent::NEW_ACTIVE_CS_CALL), AudioEventLane::ROUTE);
+    EXPECT_FALSE(scheduler.Submit(AudioEvent::NEW_INCOMING_CALL, nullptr));
+
+    EXPECT_TRUE(scheduler.Submit(AudioEvent::NO_MORE_ACTIVE_CALL, record(AudioEvent::NO_MORE_ACTIVE_CALL)));
+    EXPECT_TRUE(scheduler.Submit(AudioEventLane::CLEANUP, AudioEvent::NO_MORE_ACTIVE_CALL, record(0)));
+    EXPECT_TRUE(scheduler.Submit(AudioEvent::SWITCH_HOLDING_STATE, record(AudioEvent::SWITCH_HOLDING_STATE)));
+    EXPECT_FALSE(scheduler.Submit(AudioEvent::SWITCH_CS_CALL_STATE, record(AudioEvent::SWITCH_CS_CALL_STATE)));
+    EXPECT_TRUE(scheduler.Submit(AudioEvent::NEW_INCOMING_CALL, record(AudioEvent::NEW_INCOMING_CALL)));
+    EXPECT_EQ(scheduler.GetPendingCount(), 4);
+    while (scheduler.RunNext()) {}
+    std::vector<int32_t> expected = { AudioEvent::NO_MORE_ACTIVE_CALL, AudioEvent::SWITCH_CS_CALL_STATE,
+        AudioEvent::NEW_INCOMING_CALL, 0 };
+    EXPECT_EQ(executed, expected);
+    EXPECT_FALSE(scheduler.RunNext());
+
+    std::string result;
+    scheduler.Dump(result);
+    EXPECT_NE(result.find("collapsed 1"), std::string::npos);
+    scheduler.ResetStats();
+    result.clear();
+    scheduler.Dump(result);
+    EXPECT_EQ(result.find("count"), std::string::npos);
+}
+
 /**
  * @tc.number   Telephony_Ring_001
  * @tc.name     test error branch
@@ -528,6 +622,133 @@ HWTEST_F(CallStateTest, Telephony_Ring_003, TestSize.Level0)
     ASSERT_NE(ring->Stop(), TELEPHONY_ERR_LOCAL_PTR_NULL);
     #endif
 }
+
+/**
+ * @tc.number   Telephony_Ring_004
+ * @tc.name     test ringtone player prewarm with a fake player source
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateTest, Telephony_Ring_004, TestSize.Level0)
+{
+    auto ring = std::make_shared<Ring>();
+    std::vector<std::pair<int32_t, std::string>> requests;
+    std::vector<std::shared_ptr<FakeRingtonePlayer>> players;
+    ring->ringtonePlayerCreator_ = [&requests, &players](int32_t slotId, const std::string &ringtonePath) {
+        requests.emplace_back(slotId, ringtonePath);
+        players.push_back(std::make_shared<FakeRingtonePlayer>());
+        return std::static_pointer_cast<Media::RingtonePlayer>(players.back());
+    };
+    ring->DoPrewarmRingtonePlayer(DEFAULT_SLOT_ID);
+    ring->DoPrewarmRingtonePlayer(-1);
+    ASSERT_EQ(requests.size(), 1u);
+    EXPECT_EQ(requests[0].first, DEFAULT_SLOT_ID);
+    EXPECT_TRUE(requests[0].second.empty());
+    EXPECT_EQ(players[0]->configureCount, 1);
+    /* 槽位已有预热播放器时不会重复创建 */
+    ring->DoPrewarmRingtonePlayer(DEFAULT_SLOT_ID);
+    EXPECT_EQ(requests.size(), 1u);
+
+    /* 命中: 默认铃声取走预热播放器, 来电专属铃声不取 */
+    EXPECT_EQ(ring->TakePrewarmedPlayer(DEFAULT_SLOT_ID, "contact_ringtone"), nullptr);
+    EXPECT_EQ(ring->TakePrewarmedPlayer(DEFAULT_SLOT_ID, ""), players[0]);
+    EXPECT_EQ(ring->prewarmedPlayers_[DEFAULT_SLOT_ID], nullptr);
+    EXPECT_EQ(ring->TakePrewarmedPlayer(DEFAULT_SLOT_ID, ""), nullptr);
+    EXPECT_EQ(players[0]->releaseCount, 0);
+
+    /* 铃声已更换: 丢弃并释放旧的预热播放器 */
+    ring->DoPrewarmRingtonePlayer(DEFAULT_SLOT_ID);
+    ASSERT_EQ(players.size(), 2u);
+    ring->prewarmedUris_[DEFAULT_SLOT_ID] = "stale_ringtone_uri";
+    EXPECT_EQ(ring->TakePrewarmedPlayer(DEFAULT_SLOT_ID, ""), nullptr);
+    EXPECT_EQ(players[1]->releaseCount, 1);
+
+    /* 预热过程中发生刷新: 预热结果作废并释放 */
+    ring->ringtonePlayerCreator_ = [&ring, &players](int32_t slotId, const std::string &ringtonePath) {
+        ring->ReleasePrewarmedPlayers();
+        players.push_back(std::make_shared<FakeRingtonePlayer>());
+        return std::static_pointer_cast<Media::RingtonePlayer>(players.back());
+    };
+    uint64_t generation = ring->prewarmGeneration_;
+    ring->DoPrewarmRingtonePlayer(DEFAULT_SLOT_ID);
+    ASSERT_EQ(players.size(), 3u);
+    EXPECT_EQ(ring->prewarmGeneration_, generation + 1);
+    EXPECT_EQ(ring->prewarmedPlayers_[DEFAULT_SLOT_ID], nullptr);
+    EXPECT_EQ(players[2]->releaseCount, 1);
+
+    auto &metrics = CallManagerMetrics::GetInstance();
+    uint64_t ringStartCount = metrics.GetHistogramCount(MetricHistogram::RING_START_LATENCY);
+    uint64_t hitCount = metrics.GetCounter(MetricCounter::RINGTONE_PREWARM_HIT);
+    ring->ringtonePlayerCreator_ = [&players](int32_t slotId, const std::string &ringtonePath) {
+        players.push_back(std::make_shared<FakeRingtonePlayer>());
+        return std::static_pointer_cast<Media::RingtonePlayer>(players.back());
+    };
+    ring->DoPrewarmRingtonePlayer(DEFAULT_SLOT_ID);
+    ASSERT_EQ(players.size(), 4u);
+    int32_t result = ring->Play(DEFAULT_SLOT_ID, "", Media::HapticStartupMode::DEFAULT);
+    EXPECT_EQ(metrics.GetHistogramCount(MetricHistogram::RING_START_LATENCY), ringStartCount + 1);
+    if (ring->SystemSoundManager_ != nullptr) {
+        EXPECT_EQ(result, TELEPHONY_SUCCESS);
+        EXPECT_EQ(metrics.GetCounter(MetricCounter::RINGTONE_PREWARM_HIT), hitCount + 1);
+        EXPECT_EQ(ring->RingtonePlayer_, players[3]);
+        /* 预热时已配置, 播放时不再重复配置 */
+        EXPECT_EQ(players[3]->configureCount, 1);
+        EXPECT_EQ(players[3]->startCount, 1);
+    }
+    ring->ReleasePrewarmedPlayers();
+}
+
+/**
+ * @tc.number   Telephony_VolumeRampScheduler_001
+ * @tc.name     test volume ramp ticks, early end and cancel driven by a fake clock
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateTest, Telephony_VolumeRampScheduler_001, TestSize.Level0)
+{
+    FakeCallTaskExecutor fake;
+    auto scheduler = std::make_shared<VolumeRampScheduler>();
+    std::vector<float> applied;
+    VolumeRamp ramp;
+    ramp.startDelayUs = 1000;
+    ramp.intervalUs = 100;
+    ramp.gains = { 0.25f, 0.5f, 1.0f };
+    ramp.onStep = [&applied](size_t step, float gain) {
+        applied.push_back(gain);
+        return true;
+    };
+    EXPECT_EQ(scheduler->Start(VolumeRamp()), INVALID_VOLUME_RAMP_ID);
+
+    uint64_t rampId = scheduler->Start(ramp);
+    EXPECT_TRUE(scheduler->IsRunning(rampId));
+    fake.AdvanceUs(1099);
+    EXPECT_TRUE(applied.empty());
+    fake.AdvanceUs(1);
+    ASSERT_EQ(applied.size(), 1u);
+    EXPECT_FLOAT_EQ(applied[0], 0.25f);
+    fake.AdvanceUs(200);
+    ASSERT_EQ(applied.size(), 3u);
+    EXPECT_FLOAT_EQ(applied[2], 1.0f);
+    EXPECT_FALSE(scheduler->IsRunning(rampId));
+    EXPECT_EQ(fake.GetPendingCount(), 0u);
+
+    applied.clear();
+    uint64_t stoppedRampId = scheduler->Start(ramp);
+    EXPECT_TRUE(scheduler->Cancel(stoppedRampId));
+    rampId = scheduler->Start(ramp);
+    fake.AdvanceUs(1300);
+    EXPECT_EQ(applied.size(), 3u);
+    EXPECT_EQ(scheduler->GetRunningCount(), 0u);
+
+    applied.clear();
+    ramp.onStep = [&applied](size_t step, float gain) {
+        applied.push_back(gain);
+        return step == 0;
+    };
+    rampId = scheduler->Start(ramp);
+    fake.AdvanceUs(2000);
+    EXPECT_EQ(applied.size(), 2u);
+    EXPECT_FALSE(scheduler->IsRunning(rampId));
+    EXPECT_FALSE(scheduler->Cancel(rampId));
+}
 /**
  * @tc.number   Telephony_Tone_001
  * @tc.name     test error branch
@@ -1018,6 +1239,48 @@ HWTEST_F(CallStateTest, Telephony_CallStateProcessor_001, TestSize.Level0)
     ASSERT_EQ(result, false);
 }
 
+/**
+ * @tc.number   Telephony_CallStateProcessor_002
+ * @tc.name     test counted state index, single step moves and the foreground call cache
+ * @tc.desc     Function test
+ */
+HWTEST_F(CallStateTest, Telephony_CallStateProcessor_002, TestSize.Level0)
+{
+    CallStateProcessor processor;
+    EXPECT_EQ(processor.GetAudioForegroundLiveCall(), INVALID_CALLID);
+    processor.AddCall(2, TelCallState::CALL_STATUS_DIALING);
+    processor.AddCall(2, TelCallState::CALL_STATUS_DIALING);
+    EXPECT_EQ(processor.GetCallNumber(TelCallState::CALL_STATUS_DIALING), 1);
+    EXPECT_TRUE(processor.ShouldSwitchState(TelCallState::CALL_STATUS_DIALING));
+    EXPECT_EQ(processor.GetAudioForegroundLiveCall(), 2);
+
+    processor.MoveCall(2, TelCallState::CALL_STATUS_DIALING, TelCallState::CALL_STATUS_ALERTING);
+    EXPECT_EQ(processor.GetCallNumber(TelCallState::CALL_STATUS_DIALING), 0);
+    EXPECT_TRUE(processor.ShouldSwitchState(TelCallState::CALL_STATUS_ALERTING));
+    processor.MoveCall(2, TelCallState::CALL_STATUS_ALERTING, TelCallState::CALL_STATUS_ANSWERED);
+    EXPECT_EQ(processor.GetCurrentActiveCall(), 2);
+    EXPECT_FALSE(processor.ShouldStopSoundtone());
+
+    processor.AddCall(1, TelCallState::CALL_STATUS_WAITING);
+    EXPECT_EQ(processor.GetCallNumber(TelCallState::CALL_STATUS_INCOMING), 1);
+    EXPECT_EQ(processor.GetCallNumber(TelCallState::CALL_STATUS_WAITING), 0);
+    EXPECT_FALSE(processor.ShouldSwitchState(TelCallState::CALL_STATUS_INCOMING));
+    EXPECT_EQ(processor.GetAudioForegroundLiveCall(), 2);
+
+    processor.MoveCall(2, TelCallState::CALL_STATUS_ACTIVE, TelCallState::CALL_STATUS_HOLDING);
+    processor.MoveCall(1, TelCallState::CALL_STATUS_WAITING, TelCallState::CALL_STATUS_ACTIVE);
+    EXPECT_EQ(processor.GetCurrentActiveCall(), 1);
+    EXPECT_EQ(processor.GetCallNumber(TelCallState::CALL_STATUS_HOLDING), 1);
+    EXPECT_FALSE(processor.UpdateCurrentCallState());
+
+    processor.DeleteCall(1, TelCallState::CALL_STATUS_ACTIVE);
+    EXPECT_EQ(processor.GetCurrentActiveCall(), INVALID_CALLID);
+    EXPECT_EQ(processor.GetAudioForegroundLiveCall(), 2);
+    processor.ClearCalls(TelCallState::CALL_STATUS_HOLDING);
+    EXPECT_EQ(processor.GetAudioForegroundLiveCall(), INVALID_CALLID);
+    EXPECT_TRUE(processor.ShouldStopSoundtone());
+}
+
 /**
  * @tc.number   Telephony_CoreServiceConnection_001
  * @tc.name     test error nullptr branch with permission
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "call_data_base_helper.h"
+
+#include "telephony_errors.h"
+
+namespace OHOS {
+namespace Telephony {
+/*
+ * In-process replacement of the contacts, call log and settings DataShare access used by the call report benchmark.
+ * It answers like an empty database so the measured latency never includes a DataShare IPC.
+ */
+CallDataRdbObserver::CallDataRdbObserver(std::vector<std::string> *phones) : phones(phones) {}
+
+CallDataRdbObserver::~CallDataRdbObserver() {}
+
+void CallDataRdbObserver::OnChange() {}
+
+CallDataBaseHelper::CallDataBaseHelper() {}
+
+CallDataBaseHelper::~CallDataBaseHelper() {}
+
+std::shared_ptr<DataShare::DataShareHelper> CallDataBaseHelper::CreateDataShareHelper(std::string uri)
+{
+    return nullptr;
+}
+
+void CallDataBaseHelper::RegisterObserver(std::vector<std::string> *phones) {}
+
+void CallDataBaseHelper::UnRegisterObserver() {}
+
+bool CallDataBaseHelper::Insert(DataShare::DataShareValuesBucket &values)
+{
+    return true;
+}
+
+bool CallDataBaseHelper::Query(std::vector<std::string> *phones, DataShare::DataSharePredicates &predicates)
+{
+    return true;
+}
+
+bool CallDataBaseHelper::Query(ContactInfo &contactInfo, DataShare::DataSharePredicates &predicates)
+{
+    // no contact matches, the caller keeps the number only
+    return false;
+}
+
+bool CallDataBaseHelper::QueryCallLog(
+    std::map<std::string, int32_t> &phonesAndUnreadCountMap, DataShare::DataSharePredicates &predicates)
+{
+    return true;
+}
+
+bool CallDataBaseHelper::QueryAndDeleteLimitedIds(DataShare::DataSharePredicates &predicates)
+{
+    return true;
+}
+
+bool CallDataBaseHelper::Update(DataShare::DataSharePredicates &predicates, DataShare::DataShareValuesBucket &values)
+{
+    return true;
+}
+
+bool CallDataBaseHelper::Delete(DataShare::DataSharePredicates &predicates)
+{
+    return true;
+}
+
+int32_t CallDataBaseHelper::QueryIsBlockPhoneNumber(const std::string &phoneNum, bool &result)
+{
+    result = false;
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CallDataBaseHelper::GetAirplaneMode(bool &isAirplaneModeOn)
+{
+    isAirplaneModeOn = false;
+    return TELEPHONY_SUCCESS;
+}
+
+bool CallDataBaseHelper::CheckResultSet(std::shared_ptr<DataShare::DataShareResultSet> resultSet)
+{
+    return false;
+}
+
+#ifdef TELEPHONY_CUST_SUPPORT
+bool CallDataBaseHelper::QueryContactInfoEnhanced(ContactInfo &contactInfo, DataShare::DataSharePredicates &predicates)
+{
+    return true;
+}
+
+int CallDataBaseHelper::GetCallerIndex(std::shared_ptr<DataShare::DataShareResultSet> resultSet,
+    std::string phoneNumber)
+{
+    return 0;
+}
+#endif
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,803 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "call_ability_callback.h"
+#include "call_ability_report_proxy.h"
+#include "call_control_manager.h"
+#include "call_manager_callback.h"
+#include "call_manager_hisysevent.h"
+#include "bluetooth_call_service.h"
+#include "call_manager_utils.h"
+#include "call_object_manager.h"
+#include "call_state_processor.h"
+#include "call_status_callback.h"
+#include "cellular_call_connection.h"
+#include "cellular_call_proxy.h"
+#include "edm_call_policy.h"
+#include "ffrt.h"
+#include "gtest/gtest.h"
+#include "ims_call.h"
+#include "report_call_info_handler.h"
+#include "securec.h"
+#include "telephony_errors.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+constexpr int32_t SLOT_ID_0 = 0;
+constexpr int32_t SLOT_ID_1 = 1;
+constexpr int32_t BENCHMARK_ROUNDS = 20;
+constexpr int32_t CALL_STATE_QUERY_ROUNDS = 10000;
+constexpr int32_t MARSHAL_ROUNDS = 2000;
+constexpr int32_t CALL_LIFECYCLE_ROUNDS = 2000;
+constexpr int32_t EDM_POLICY_LIST_SIZE = 1000;
+constexpr int32_t EDM_POLICY_QUERY_ROUNDS = 10000;
+constexpr int32_t CALLS_REPORT_ROUNDS = 2000;
+const int32_t CALLS_PER_REPORT[] = { 1, 5, 10 };
+const int32_t SUBSCRIBER_COUNTS[] = { 1, 5, 20 };
+constexpr int32_t PERCENTILE_50 = 50;
+constexpr int32_t PERCENTILE_99 = 99;
+constexpr int32_t PERCENT = 100;
+constexpr int64_t US_PER_SECOND = 1000000;
+constexpr int64_t NS_PER_US = 1000;
+constexpr std::chrono::milliseconds REPORT_TIMEOUT(1000);
+const std::string BENCHMARK_BUNDLE = "com.ohos.callreportbenchmark";
+const std::string BENCHMARK_NUMBER_0 = "10086";
+const std::string BENCHMARK_NUMBER_1 = "10010";
+} // namespace
+
+/**
+ * In-process subscriber which timestamps every call state report it receives.
+ */
+class BenchmarkCallManagerCallback : public CallManagerCallback {
+public:
+    int32_t OnCallDetailsChange(const CallAttributeInfo &info) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reports_.push_back({ info.accountId, info.callState, Clock::now() });
+        cv_.notify_all();
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnCallEventChange(const CallEventInfo &info) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnCallDisconnectedCause(const DisconnectedDetails &details) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnReportAsyncResults(CallResultReportId reportId, AppExecFwk::PacMap &resultInfo) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnOttCallRequest(OttCallRequestId requestId, AppExecFwk::PacMap &info) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnReportMmiCodeResult(const MmiCodeInfo &info) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnReportAudioDeviceChange(const AudioDeviceInfo &info) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnReportPostDialDelay(const std::string &str) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnUpdateImsCallModeChange(const CallMediaModeInfo &imsCallModeInfo) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnCallSessionEventChange(const CallSessionEvent &callSessionEventOptions) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnPeerDimensionsChange(const PeerDimensionsDetail &peerDimensionsDetail) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnCallDataUsageChange(const int64_t dataUsage) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    int32_t OnUpdateCameraCapabilities(const CameraCapabilities &cameraCapabilities) override
+    {
+        return TELEPHONY_SUCCESS;
+    }
+
+    size_t GetReportCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return reports_.size();
+    }
+
+    bool WaitForReport(size_t fromIndex, int32_t slotId, TelCallState state, Clock::time_point &reportTime)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        size_t next = fromIndex;
+        auto matched = [&]() {
+            for (; next < reports_.size(); next++) {
+                if (reports_[next].slotId == slotId && reports_[next].state == state) {
+                    reportTime = reports_[next].time;
+                    return true;
+                }
+            }
+            return false;
+        };
+        return cv_.wait_for(lock, REPORT_TIMEOUT, matched);
+    }
+
+private:
+    struct Report {
+        int32_t slotId;
+        TelCallState state;
+        Clock::time_point time;
+    };
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Report> reports_;
+};
+
+/**
+ * In-process cellular_call service which accepts every request, so no report waits for the real modem stack.
+ */
+class BenchmarkCellularCallStub : public IRemoteObject {
+public:
+    BenchmarkCellularCallStub() : IRemoteObject(u"default") {}
+
+    int SendRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        reply.WriteInt32(TELEPHONY_SUCCESS);
+        return 0;
+    }
+
+    int32_t GetObjectRefCount() override
+    {
+        return 0;
+    }
+
+    bool AddDeathRecipient(const sptr<DeathRecipient> &recipient) override
+    {
+        return true;
+    }
+
+    bool RemoveDeathRecipient(const sptr<DeathRecipient> &recipient) override
+    {
+        return true;
+    }
+
+    int Dump(int fd, const std::vector<std::u16string> &args) override
+    {
+        return 0;
+    }
+};
+
+struct BenchmarkStep {
+    CallDetailsInfo report;
+    TelCallState expectState;
+};
+
+struct BenchmarkResult {
+    size_t samples = 0;
+    size_t timeouts = 0;
+    int64_t wallUs = 0;
+    int64_t p50Us = 0;
+    int64_t p99Us = 0;
+};
+
+class CallReportBenchmarkTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+    static CallDetailInfo MakeCall(int32_t slotId, int32_t index, TelCallState state, const std::string &number,
+        int32_t mpty = 0);
+    static CallDetailsInfo MakeReport(int32_t slotId, std::vector<CallDetailInfo> calls);
+    BenchmarkResult Run(const std::string &name, const std::vector<BenchmarkStep> &steps);
+    void ResetCallState();
+
+protected:
+    static BenchmarkCallManagerCallback *subscriber_;
+    static sptr<CallAbilityCallback> callAbilityCallback_;
+};
+
+BenchmarkCallManagerCallback *CallReportBenchmarkTest::subscriber_ = nullptr;
+sptr<CallAbilityCallback> CallReportBenchmarkTest::callAbilityCallback_ = nullptr;
+
+void CallReportBenchmarkTest::SetUpTestCase()
+{
+    auto cellularCallConnection = DelayedSingleton<CellularCallConnection>::GetInstance();
+    cellularCallConnection->cellularCallInterfacePtr_ = new CellularCallProxy(new BenchmarkCellularCallStub());
+    cellularCallConnection->connectState_ = true;
+    DelayedSingleton<CallControlManager>::GetInstance()->Init();
+    DelayedSingleton<ReportCallInfoHandler>::GetInstance()->Init();
+    callAbilityCallback_ = new (std::nothrow) CallAbilityCallback();
+    ASSERT_NE(callAbilityCallback_, nullptr);
+    std::unique_ptr<BenchmarkCallManagerCallback> subscriber = std::make_unique<BenchmarkCallManagerCallback>();
+    subscriber_ = subscriber.get();
+    callAbilityCallback_->SetProcessCallback(std::move(subscriber));
+    DelayedSingleton<CallAbilityReportProxy>::GetInstance()->RegisterCallBack(callAbilityCallback_, BENCHMARK_BUNDLE);
+}
+
+void CallReportBenchmarkTest::TearDownTestCase()
+{
+    DelayedSingleton<CallAbilityReportProxy>::GetInstance()->UnRegisterCallBack(BENCHMARK_BUNDLE);
+    subscriber_ = nullptr;
+    callAbilityCallback_ = nullptr;
+    auto cellularCallConnection = DelayedSingleton<CellularCallConnection>::GetInstance();
+    cellularCallConnection->cellularCallInterfacePtr_ = nullptr;
+    cellularCallConnection->connectState_ = false;
+}
+
+void CallReportBenchmarkTest::SetUp()
+{
+    ResetCallState();
+}
+
+void CallReportBenchmarkTest::TearDown()
+{
+    ResetCallState();
+}
+
+void CallReportBenchmarkTest::ResetCallState()
+{
+    CallObjectManager::callObjectPtrList_.clear();
+    auto callStatusManager = DelayedSingleton<ReportCallInfoHandler>::GetInstance()->callStatusManagerPtr_;
+    if (callStatusManager == nullptr) {
+        return;
+    }
+    for (int32_t i = 0; i < SLOT_NUM; i++) {
+        callStatusManager->callDetailsInfo_[i].callVec.clear();
+        callStatusManager->tmpCallDetailsInfo_[i].callVec.clear();
+    }
+}
+
+CallDetailInfo CallReportBenchmarkTest::MakeCall(
+    int32_t slotId, int32_t index, TelCallState state, const std::string &number, int32_t mpty)
+{
+    CallDetailInfo info;
+    info.index = index;
+    info.accountId = slotId;
+    info.state = state;
+    info.mpty = mpty;
+    info.callType = CallType::TYPE_IMS;
+    info.callMode = VideoStateType::TYPE_VOICE;
+    (void)memcpy_s(info.phoneNum, kMaxNumberLen, number.c_str(), number.length());
+    return info;
+}
+
+CallDetailsInfo CallReportBenchmarkTest::MakeReport(int32_t slotId, std::vector<CallDetailInfo> calls)
+{
+    CallDetailsInfo report;
+    report.slotId = slotId;
+    report.callVec = std::move(calls);
+    return report;
+}
+
+/**
+ * Runs body for the given number of rounds and returns the mean cost of one round in nanoseconds.
+ */
+template<typename Body>
+static int64_t MeasureNs(int32_t rounds, Body &&body)
+{
+    Clock::time_point begin = Clock::now();
+    for (int32_t round = 0; round < rounds; round++) {
+        body();
+    }
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count() / rounds;
+}
+
+BenchmarkResult CallReportBenchmarkTest::Run(const std::string &name, const std::vector<BenchmarkStep> &steps)
+{
+    BenchmarkResult result;
+    std::vector<int64_t> latencies;
+    auto handler = DelayedSingleton<ReportCallInfoHandler>::GetInstance();
+    Clock::time_point begin = Clock::now();
+    for (int32_t round = 0; round < BENCHMARK_ROUNDS; round++) {
+        ResetCallState();
+        for (const auto &step : steps) {
+            size_t fromIndex = subscriber_->GetReportCount();
+            CallDetailsInfo report = step.report;
+            Clock::time_point sendTime = Clock::now();
+            EXPECT_EQ(handler->UpdateCallsReportInfo(report), TELEPHONY_SUCCESS);
+            Clock::time_point reportTime;
+            if (!subscriber_->WaitForReport(fromIndex, report.slotId, step.expectState, reportTime)) {
+                result.timeouts++;
+                continue;
+            }
+            latencies.push_back(std::chrono::duration_cast<std::chrono::microseconds>(reportTime - sendTime).count());
+        }
+    }
+    result.wallUs = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin).count();
+    result.samples = latencies.size();
+    if (!latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+        result.p50Us = latencies[(latencies.size() - 1) * PERCENTILE_50 / PERCENT];
+        result.p99Us = latencies[(latencies.size() - 1) * PERCENTILE_99 / PERCENT];
+    }
+    // reports per second of wall time, including the rounds' state resets and any timed out step
+    int64_t throughput = result.wallUs > 0 ? static_cast<int64_t>(result.samples) * US_PER_SECOND / result.wallUs : 0;
+    TELEPHONY_LOGI("benchmark %{public}s: samples %{public}zu, timeouts %{public}zu, throughput %{public}lld "
+        "reports/s, p50 %{public}lld us, p99 %{public}lld us", name.c_str(), result.samples, result.timeouts,
+        static_cast<long long>(throughput), static_cast<long long>(result.p50Us),
+        static_cast<long long>(result.p99Us));
+    std::cout << "[ BENCH    ] " << name << " samples=" << result.samples << " timeouts=" << result.timeouts
+              << " throughput=" << throughput << "/s p50=" << result.p50Us << "us p99=" << result.p99Us << "us"
+              << std::endl;
+    EXPECT_EQ(result.timeouts, 0u) << name << " lost call state reports";
+    return result;
+}
+
+/**
+ * Writes a calls report for a conference of callCount active calls in the layout of the cellular call proxy.
+ */
+static void WriteCallsReport(int32_t callCount, MessageParcel &data)
+{
+    data.WriteInt32(callCount);
+    for (int32_t i = 0; i < callCount; i++) {
+        data.WriteInt32(i + 1);
+        data.WriteCString(BENCHMARK_NUMBER_0.c_str());
+        data.WriteInt32(SLOT_ID_0);
+        data.WriteInt32(static_cast<int32_t>(CallType::TYPE_IMS));
+        data.WriteInt32(static_cast<int32_t>(VideoStateType::TYPE_VOICE));
+        data.WriteInt32(static_cast<int32_t>(TelCallState::CALL_STATUS_ACTIVE));
+        data.WriteInt32(0);
+        data.WriteInt32(callCount > 1 ? 1 : 0);
+        data.WriteInt32(0);
+        data.WriteInt32(0);
+        data.WriteInt32(0);
+        data.WriteString("");
+        data.WriteInt32(0);
+        data.WriteInt32(static_cast<int32_t>(DisconnectedReason::FAILED_UNKNOWN));
+        data.WriteString("");
+        data.WriteInt32(0);
+        data.WriteInt32(static_cast<int32_t>(RttCallState::RTT_STATE_NO));
+        data.WriteInt32(-1);
+        data.WriteInt32(0);
+    }
+    data.WriteInt32(SLOT_ID_0);
+}
+
+/**
+ * Copy of the calls report path before the direct decode, kept as the baseline of the decode benchmark. The stub
+ * decoded into CallsReportInfo, the callback converted a copy of it to CallDetailsInfo, the handler copied that
+ * once more and the queued task captured a third copy.
+ */
+static void LegacyDecodeCallsReport(
+    MessageParcel &data, const std::shared_ptr<CallStatusCallback> &statusCallback, ffrt::queue &reportQueue)
+{
+    int32_t cnt = data.ReadInt32();
+    CallsReportInfo callReportInfo;
+    for (int32_t i = 0; i < cnt; i++) {
+        CallReportInfo parcelPtr;
+        statusCallback->BuildCallReportInfo(data, parcelPtr);
+        callReportInfo.callVec.push_back(parcelPtr);
+    }
+    callReportInfo.slotId = data.ReadInt32();
+
+    CallDetailsInfo detailsInfo;
+    CallDetailInfo detailInfo;
+    detailInfo.index = 0;
+    detailInfo.state = TelCallState::CALL_STATUS_UNKNOWN;
+    CallsReportInfo callsInfo = callReportInfo;
+    for (auto it = callsInfo.callVec.begin(); it != callsInfo.callVec.end(); ++it) {
+        detailInfo.callType = (*it).callType;
+        detailInfo.accountId = (*it).accountId;
+        detailInfo.index = (*it).index;
+        detailInfo.state = (*it).state;
+        detailInfo.callMode = (*it).callMode;
+        detailInfo.voiceDomain = (*it).voiceDomain;
+        detailInfo.mpty = (*it).mpty;
+        detailInfo.crsType = (*it).crsType;
+        detailInfo.originalCallType = (*it).originalCallType;
+        (void)memcpy_s(detailInfo.phoneNum, kMaxNumberLen, (*it).accountNum, kMaxNumberLen);
+        (void)memset_s(detailInfo.bundleName, kMaxBundleNameLen, 0, kMaxBundleNameLen);
+        detailInfo.name = (*it).name;
+        detailInfo.namePresentation = (*it).namePresentation;
+        detailInfo.reason = (*it).reason;
+        detailInfo.message = (*it).message;
+        detailInfo.newCallUseBox = (*it).newCallUseBox;
+        detailInfo.rttState = (*it).rttState;
+        detailInfo.rttChannelId = (*it).rttChannelId;
+        detailInfo.imsDomain = (*it).imsDomain;
+        detailsInfo.callVec.push_back(detailInfo);
+    }
+    detailsInfo.slotId = callsInfo.slotId;
+    CallManagerHisysevent::WriteCallStateBehaviorEvent(
+        detailsInfo.slotId, static_cast<int32_t>(detailInfo.state), detailInfo.index);
+    (void)memset_s(detailsInfo.bundleName, kMaxBundleNameLen, 0, kMaxBundleNameLen);
+
+    CallDetailsInfo callDetailsInfo;
+    callDetailsInfo.slotId = detailsInfo.slotId;
+    (void)memcpy_s(callDetailsInfo.bundleName, kMaxBundleNameLen, detailsInfo.bundleName, kMaxBundleNameLen);
+    for (auto iter = detailsInfo.callVec.begin(); iter != detailsInfo.callVec.end(); ++iter) {
+        callDetailsInfo.callVec.push_back(*iter);
+    }
+    // 只统计解码与入队的开销, 队列任务本身不处理上报
+    reportQueue.submit([callDetailsInfo]() { (void)callDetailsInfo.callVec.size(); });
+}
+
+/**
+ * The direct decode of OnUpdateCallsReportInfo with the same no-op sink as the legacy copy, so both sides of the
+ * benchmark pay for decoding, the behavior event and one enqueue only.
+ */
+static void DirectDecodeCallsReport(
+    MessageParcel &data, const std::shared_ptr<CallStatusCallback> &statusCallback, ffrt::queue &reportQueue)
+{
+    int32_t cnt = data.ReadInt32();
+    CallDetailsInfo detailsInfo;
+    detailsInfo.callVec.reserve(cnt);
+    for (int32_t i = 0; i < cnt; i++) {
+        detailsInfo.callVec.emplace_back();
+        statusCallback->BuildCallDetailInfo(data, detailsInfo.callVec.back());
+    }
+    detailsInfo.slotId = data.ReadInt32();
+    if (!detailsInfo.callVec.empty()) {
+        const CallDetailInfo &detailInfo = detailsInfo.callVec.back();
+        CallManagerHisysevent::WriteCallStateBehaviorEvent(
+            detailsInfo.slotId, static_cast<int32_t>(detailInfo.state), detailInfo.index);
+    }
+    reportQueue.submit([detailsInfo = std::move(detailsInfo)]() { (void)detailsInfo.callVec.size(); });
+}
+
+/**
+ * @tc.number   Telephony_CallReportBenchmark_Incoming_001
+ * @tc.name     incoming, answer and remote hang up
+ * @tc.desc     Performance test
+ */
+HWTEST_F(CallReportBenchmarkTest, Telephony_CallReportBenchmark_Incoming_001, TestSize.Level2)
+{
+    std::vector<BenchmarkStep> steps = {
+        { MakeReport(SLOT_ID_0, { MakeCall(SLOT_ID_0, 1, TelCallState::CALL_STATUS_INCOMING, BENCHMARK_NUMBER_0) }),
+            TelCallState::CALL_STATUS_INCOMING },
+        { MakeReport(SLOT_ID_0, { MakeCall(SLOT_ID_0, 1, TelCallState::CALL_STATUS_ACTIVE, BENCHMARK_NUMBER_0) }),
+            TelCallState::CALL_STATUS_ACTIVE },
+        { MakeReport(SLOT_ID_0, {}), TelCallState::CALL_STATUS_DISCONNECTED },
+    };
+    BenchmarkResult result = Run("incoming", steps);
+    EXPECT_EQ(result.samples, steps.size() * BENCHMARK_ROUNDS);
+}
+
+/**
+ * @tc.number   Telephony_CallReportBenchmark_Dial_001
+ * @tc.name     dialing, alerting, active and hang up
+ * @tc.desc     Performance test
+ */
+HWTEST_F(CallReportBenchmarkTest, Telephony_CallReportBenchmark_Dial_001, TestSize.Level2)
+{
+    std::vector<BenchmarkStep> steps = {
+        { MakeReport(SLOT_ID_0, { MakeCall(SLOT_ID_0, 1, TelCallState::CALL_STATUS_DIALING, BENCHMARK_NUMBER_0) }),
+            TelCallState::CALL_STATUS_DIALING },
+        { MakeReport(SLOT_ID_0, { MakeCall(SLOT_ID_0, 1, TelCallState::CALL_STATUS_ALERTING, BENCHMARK_NUMBER_0) }),
+            TelCallState::CALL_STATUS_ALERTING },
+        { MakeReport(SLOT_ID_0, { MakeCall(SLOT_ID_0, 1, TelCallState::CALL_STATUS_ACTIVE, BENCHMARK_NUMBER_0) }),
+            TelCallState::CALL_STATUS_ACTIVE },
+        { MakeReport(SLOT_ID_0, {}), TelCallState::CALL_STATUS_DISCONNECTED },
+    };
+    BenchmarkResult result = Run("dial", steps);
+    EXPECT_EQ(result.samples, steps.size() * BENCHMARK_ROUNDS);
+}
+
+/**
+ * @tc.number   Telephony_CallReportBenchmark_Conference_001
+ * @tc.name     two calls merged into a conference and hung up
+ * @tc.desc     Performance test
+ */
+HWTEST_F(CallReportBenchmarkTest, Telephony_CallReportBenchmark_Conference_001, TestSize.Level2)
+{
+    std::vector<BenchmarkStep> steps = {
+        { MakeReport(SLOT_ID_0, { MakeCall(SLOT_ID_0, 1, TelCallState::CALL_STATUS_ACTIVE, BENCHMARK_NUMBER_0) }),
+            TelCallState::CALL_STATUS_ACTIVE },
+        { MakeReport(SLOT_ID_0, { MakeCall(SLOT_ID_0, 1, TelCallState::CALL_STATUS_HOLDING, BENCHMARK_NUMBER_0),
+            MakeCall(SLOT_ID_0, 2, TelCallState::CALL_STATUS_DIALING, BENCHMARK_NUMBER_1) }),
+            TelCallState::CALL_STATUS_DIALING },
+        { MakeReport(SLOT_ID_0, { MakeCall(SLOT_ID_0, 1, TelCallState::CALL_STATUS_HOLDING, BENCHMARK_NUMBER_0),
+            MakeCall(SLOT_ID_0, 2, TelCallState::CALL_STATUS_ACTIVE, BENCHMARK_NUMBER_1) }),
+            TelCallState::CALL_STATUS_ACTIVE },
+        { MakeReport(SLOT_ID_0, { MakeCall(SLOT_ID_0, 1, TelCallState::CALL_STATUS_ACTIVE, BENCHMARK_NUMBER_0, 1),
+            MakeCall(SLOT_ID_0, 2, TelCallState::CALL_STATUS_ACTIVE, BENCHMARK_NUMBER_1, 1) }),
+            TelCallState::CALL_STATUS_ACTIVE },
+        { MakeReport(SLOT_ID_0, {}), TelCallState::CALL_STATUS_DISCONNECTED },
+    };
+    BenchmarkResult result = Run("conference", steps);
+    EXPECT_EQ(result.samples, steps.size() * BENCHMARK_ROUNDS);
+}
+
+/**
+ * @tc.number   Telephony_CallReportBenchmark_MultiSim_001
+ * @tc.name     call waiting on the second SIM while the first one is active
+ * @tc.desc     Performance test
+ */
+HWTEST_F(CallReportBenchmarkTest, Telephony_CallReportBenchmark_MultiSim_001, TestSize.Level2)
+{
+    std::vector<BenchmarkStep> steps = {
+        { MakeReport(SLOT_ID_0, { MakeCall(SLOT_ID_0, 1, TelCallState::CALL_STATUS_ACTIVE, BENCHMARK_NUMBER_0) }),
+            TelCallState::CALL_STATUS_ACTIVE },
+        { MakeReport(SLOT_ID_1, { MakeCall(SLOT_ID_1, 1, TelCallState::CALL_STATUS_INCOMING, BENCHMARK_NUMBER_1) }),
+            TelCallState::CALL_STATUS_WAITING },
+        { MakeReport(SLOT_ID_1, {}), TelCallState::CALL_STATUS_DISCONNECTED },
+        { MakeReport(SLOT_ID_0, {}), TelCallState::CALL_STATUS_DISCONNECTED },
+    };
+    BenchmarkResult result = Run("multi_sim", steps);
+    EXPECT_EQ(result.samples, steps.size() * BENCHMARK_ROUNDS);
+}
+
+/**
+ * @tc.number   Telephony_CallReportBenchmark_BtCallState_001
+ * @tc.name     bluetooth HFP call state query with several calls present
+ * @tc.desc     Performance test
+ */
+HWTEST_F(CallReportBenchmarkTest, Telephony_CallReportBenchmark_BtCallState_001, TestSize.Level2)
+{
+    const TelCallState callStates[] = { TelCallState::CALL_STATUS_ACTIVE, TelCallState::CALL_STATUS_HOLDING,
+        TelCallState::CALL_STATUS_WAITING, TelCallState::CALL_STATUS_DIALING, TelCallState::CALL_STATUS_ACTIVE,
+        TelCallState::CALL_STATUS_DISCONNECTING };
+    int32_t callId = 1;
+    for (TelCallState state : callStates) {
+        DialParaInfo paraInfo;
+        paraInfo.callId = callId++;
+        paraInfo.number = BENCHMARK_NUMBER_0;
+        sptr<CallBase> call = new (std::nothrow) IMSCall(paraInfo);
+        ASSERT_NE(call, nullptr);
+        call->callState_ = state;
+        CallObjectManager::callObjectPtrList_.push_back(call);
+    }
+    const TelCallState queryStates[] = { TelCallState::CALL_STATUS_ACTIVE, TelCallState::CALL_STATUS_HOLDING,
+        TelCallState::CALL_STATUS_DIALING, TelCallState::CALL_STATUS_ALERTING, TelCallState::CALL_STATUS_INCOMING,
+        TelCallState::CALL_STATUS_WAITING, TelCallState::CALL_STATUS_DISCONNECTED,
+        TelCallState::CALL_STATUS_DISCONNECTING };
+    std::string number;
+    int64_t perStateScanNs = MeasureNs(CALL_STATE_QUERY_ROUNDS, [&queryStates, &number]() {
+        for (TelCallState state : queryStates) {
+            if (CallObjectManager::GetCallNum(state, true) > 0) {
+                number = CallObjectManager::GetCallNumber(state, true);
+            }
+        }
+        (void)CallObjectManager::GetVoipCallInfo();
+    });
+
+    BluetoothCallService bluetoothCallService;
+    std::vector<int32_t> callInfo;
+    int64_t censusNs = MeasureNs(CALL_STATE_QUERY_ROUNDS, [&bluetoothCallService, &callInfo, &number]() {
+        int32_t callState = static_cast<int32_t>(TelCallState::CALL_STATUS_IDLE);
+        CallStateCensus census;
+        CallObjectManager::GetCallStateCensus(census, true);
+        callInfo = bluetoothCallService.getCallInfoNum(census, callState, number);
+    });
+    std::cout << "[ BENCH    ] bt_call_state calls=" << callId - 1 << " per_state_scan=" << perStateScanNs
+              << "ns census=" << censusNs << "ns" << std::endl;
+    ASSERT_EQ(callInfo.size(), 2u);
+    EXPECT_EQ(callInfo[0], 2);
+    EXPECT_EQ(callInfo[1], 1);
+    EXPECT_EQ(number, BENCHMARK_NUMBER_0);
+}
+
+/**
+ * @tc.number   Telephony_CallReportBenchmark_Marshal_001
+ * @tc.name     marshal one call state report for 1, 5 and 20 subscribers
+ * @tc.desc     Performance test
+ */
+HWTEST_F(CallReportBenchmarkTest, Telephony_CallReportBenchmark_Marshal_001, TestSize.Level2)
+{
+    const TelCallState callStates[] = { TelCallState::CALL_STATUS_ACTIVE, TelCallState::CALL_STATUS_HOLDING,
+        TelCallState::CALL_STATUS_INCOMING };
+    int32_t callId = 1;
+    for (TelCallState state : callStates) {
+        DialParaInfo paraInfo;
+        paraInfo.callId = callId++;
+        paraInfo.number = BENCHMARK_NUMBER_1;
+        sptr<CallBase> call = new (std::nothrow) IMSCall(paraInfo);
+        ASSERT_NE(call, nullptr);
+        call->callState_ = state;
+        CallObjectManager::callObjectPtrList_.push_back(call);
+    }
+    CallAttributeInfo info;
+    CallObjectManager::callObjectPtrList_.back()->GetCallAttributeInfo(info);
+    for (int32_t subscribers : SUBSCRIBER_COUNTS) {
+        int64_t perEventNs = MeasureNs(MARSHAL_ROUNDS, [&info, subscribers]() {
+            for (int32_t i = 0; i < subscribers; i++) {
+                MessageParcel dataParcel;
+                CallManagerUtils::WriteCallAttributeInfo(info, dataParcel);
+            }
+        });
+        int64_t premarshalledNs = MeasureNs(MARSHAL_ROUNDS, [&info, subscribers]() {
+            CallAttributeInfoParcel infoParcel(info);
+            for (int32_t i = 0; i < subscribers; i++) {
+                MessageParcel dataParcel;
+                infoParcel.WriteTo(dataParcel);
+            }
+        });
+        std::cout << "[ BENCH    ] marshal subscribers=" << subscribers << " per_subscriber=" << perEventNs
+                  << "ns premarshalled=" << premarshalledNs << "ns" << std::endl;
+    }
+    MessageParcel expected;
+    CallManagerUtils::WriteCallAttributeInfo(info, expected);
+    MessageParcel actual;
+    ASSERT_TRUE(CallAttributeInfoParcel(info).WriteTo(actual));
+    ASSERT_EQ(actual.GetDataSize(), expected.GetDataSize());
+    EXPECT_EQ(memcmp(reinterpret_cast<const void *>(actual.GetData()),
+        reinterpret_cast<const void *>(expected.GetData()), expected.GetDataSize()), 0);
+}
+
+/**
+ * Replays an outgoing call (dialing, alerting, active, holding, end) and a second incoming call (incoming, active,
+ * end) against the processor, reading the per event audio checks after every transition.
+ */
+static int32_t ReplayCallLifecycles(CallStateProcessor &processor, bool useMove)
+{
+    struct Transition {
+        int32_t callId;
+        TelCallState priorState;
+        TelCallState nextState;
+    };
+    const Transition transitions[] = {
+        { 1, TelCallState::CALL_STATUS_IDLE, TelCallState::CALL_STATUS_DIALING },
+        { 1, TelCallState::CALL_STATUS_DIALING, TelCallState::CALL_STATUS_ALERTING },
+        { 1, TelCallState::CALL_STATUS_ALERTING, TelCallState::CALL_STATUS_ACTIVE },
+        { 2, TelCallState::CALL_STATUS_IDLE, TelCallState::CALL_STATUS_WAITING },
+        { 1, TelCallState::CALL_STATUS_ACTIVE, TelCallState::CALL_STATUS_HOLDING },
+        { 2, TelCallState::CALL_STATUS_WAITING, TelCallState::CALL_STATUS_ACTIVE },
+        { 2, TelCallState::CALL_STATUS_ACTIVE, TelCallState::CALL_STATUS_DISCONNECTED },
+        { 1, TelCallState::CALL_STATUS_HOLDING, TelCallState::CALL_STATUS_DISCONNECTED },
+    };
+    int32_t checks = 0;
+    for (const Transition &transition : transitions) {
+        if (useMove) {
+            processor.MoveCall(transition.callId, transition.priorState, transition.nextState);
+        } else {
+            processor.AddCall(transition.callId, transition.nextState);
+            processor.DeleteCall(transition.callId, transition.priorState);
+        }
+        checks += processor.ShouldSwitchState(transition.nextState) ? 1 : 0;
+        checks += processor.GetCallNumber(transition.priorState);
+        checks += processor.GetAudioForegroundLiveCall();
+        checks += processor.GetCurrentActiveCall();
+    }
+    return checks;
+}
+
+/**
+ * @tc.number   Telephony_CallReportBenchmark_CallStateProcessor_001
+ * @tc.name     replay call lifecycles through the audio call state index
+ * @tc.desc     Performance test
+ */
+HWTEST_F(CallReportBenchmarkTest, Telephony_CallReportBenchmark_CallStateProcessor_001, TestSize.Level2)
+{
+    CallStateProcessor pairProcessor;
+    int32_t pairChecks = 0;
+    int64_t addDeleteNs = MeasureNs(CALL_LIFECYCLE_ROUNDS, [&pairProcessor, &pairChecks]() {
+        pairChecks += ReplayCallLifecycles(pairProcessor, false);
+    });
+
+    CallStateProcessor moveProcessor;
+    int32_t moveChecks = 0;
+    int64_t moveNs = MeasureNs(CALL_LIFECYCLE_ROUNDS, [&moveProcessor, &moveChecks]() {
+        moveChecks += ReplayCallLifecycles(moveProcessor, true);
+    });
+
+    bool shouldStop = false;
+    int64_t readNs = MeasureNs(CALL_STATE_QUERY_ROUNDS, [&moveProcessor, &shouldStop]() {
+        shouldStop = moveProcessor.ShouldStopSoundtone() && !moveProcessor.ShouldSwitchState(
+            TelCallState::CALL_STATUS_ACTIVE);
+    });
+    std::cout << "[ BENCH    ] call_state_processor add_delete=" << addDeleteNs << "ns move=" << moveNs
+              << "ns read=" << readNs << "ns" << std::endl;
+    EXPECT_TRUE(shouldStop);
+    EXPECT_EQ(pairChecks, moveChecks);
+    EXPECT_EQ(moveProcessor.GetAudioForegroundLiveCall(), INVALID_CALLID);
+    EXPECT_EQ(moveProcessor.GetCallNumber(TelCallState::CALL_STATUS_HOLDING), 0);
+}
+
+/**
+ * @tc.number   Telephony_CallReportBenchmark_EdmPolicy_001
+ * @tc.name     look up numbers against a full EDM block list
+ * @tc.desc     Performance test
+ */
+HWTEST_F(CallReportBenchmarkTest, Telephony_CallReportBenchmark_EdmPolicy_001, TestSize.Level2)
+{
+    std::vector<std::string> blockList;
+    for (int32_t i = 0; i < EDM_POLICY_LIST_SIZE; i++) {
+        blockList.push_back("1380000" + std::to_string(EDM_POLICY_LIST_SIZE + i));
+    }
+    EdmCallPolicy edmCallPolicy;
+    int32_t setResult = TELEPHONY_ERR_FAIL;
+    int64_t setNs = MeasureNs(1, [&edmCallPolicy, &blockList, &setResult]() {
+        setResult = edmCallPolicy.SetCallPolicy(false, blockList, false, blockList);
+    });
+    ASSERT_EQ(setResult, TELEPHONY_ERR_SUCCESS);
+
+    const std::vector<std::string> variants = { "13800001999", "13800001000", "13800000999", "13900000000" };
+    int32_t blocked = 0;
+    int64_t lookupNs = MeasureNs(EDM_POLICY_QUERY_ROUNDS, [&edmCallPolicy, &variants, &blocked]() {
+        for (const auto &number : variants) {
+            blocked += edmCallPolicy.IsDialingEnable(number) ? 0 : 1;
+        }
+    }) / static_cast<int64_t>(variants.size());
+    std::cout << "[ BENCH    ] edm_policy list=" << EDM_POLICY_LIST_SIZE << " set=" << setNs / NS_PER_US
+              << "us lookup=" << lookupNs << "ns" << std::endl;
+    EXPECT_EQ(blocked, EDM_POLICY_QUERY_ROUNDS * 2);
+}
+
+/**
+ * @tc.number   Telephony_CallReportBenchmark_CallsReportDecode_001
+ * @tc.name     decode and enqueue calls reports with 1, 5 and 10 calls
+ * @tc.desc     Performance test
+ */
+HWTEST_F(CallReportBenchmarkTest, Telephony_CallReportBenchmark_CallsReportDecode_001, TestSize.Level2)
+{
+    std::shared_ptr<CallStatusCallback> statusCallback = std::make_shared<CallStatusCallback>();
+    for (int32_t callCount : CALLS_PER_REPORT) {
+        MessageParcel data;
+        WriteCallsReport(callCount, data);
+        int64_t legacyNs = 0;
+        {
+            ffrt::queue legacyQueue { "calls_report_legacy" };
+            legacyNs = MeasureNs(CALLS_REPORT_ROUNDS, [&data, &statusCallback, &legacyQueue]() {
+                data.RewindRead(0);
+                LegacyDecodeCallsReport(data, statusCallback, legacyQueue);
+            });
+        }
+        int64_t directNs = 0;
+        {
+            ffrt::queue directQueue { "calls_report_direct" };
+            directNs = MeasureNs(CALLS_REPORT_ROUNDS, [&data, &statusCallback, &directQueue]() {
+                data.RewindRead(0);
+                DirectDecodeCallsReport(data, statusCallback, directQueue);
+            });
+        }
+        std::cout << "[ BENCH    ] calls_report calls=" << callCount << " legacy=" << legacyNs
+                  << "ns direct=" << directNs << "ns" << std::endl;
+    }
+    MessageParcel data;
+    WriteCallsReport(1, data);
+    (void)data.ReadInt32();
+    CallDetailInfo detailInfo;
+    statusCallback->BuildCallDetailInfo(data, detailInfo);
+    EXPECT_EQ(detailInfo.index, 1);
+    EXPECT_STREQ(detailInfo.phoneNum, BENCHMARK_NUMBER_0.c_str());
+    EXPECT_EQ(detailInfo.state, TelCallState::CALL_STATUS_ACTIVE);
+    EXPECT_EQ(detailInfo.rttChannelId, -1);
+    EXPECT_EQ(data.ReadInt32(), SLOT_ID_0);
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FAKE_CALL_TASK_EXECUTOR_H
+#define FAKE_CALL_TASK_EXECUTOR_H
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+
+#include "call_task_executor.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @class FakeCallTaskExecutor
+ * Installs a virtual clock and a manual task queue into CallTaskExecutor for the lifetime of the object. Nothing
+ * runs until the test advances the clock, tasks then run in due time order on the test thread. The clock starts
+ * at the real monotonic time so singletons created before the fake keep a consistent time base.
+ */
+class FakeCallTaskExecutor {
+public:
+    using Task = CallTaskExecutor::Task;
+
+    FakeCallTaskExecutor()
+    {
+        state_->nowUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        std::weak_ptr<State> weakState = state_;
+        auto executor = DelayedSingleton<CallTaskExecutor>::GetInstance();
+        executor->SetClock([weakState]() {
+            auto state = weakState.lock();
+            return state != nullptr ? state->nowUs : 0;
+        });
+        executor->SetExecutor([weakState](Task task, int64_t delayUs) {
+            auto state = weakState.lock();
+            if (state != nullptr) {
+                state->tasks.emplace(state->nowUs + std::max<int64_t>(delayUs, 0), std::move(task));
+            }
+        });
+    }
+
+    ~FakeCallTaskExecutor()
+    {
+        auto executor = DelayedSingleton<CallTaskExecutor>::GetInstance();
+        executor->SetExecutor(nullptr);
+        executor->SetClock(nullptr);
+        // 未运行的任务交还真实执行器, 避免单例(如定时轮)等待一个永远不会到来的唤醒
+        for (auto &item : state_->tasks) {
+            executor->Submit(std::move(item.second), std::max<int64_t>(item.first - state_->nowUs, 0));
+        }
+        state_->tasks.clear();
+    }
+
+    int64_t GetNowUs() const
+    {
+        return state_->nowUs;
+    }
+
+    size_t GetPendingCount() const
+    {
+        return state_->tasks.size();
+    }
+
+    /* 运行当前时刻已到期的任务, 包括运行过程中新投递的任务 */
+    void RunPending()
+    {
+        AdvanceUs(0);
+    }
+
+    void AdvanceUs(int64_t us)
+    {
+        int64_t targetUs = state_->nowUs + us;
+        while (!state_->tasks.empty() && state_->tasks.begin()->first <= targetUs) {
+            state_->nowUs = std::max(state_->nowUs, state_->tasks.begin()->first);
+            Task task = std::move(state_->tasks.begin()->second);
+            state_->tasks.erase(state_->tasks.begin());
+            task();
+        }
+        state_->nowUs = targetUs;
+    }
+
+    void AdvanceMs(int64_t ms)
+    {
+        AdvanceUs(ms * US_PER_MS);
+    }
+
+private:
+    static constexpr int64_t US_PER_MS = 1000;
+    struct State {
+        int64_t nowUs = 0;
+        std::multimap<int64_t, Task> tasks;
+    };
+    std::shared_ptr<State> state_ = std::make_shared<State>();
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // FAKE_CALL_TASK_EXECUTOR_H
@@ -23,7 +23,9 @@
 #include "audio_proxy.h"
 #include "call_base.h"
 #include "call_control_manager.h"
+#include "call_manager_metrics.h"
 #include "call_object_manager.h"
+#include "call_timer_wheel.h"
 #include "securec.h"
 #include "telephony_log_wrapper.h"
 
@@ -36,6 +38,10 @@ namespace Telephony {
 using namespace testing::ext;
 
 namespace {
+constexpr int32_t FIRST_CALL_ID = 1;
+constexpr int32_t SECOND_CALL_ID = 2;
+constexpr int32_t THIRD_CALL_ID = 3;
+
 // 订阅者类型枚举,用于参数化测试
 enum class SubscriberType : int32_t {
     PICKUP = 0,
@@ -115,6 +121,14 @@ void MotionRecognitionTest::ResetSubscriberState()
     MotionPickupSubscriber::isMotionPickupSubscribed_ = false;
     MotionFlipSubscriber::isMotionFlipSubscribed_ = false;
     MotionCloseToEarSubscriber::isMotionCloseToEarSubscribed_ = false;
+    auto manager = DelayedSingleton<MotionSensorSubscriptionManager>::GetInstance();
+    for (uint32_t index = 0; index < MotionSensorSubscriptionManager::SENSOR_TYPE_NUM; index++) {
+        manager->holders_[index].clear();
+        manager->isSubscribed_[index] = false;
+    }
+    manager->isSensorLoaded_ = false;
+    manager->sensorLoader_ = []() { return Rosen::LoadMotionSensor(); };
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Cancel("motion_sensor_unsubscribe");
 }
 
 class MotionRecogntionApiTest : public MotionRecognitionTest,
@@ -292,5 +306,52 @@ HWTEST_F(MotionRecognitionTest, MotionRecognition_StaticStateObservable_0100, Te
     MotionRecogntion::SubscribePickupSensor();
     EXPECT_FALSE(MotionPickupSubscriber::isMotionPickupSubscribed_);
 }
+
+/**
+ * @tc.number   MotionRecognition_SensorRefCount_0100
+ * @tc.name     Motion sensor subscription is reference counted per call
+ * @tc.desc     Function test - 最后一个通话释放后延迟退订,迟滞窗口内的新通话复用订阅
+ */
+HWTEST_F(MotionRecognitionTest, MotionRecognition_SensorRefCount_0100, TestSize.Level1)
+{
+    auto manager = DelayedSingleton<MotionSensorSubscriptionManager>::GetInstance();
+    ASSERT_NE(manager, nullptr);
+    int32_t loadCount = 0;
+    manager->sensorLoader_ = [&loadCount]() {
+        loadCount++;
+        return true;
+    };
+    auto &metrics = CallManagerMetrics::GetInstance();
+    uint64_t subscribeCount = metrics.GetCounter(MetricCounter::MOTION_SENSOR_SUBSCRIBE);
+    uint64_t unsubscribeCount = metrics.GetCounter(MetricCounter::MOTION_SENSOR_UNSUBSCRIBE);
+    uint64_t reuseCount = metrics.GetCounter(MetricCounter::MOTION_SENSOR_REUSE);
+    uint32_t index = static_cast<uint32_t>(MotionSensorType::CLOSE_TO_EAR);
+
+    EXPECT_TRUE(manager->Acquire(MotionSensorType::CLOSE_TO_EAR, FIRST_CALL_ID));
+    EXPECT_TRUE(manager->Acquire(MotionSensorType::CLOSE_TO_EAR, SECOND_CALL_ID));
+    EXPECT_EQ(loadCount, 1);
+    EXPECT_EQ(manager->GetHolderCount(MotionSensorType::CLOSE_TO_EAR), 2);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::MOTION_SENSOR_SUBSCRIBE), subscribeCount + 1);
+
+    auto timerWheel = DelayedSingleton<CallTimerWheel>::GetInstance();
+    manager->Release(MotionSensorType::CLOSE_TO_EAR, FIRST_CALL_ID);
+    EXPECT_FALSE(timerWheel->IsScheduled("motion_sensor_unsubscribe"));
+    manager->ReleaseCall(SECOND_CALL_ID);
+    EXPECT_TRUE(timerWheel->IsScheduled("motion_sensor_unsubscribe"));
+    EXPECT_TRUE(manager->isSubscribed_[index]);
+
+    /* 迟滞窗口内的新通话直接复用订阅,到期时不会退订 */
+    EXPECT_TRUE(manager->Acquire(MotionSensorType::CLOSE_TO_EAR, THIRD_CALL_ID));
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::MOTION_SENSOR_REUSE), reuseCount + 1);
+    manager->OnUnsubscribeExpired();
+    EXPECT_TRUE(manager->isSubscribed_[index]);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::MOTION_SENSOR_SUBSCRIBE), subscribeCount + 1);
+
+    manager->ReleaseCall(THIRD_CALL_ID);
+    manager->OnUnsubscribeExpired();
+    EXPECT_FALSE(manager->isSubscribed_[index]);
+    EXPECT_FALSE(manager->isSensorLoaded_);
+    EXPECT_EQ(metrics.GetCounter(MetricCounter::MOTION_SENSOR_UNSUBSCRIBE), unsubscribeCount + 1);
+}
 } // namespace Telephony
 } // namespace OHOS
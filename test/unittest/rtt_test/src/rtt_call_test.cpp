@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 #include <cstring>
 #include <string>
+#include <vector>
 
 #include "napi_util.h"
 #include "ims_rtt_errcode.h"
@@ -29,6 +30,7 @@
 #include "call_status_callback.h"
 #include "call_manager_service_stub.h"
 #include "napi_call_ability_callback.h"
+#include "napi_call_event_queue.h"
 #include "call_ability_callback_stub.h"
 #include "rtt_call_listener.h"
 #include "call_control_manager.h"
@@ -715,5 +717,47 @@ HWTEST_F(RttCallTest, Telephony_CallControlManager_UpdateImsRttCallMode_AllBranc
     callControlManager->CallRequestHandlerPtr_ = nullptr;
     ASSERT_NE(callControlManager->UpdateImsRttCallMode(callId, mode), TELEPHONY_SUCCESS);
 }
+
+/**
+ * @tc.number   Telephony_NapiCallEventQueue_Collapse_001
+ * @tc.name     test pending call state events are merged per call and state and drained in order
+ * @tc.desc     Function test
+ */
+HWTEST_F(RttCallTest, Telephony_NapiCallEventQueue_Collapse_001, Function | MediumTest | Level1)
+{
+    auto eventQueue = std::make_shared<NapiCallEventQueue>();
+    EXPECT_EQ(eventQueue->Post(nullptr, NapiCallEventKey(), []() {}), TELEPHONY_ERR_LOCAL_PTR_NULL);
+    std::vector<std::string> delivered;
+    auto record = [&delivered](const std::string &name) {
+        return std::function<void()>([&delivered, name]() { delivered.push_back(name); });
+    };
+    NapiCallEventQueue::EnvQueue queue;
+    NapiCallEventKey dialing = { NapiCallEventType::CALL_STATE, 1, 1 };
+    NapiCallEventKey active = { NapiCallEventType::CALL_STATE, 1, 2 };
+    NapiCallEventKey noCall = { NapiCallEventType::CALL_STATE, -1, 1 };
+    NapiCallEventKey callEvent = { NapiCallEventType::CALL_EVENT, 1, 1 };
+    queue.events.push_back({ dialing, record("dialing_1") });
+    // 同一通话同一状态的待投递事件被替换
+    std::function<void()> task = record("dialing_2");
+    EXPECT_TRUE(eventQueue->TryCollapse(queue, dialing, task));
+    queue.events.push_back({ active, record("active") });
+    // 状态变化不合并, 旧状态的事件也不能被之后的同状态事件替换
+    task = record("dialing_3");
+    EXPECT_FALSE(eventQueue->TryCollapse(queue, dialing, task));
+    EXPECT_FALSE(eventQueue->TryCollapse(queue, noCall, task));
+    EXPECT_FALSE(eventQueue->TryCollapse(queue, callEvent, task));
+    queue.events.push_back({ callEvent, record("event") });
+    ASSERT_EQ(queue.events.size(), 3u);
+
+    napi_env env = reinterpret_cast<napi_env>(&queue);
+    queue.drainScheduled = true;
+    eventQueue->queues_.emplace(env, std::move(queue));
+    eventQueue->Drain(env);
+    std::vector<std::string> expected = { "dialing_2", "active", "event" };
+    EXPECT_EQ(delivered, expected);
+    EXPECT_TRUE(eventQueue->queues_[env].events.empty());
+    EXPECT_FALSE(eventQueue->queues_[env].drainScheduled);
+    eventQueue->queues_.erase(env);
+}
 } // namespace Telephony
 } // namespace OHOS
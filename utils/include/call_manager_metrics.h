@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CALL_MANAGER_METRICS_H
+#define CALL_MANAGER_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace OHOS {
+namespace Telephony {
+enum class MetricCounter : uint32_t {
+    IPC_REQUEST = 0,
+    REPORT_QUEUE_TASK,
+    OBSERVER_STATE_UPDATE,
+    DATASHARE_QUERY,
+    DATASHARE_QUERY_FAILED,
+    AUDIO_ROUTE_SWITCH,
+    AUDIO_ROUTE_SWITCH_FAILED,
+    AUDIO_DEVICE_REPORT_REQUEST,
+    AUDIO_DEVICE_REPORT_SENT,
+    RINGTONE_PREWARM_HIT,
+    RINGTONE_PREWARM_MISS,
+    MOTION_SENSOR_SUBSCRIBE,
+    MOTION_SENSOR_UNSUBSCRIBE,
+    MOTION_SENSOR_REUSE,
+    COUNTER_BUTT,
+};
+
+enum class MetricGauge : uint32_t {
+    REPORT_QUEUE_DEPTH = 0,
+    GAUGE_BUTT,
+};
+
+enum class MetricHistogram : uint32_t {
+    IPC_LATENCY = 0,
+    REPORT_QUEUE_WAIT,
+    OBSERVER_FANOUT_LATENCY,
+    DATASHARE_QUERY_LATENCY,
+    AUDIO_ROUTE_LATENCY,
+    AUDIO_EVENT_WAIT,
+    RING_START_LATENCY,
+    CALL_REQUEST_WAIT,
+    CALL_REQUEST_EXEC,
+    CLEAR_ALL_CALLS_LATENCY,
+    ECC_SERVICE_CONNECT_LATENCY,
+    HISTOGRAM_BUTT,
+};
+
+enum class MetricRate : uint32_t {
+    AUDIO_DEVICE_REPORT_REQUEST = 0,
+    AUDIO_DEVICE_REPORT_SENT,
+    RATE_BUTT,
+};
+
+/**
+ * Process-wide registry of counters, gauges and latency histograms shown by the hidumper "-metrics" command.
+ * Updates are relaxed atomic operations on fixed slots, so instrumenting a hot path costs a few instructions
+ * and nothing is aggregated until the dump is read.
+ */
+class CallManagerMetrics {
+public:
+    static CallManagerMetrics &GetInstance();
+
+    void Increase(MetricCounter counter, uint64_t delta = 1);
+    void GaugeIncrease(MetricGauge gauge);
+    void GaugeDecrease(MetricGauge gauge);
+    void Record(MetricHistogram histogram, int64_t latencyUs);
+    void Mark(MetricRate rate);
+    uint64_t GetCounter(MetricCounter counter) const;
+    int64_t GetGauge(MetricGauge gauge) const;
+    uint64_t GetHistogramCount(MetricHistogram histogram) const;
+    uint64_t GetRatePeak(MetricRate rate) const;
+    void Reset();
+    void Dump(std::string &result) const;
+
+public:
+    static constexpr uint32_t HISTOGRAM_BUCKET_NUM = 9;
+
+private:
+    CallManagerMetrics() = default;
+    ~CallManagerMetrics() = default;
+    CallManagerMetrics(const CallManagerMetrics &) = delete;
+    CallManagerMetrics &operator=(const CallManagerMetrics &) = delete;
+
+    struct Gauge {
+        std::atomic<int64_t> value { 0 };
+        std::atomic<int64_t> max { 0 };
+    };
+    struct Histogram {
+        std::atomic<uint64_t> buckets[HISTOGRAM_BUCKET_NUM] {};
+        std::atomic<uint64_t> count { 0 };
+        std::atomic<int64_t> sumUs { 0 };
+        std::atomic<int64_t> maxUs { 0 };
+    };
+    // events seen in the current second and in the one before it, good enough to spot bursts
+    struct Rate {
+        std::atomic<int64_t> second { 0 };
+        std::atomic<uint64_t> count { 0 };
+        std::atomic<uint64_t> previousCount { 0 };
+        std::atomic<int64_t> peak { 0 };
+    };
+    static void UpdateMax(std::atomic<int64_t> &max, int64_t value);
+    static int64_t GetCurrentSecond();
+
+private:
+    std::atomic<uint64_t> counters_[static_cast<uint32_t>(MetricCounter::COUNTER_BUTT)] {};
+    Gauge gauges_[static_cast<uint32_t>(MetricGauge::GAUGE_BUTT)];
+    Histogram histograms_[static_cast<uint32_t>(MetricHistogram::HISTOGRAM_BUTT)] {};
+    Rate rates_[static_cast<uint32_t>(MetricRate::RATE_BUTT)];
+};
+
+/**
+ * Records the lifetime of the scope into a latency histogram.
+ */
+class CallManagerMetricsTimer {
+public:
+    explicit CallManagerMetricsTimer(MetricHistogram histogram)
+        : histogram_(histogram), begin_(std::chrono::steady_clock::now())
+    {}
+
+    ~CallManagerMetricsTimer()
+    {
+        CallManagerMetrics::GetInstance().Record(histogram_, std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin_).count());
+    }
+
+private:
+    MetricHistogram histogram_;
+    std::chrono::steady_clock::time_point begin_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // CALL_MANAGER_METRICS_H
@@ -16,6 +16,8 @@
 #ifndef CALL_MANAGER_UTILS_H
 #define CALL_MANAGER_UTILS_H
 
+#include <vector>
+
 #include "bundle_mgr_proxy.h"
 
 namespace OHOS {
@@ -23,16 +25,35 @@ namespace Telephony {
 
 struct CallAttributeInfo;
 
+/**
+ * CallAttributeInfo marshalled once when the report snapshot is taken, so the same bytes can be appended to the
+ * parcel of every subscriber without looking up the call again.
+ */
+class CallAttributeInfoParcel {
+public:
+    explicit CallAttributeInfoParcel(const CallAttributeInfo &info);
+    ~CallAttributeInfoParcel() = default;
+    bool WriteTo(MessageParcel &messageParcel) const;
+    size_t GetDataSize() const;
+
+private:
+    MessageParcel data_;
+};
+
 class CallManagerUtils {
 public:
     static __attribute__((noinline)) void WriteCallAttributeInfo(
         const CallAttributeInfo &info, MessageParcel &messageParcel);
+    static void WriteCallAttributeInfo(
+        const CallAttributeInfo &info, bool isForcedReportVoiceCall, MessageParcel &messageParcel);
+    static void WriteCallAttributeInfoList(
+        const std::vector<CallAttributeInfo> &infoList, MessageParcel &messageParcel);
+    static bool IsForcedReportVoiceCall(const CallAttributeInfo &info);
     static __attribute__((noinline)) bool IsBundleInstalled(const std::string &bundleName, int32_t userId);
     static __attribute__((noinline)) std::string GetSystemParameter(
         const std::string &key, const std::string &defaultVal);
 
 private:
-    static bool IsForcedReportVoiceCall(const CallAttributeInfo &info);
     static void WriteVoipCallInfo(const CallAttributeInfo &info, MessageParcel &messageParcel);
 };
 } // namespace Telephony
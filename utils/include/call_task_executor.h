@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CALL_TASK_EXECUTOR_H
+#define CALL_TASK_EXECUTOR_H
+
+#include <functional>
+
+#include "ffrt.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @class CallTaskExecutor
+ * Posts the deferred tasks of the call manager and reads the monotonic clock they are scheduled against. The timer
+ * wheel, the volume ramps, the request executor and the other components that defer work all go through it, so a
+ * test replaces the executor and the clock once and drives every one of them in virtual time.
+ */
+class CallTaskExecutor {
+    DECLARE_DELAYED_SINGLETON(CallTaskExecutor)
+public:
+    using Task = std::function<void()>;
+    using Executor = std::function<void(Task task, int64_t delayUs)>;
+    using Clock = std::function<int64_t()>;
+
+    void Submit(Task task, int64_t delayUs = 0);
+    void Submit(ffrt::queue &queue, Task task);
+    int64_t GetNowUs();
+    int64_t GetNowMs();
+    void SetExecutor(Executor executor);
+    void SetClock(Clock clock);
+
+private:
+    Executor GetExecutor();
+
+    ffrt::mutex mutex_;
+    Executor executor_ = nullptr;
+    Clock clock_ = nullptr;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // CALL_TASK_EXECUTOR_H
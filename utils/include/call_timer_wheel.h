@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CALL_TIMER_WHEEL_H
+#define CALL_TIMER_WHEEL_H
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ffrt.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace Telephony {
+constexpr uint64_t INVALID_TIMER_ID = 0;
+constexpr int32_t TIMER_NO_CALL_ID = -1;
+
+/**
+ * @class CallTimerWheel
+ * Process-wide hierarchical timer wheel with a 10ms tick. Timers are keyed by name and call id, scheduling a
+ * key again replaces the pending timer. The wheel arms a single delayed ffrt task for the next tick that has
+ * work, so it never owns a thread and does not wake up while no timer is pending. Timer tasks run one after
+ * another on that ffrt task and must stay short, heavy work should be posted elsewhere. The wake task and the
+ * clock come from CallTaskExecutor.
+ */
+class CallTimerWheel : public std::enable_shared_from_this<CallTimerWheel> {
+    DECLARE_DELAYED_SINGLETON(CallTimerWheel)
+public:
+    using TimerTask = std::function<void()>;
+
+    uint64_t Schedule(const std::string &name, int64_t delayMs, TimerTask task, int32_t callId = TIMER_NO_CALL_ID);
+    bool Cancel(uint64_t timerId);
+    bool Cancel(const std::string &name, int32_t callId = TIMER_NO_CALL_ID);
+    size_t CancelCallTimers(int32_t callId);
+    bool IsScheduled(const std::string &name, int32_t callId = TIMER_NO_CALL_ID);
+    size_t GetTimerCount();
+    void Dump(std::string &result);
+
+public:
+    static constexpr int64_t TICK_MS = 10;
+
+private:
+    using TimerKey = std::pair<std::string, int32_t>;
+    struct Timer {
+        TimerKey key;
+        TimerTask task;
+        int64_t expireTick = 0;
+        uint32_t level = 0;
+        uint32_t slot = 0;
+        std::list<uint64_t>::iterator position;
+    };
+    int64_t GetNowMs();
+    int64_t GetNowTick();
+    void PlaceLocked(uint64_t timerId, Timer &timer);
+    void UnplaceLocked(Timer &timer);
+    void EraseLocked(std::unordered_map<uint64_t, Timer>::iterator it);
+    void AdvanceLocked(int64_t nowTick, std::vector<TimerTask> &expiredTasks);
+    void CascadeLocked(uint32_t level, uint32_t slot);
+    int64_t GetNextTickLocked();
+    void ArmLocked();
+    void OnWake(int64_t wakeTick);
+
+    ffrt::mutex mutex_;
+    std::vector<std::vector<std::list<uint64_t>>> wheel_;
+    std::unordered_map<uint64_t, Timer> timers_;
+    std::map<TimerKey, uint64_t> keyIndex_;
+    uint64_t lastTimerId_ = INVALID_TIMER_ID;
+    int64_t startMs_ = 0;
+    int64_t currentTick_ = 0;
+    int64_t armedTick_ = -1;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // CALL_TIMER_WHEEL_H
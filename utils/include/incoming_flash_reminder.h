@@ -16,18 +16,15 @@
 #ifndef INCOMING_FLASH_REMINDER_H
 #define INCOMING_FLASH_REMINDER_H
 
-#include "event_handler.h"
-#include "event_runner.h"
 #include <functional>
+#include <memory>
 
 namespace OHOS {
 namespace Telephony {
-class IncomingFlashReminder : public AppExecFwk::EventHandler {
+class IncomingFlashReminder : public std::enable_shared_from_this<IncomingFlashReminder> {
 public:
-    IncomingFlashReminder(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
-        std::function<void()> stopFlashRemindDone);
+    explicit IncomingFlashReminder(std::function<void()> stopFlashRemindDone);
     ~IncomingFlashReminder();
-    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event) override;
     void StartFlashRemind();
     void StopFlashRemind();
 private:
@@ -36,6 +33,7 @@ private:
     bool IsScreenStatusSatisfied();
     bool IsTorchReady();
     void HandleSetTorchMode();
+    void ScheduleSetTorchMode(int64_t delayMs);
     void HandleStopFlashRemind();
     void HandleStartFlashRemind();
     void ReleaseDepsAdapter();
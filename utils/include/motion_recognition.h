@@ -16,9 +16,15 @@
 #ifndef MOTION_RECOGNITION_H
 #define MOTION_RECOGNITION_H
 
+#include <functional>
+#include <set>
+
 #include <refbase.h>
 #include <screen_sensor_plugin.h>
 
+#include "ffrt.h"
+#include "singleton.h"
+
 namespace OHOS {
 namespace Telephony {
 
@@ -36,6 +42,45 @@ public:
     static void ReduceRingToneVolume();
 };
 
+enum class MotionSensorType : uint32_t {
+    PICKUP = 0,
+    FLIP,
+    CLOSE_TO_EAR,
+    SENSOR_TYPE_BUTT,
+};
+
+/**
+ * @class MotionSensorSubscriptionManager
+ * Reference counts the calls interested in each motion sensor. A sensor is subscribed when the first call acquires
+ * it, the unsubscribe after the last release is deferred by a short hysteresis window so that back-to-back calls
+ * reuse the subscription, and the motion plugin is unloaded once no sensor is subscribed any more.
+ */
+class MotionSensorSubscriptionManager {
+    DECLARE_DELAYED_SINGLETON(MotionSensorSubscriptionManager)
+public:
+    using SensorLoader = std::function<bool()>;
+
+    bool Acquire(MotionSensorType type, int32_t callId);
+    void Release(MotionSensorType type, int32_t callId);
+    void ReleaseAll(MotionSensorType type);
+    void ReleaseCall(int32_t callId);
+    size_t GetHolderCount(MotionSensorType type);
+
+private:
+    bool LoadSensorLocked();
+    void SubscribeLocked(MotionSensorType type);
+    void UnsubscribeLocked(MotionSensorType type);
+    void ScheduleUnsubscribeLocked();
+    void OnUnsubscribeExpired();
+
+    static constexpr uint32_t SENSOR_TYPE_NUM = static_cast<uint32_t>(MotionSensorType::SENSOR_TYPE_BUTT);
+    ffrt::mutex mutex_;
+    std::set<int32_t> holders_[SENSOR_TYPE_NUM];
+    bool isSubscribed_[SENSOR_TYPE_NUM] = {};
+    bool isSensorLoaded_ = false;
+    SensorLoader sensorLoader_ = nullptr;
+};
+
 #ifdef  OHOS_SUBSCRIBE_MOTION_ENABLE
 class MotionPickupSubscriber {
 friend MotionRecogntion;
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "call_manager_metrics.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+// upper bounds in microseconds, the last bucket collects everything above
+constexpr int64_t HISTOGRAM_BOUNDS_US[CallManagerMetrics::HISTOGRAM_BUCKET_NUM - 1] = {
+    100, 500, 1000, 5000, 10000, 50000, 100000, 500000 };
+const char *const COUNTER_NAMES[] = { "ipc_request", "report_queue_task", "observer_state_update",
+    "datashare_query", "datashare_query_failed", "audio_route_switch", "audio_route_switch_failed",
+    "audio_device_report_request", "audio_device_report_sent", "ringtone_prewarm_hit", "ringtone_prewarm_miss",
+    "motion_sensor_subscribe", "motion_sensor_unsubscribe", "motion_sensor_reuse" };
+const char *const GAUGE_NAMES[] = { "report_queue_depth" };
+const char *const HISTOGRAM_NAMES[] = { "ipc_latency", "report_queue_wait", "observer_fanout_latency",
+    "datashare_query_latency", "audio_route_latency", "audio_event_wait", "ring_start_latency", "call_request_wait",
+    "call_request_exec", "clear_all_calls_latency",
+    "ecc_service_connect_latency" };
+const char *const RATE_NAMES[] = { "audio_device_report_request", "audio_device_report_sent" };
+static_assert(sizeof(COUNTER_NAMES) / sizeof(COUNTER_NAMES[0]) ==
+    static_cast<uint32_t>(MetricCounter::COUNTER_BUTT), "counter names mismatch");
+static_assert(sizeof(GAUGE_NAMES) / sizeof(GAUGE_NAMES[0]) ==
+    static_cast<uint32_t>(MetricGauge::GAUGE_BUTT), "gauge names mismatch");
+static_assert(sizeof(HISTOGRAM_NAMES) / sizeof(HISTOGRAM_NAMES[0]) ==
+    static_cast<uint32_t>(MetricHistogram::HISTOGRAM_BUTT), "histogram names mismatch");
+static_assert(sizeof(RATE_NAMES) / sizeof(RATE_NAMES[0]) ==
+    static_cast<uint32_t>(MetricRate::RATE_BUTT), "rate names mismatch");
+} // namespace
+
+CallManagerMetrics &CallManagerMetrics::GetInstance()
+{
+    static CallManagerMetrics instance;
+    return instance;
+}
+
+void CallManagerMetrics::Increase(MetricCounter counter, uint64_t delta)
+{
+    if (counter >= MetricCounter::COUNTER_BUTT) {
+        return;
+    }
+    counters_[static_cast<uint32_t>(counter)].fetch_add(delta, std::memory_order_relaxed);
+}
+
+void CallManagerMetrics::GaugeIncrease(MetricGauge gauge)
+{
+    if (gauge >= MetricGauge::GAUGE_BUTT) {
+        return;
+    }
+    Gauge &target = gauges_[static_cast<uint32_t>(gauge)];
+    int64_t value = target.value.fetch_add(1, std::memory_order_relaxed) + 1;
+    UpdateMax(target.max, value);
+}
+
+void CallManagerMetrics::GaugeDecrease(MetricGauge gauge)
+{
+    if (gauge >= MetricGauge::GAUGE_BUTT) {
+        return;
+    }
+    gauges_[static_cast<uint32_t>(gauge)].value.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void CallManagerMetrics::Record(MetricHistogram histogram, int64_t latencyUs)
+{
+    if (histogram >= MetricHistogram::HISTOGRAM_BUTT) {
+        return;
+    }
+    Histogram &target = histograms_[static_cast<uint32_t>(histogram)];
+    uint32_t bucket = 0;
+    while (bucket < HISTOGRAM_BUCKET_NUM - 1 && latencyUs > HISTOGRAM_BOUNDS_US[bucket]) {
+        bucket++;
+    }
+    target.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    target.count.fetch_add(1, std::memory_order_relaxed);
+    target.sumUs.fetch_add(latencyUs, std::memory_order_relaxed);
+    UpdateMax(target.maxUs, latencyUs);
+}
+
+void CallManagerMetrics::Mark(MetricRate rate)
+{
+    if (rate >= MetricRate::RATE_BUTT) {
+        return;
+    }
+    Rate &target = rates_[static_cast<uint32_t>(rate)];
+    int64_t now = GetCurrentSecond();
+    int64_t second = target.second.load(std::memory_order_relaxed);
+    if (second != now && target.second.compare_exchange_strong(second, now, std::memory_order_relaxed)) {
+        uint64_t finished = target.count.exchange(0, std::memory_order_relaxed);
+        target.previousCount.store(second == now - 1 ? finished : 0, std::memory_order_relaxed);
+    }
+    uint64_t count = target.count.fetch_add(1, std::memory_order_relaxed) + 1;
+    UpdateMax(target.peak, static_cast<int64_t>(count));
+}
+
+uint64_t CallManagerMetrics::GetCounter(MetricCounter counter) const
+{
+    if (counter >= MetricCounter::COUNTER_BUTT) {
+        return 0;
+    }
+    return counters_[static_cast<uint32_t>(counter)].load(std::memory_order_relaxed);
+}
+
+int64_t CallManagerMetrics::GetGauge(MetricGauge gauge) const
+{
+    if (gauge >= MetricGauge::GAUGE_BUTT) {
+        return 0;
+    }
+    return gauges_[static_cast<uint32_t>(gauge)].value.load(std::memory_order_relaxed);
+}
+
+uint64_t CallManagerMetrics::GetHistogramCount(MetricHistogram histogram) const
+{
+    if (histogram >= MetricHistogram::HISTOGRAM_BUTT) {
+        return 0;
+    }
+    return histograms_[static_cast<uint32_t>(histogram)].count.load(std::memory_order_relaxed);
+}
+
+uint64_t CallManagerMetrics::GetRatePeak(MetricRate rate) const
+{
+    if (rate >= MetricRate::RATE_BUTT) {
+        return 0;
+    }
+    return static_cast<uint64_t>(rates_[static_cast<uint32_t>(rate)].peak.load(std::memory_order_relaxed));
+}
+
+void CallManagerMetrics::Reset()
+{
+    for (auto &counter : counters_) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    // gauges reflect live state, only their high-water marks are reset
+    for (auto &gauge : gauges_) {
+        gauge.max.store(gauge.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    for (auto &histogram : histograms_) {
+        for (auto &bucket : histogram.buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        histogram.count.store(0, std::memory_order_relaxed);
+        histogram.sumUs.store(0, std::memory_order_relaxed);
+        histogram.maxUs.store(0, std::memory_order_relaxed);
+    }
+    for (auto &rate : rates_) {
+        rate.count.store(0, std::memory_order_relaxed);
+        rate.previousCount.store(0, std::memory_order_relaxed);
+        rate.peak.store(0, std::memory_order_relaxed);
+    }
+}
+
+void CallManagerMetrics::Dump(std::string &result) const
+{
+    result.append("Counters:\n");
+    for (uint32_t i = 0; i < static_cast<uint32_t>(MetricCounter::COUNTER_BUTT); i++) {
+        result.append("  ").append(COUNTER_NAMES[i]).append(": ")
+            .append(std::to_string(counters_[i].load(std::memory_order_relaxed))).append("\n");
+    }
+    result.append("Gauges:\n");
+    for (uint32_t i = 0; i < static_cast<uint32_t>(MetricGauge::GAUGE_BUTT); i++) {
+        result.append("  ").append(GAUGE_NAMES[i]).append(": ")
+            .append(std::to_string(gauges_[i].value.load(std::memory_order_relaxed))).append(" max: ")
+            .append(std::to_string(gauges_[i].max.load(std::memory_order_relaxed))).append("\n");
+    }
+    result.append("Histograms(us):\n");
+    for (uint32_t i = 0; i < static_cast<uint32_t>(MetricHistogram::HISTOGRAM_BUTT); i++) {
+        const Histogram &histogram = histograms_[i];
+        uint64_t count = histogram.count.load(std::memory_order_relaxed);
+        int64_t sumUs = histogram.sumUs.load(std::memory_order_relaxed);
+        result.append("  ").append(HISTOGRAM_NAMES[i]).append(": count ").append(std::to_string(count))
+            .append(" avg ").append(std::to_string(count == 0 ? 0 : sumUs / static_cast<int64_t>(count)))
+            .append(" max ").append(std::to_string(histogram.maxUs.load(std::memory_order_relaxed)))
+            .append("\n    ");
+        for (uint32_t bucket = 0; bucket < HISTOGRAM_BUCKET_NUM; bucket++) {
+            result.append(bucket < HISTOGRAM_BUCKET_NUM - 1 ?
+                "<=" + std::to_string(HISTOGRAM_BOUNDS_US[bucket]) : std::string(">") +
+                std::to_string(HISTOGRAM_BOUNDS_US[HISTOGRAM_BUCKET_NUM - 2]));
+            result.append(":").append(std::to_string(histogram.buckets[bucket].load(std::memory_order_relaxed)))
+                .append(" ");
+        }
+        result.append("\n");
+    }
+    result.append("Rates(per second):\n");
+    int64_t now = GetCurrentSecond();
+    for (uint32_t i = 0; i < static_cast<uint32_t>(MetricRate::RATE_BUTT); i++) {
+        const Rate &rate = rates_[i];
+        int64_t second = rate.second.load(std::memory_order_relaxed);
+        uint64_t count = rate.count.load(std::memory_order_relaxed);
+        uint64_t current = second == now ? count : 0;
+        uint64_t previous = 0;
+        if (second == now) {
+            previous = rate.previousCount.load(std::memory_order_relaxed);
+        } else if (second == now - 1) {
+            previous = count;
+        }
+        result.append("  ").append(RATE_NAMES[i]).append(": current ").append(std::to_string(current))
+            .append(" last ").append(std::to_string(previous))
+            .append(" peak ").append(std::to_string(rate.peak.load(std::memory_order_relaxed))).append("\n");
+    }
+}
+
+int64_t CallManagerMetrics::GetCurrentSecond()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void CallManagerMetrics::UpdateMax(std::atomic<int64_t> &max, int64_t value)
+{
+    int64_t current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
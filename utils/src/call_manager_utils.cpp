@@ -15,6 +15,8 @@
 
 #include "call_manager_utils.h"
 
+#include <unordered_set>
+
 #include "bundle_mgr_interface.h"
 #include "call_manager_base.h"
 #include "call_object_manager.h"
@@ -38,14 +40,51 @@ bool CallManagerUtils::IsForcedReportVoiceCall(const CallAttributeInfo &info)
     return call->IsForcedReportVoiceCall();
 }
 
+CallAttributeInfoParcel::CallAttributeInfoParcel(const CallAttributeInfo &info)
+{
+    CallManagerUtils::WriteCallAttributeInfo(info, CallManagerUtils::IsForcedReportVoiceCall(info), data_);
+}
+
+bool CallAttributeInfoParcel::WriteTo(MessageParcel &messageParcel) const
+{
+    return messageParcel.WriteBuffer(reinterpret_cast<const void *>(data_.GetData()), data_.GetDataSize());
+}
+
+size_t CallAttributeInfoParcel::GetDataSize() const
+{
+    return data_.GetDataSize();
+}
+
 __attribute__((noinline)) void CallManagerUtils::WriteCallAttributeInfo(
     const CallAttributeInfo &info, MessageParcel &messageParcel)
+{
+    WriteCallAttributeInfo(info, IsForcedReportVoiceCall(info), messageParcel);
+}
+
+void CallManagerUtils::WriteCallAttributeInfoList(
+    const std::vector<CallAttributeInfo> &infoList, MessageParcel &messageParcel)
+{
+    std::unordered_set<int32_t> forcedVoiceCallIds;
+    for (const auto &call : CallObjectManager::GetAllCallList()) {
+        if (call != nullptr && call->IsForcedReportVoiceCall()) {
+            forcedVoiceCallIds.insert(call->GetCallID());
+        }
+    }
+    for (const auto &info : infoList) {
+        bool isForcedReportVoiceCall = info.callState == TelCallState::CALL_STATUS_INCOMING &&
+            forcedVoiceCallIds.count(info.callId) != 0;
+        WriteCallAttributeInfo(info, isForcedReportVoiceCall, messageParcel);
+    }
+}
+
+void CallManagerUtils::WriteCallAttributeInfo(
+    const CallAttributeInfo &info, bool isForcedReportVoiceCall, MessageParcel &messageParcel)
 {
     messageParcel.WriteCString(info.accountNumber);
     messageParcel.WriteCString(info.bundleName);
     messageParcel.WriteBool(info.speakerphoneOn);
     messageParcel.WriteInt32(info.accountId);
-    if (IsForcedReportVoiceCall(info)) {
+    if (isForcedReportVoiceCall) {
         messageParcel.WriteInt32(static_cast<int32_t>(VideoStateType::TYPE_VOICE));
     } else {
         messageParcel.WriteInt32(static_cast<int32_t>(info.videoState));
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "call_task_executor.h"
+
+#include <chrono>
+
+namespace OHOS {
+namespace Telephony {
+constexpr int64_t US_TO_MS = 1000;
+
+CallTaskExecutor::CallTaskExecutor() {}
+
+CallTaskExecutor::~CallTaskExecutor() {}
+
+CallTaskExecutor::Executor CallTaskExecutor::GetExecutor()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return executor_;
+}
+
+void CallTaskExecutor::Submit(Task task, int64_t delayUs)
+{
+    if (task == nullptr) {
+        return;
+    }
+    Executor executor = GetExecutor();
+    if (executor != nullptr) {
+        executor(std::move(task), delayUs);
+        return;
+    }
+    if (delayUs <= 0) {
+        ffrt::submit(std::move(task));
+        return;
+    }
+    ffrt::submit(std::move(task), {}, {}, ffrt::task_attr().delay(static_cast<uint64_t>(delayUs)));
+}
+
+void CallTaskExecutor::Submit(ffrt::queue &queue, Task task)
+{
+    if (task == nullptr) {
+        return;
+    }
+    Executor executor = GetExecutor();
+    if (executor != nullptr) {
+        executor(std::move(task), 0);
+        return;
+    }
+    queue.submit(std::move(task));
+}
+
+int64_t CallTaskExecutor::GetNowUs()
+{
+    Clock clock = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        clock = clock_;
+    }
+    if (clock != nullptr) {
+        return clock();
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t CallTaskExecutor::GetNowMs()
+{
+    return GetNowUs() / US_TO_MS;
+}
+
+void CallTaskExecutor::SetExecutor(Executor executor)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    executor_ = std::move(executor);
+}
+
+void CallTaskExecutor::SetClock(Clock clock)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    clock_ = std::move(clock);
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,307 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "call_timer_wheel.h"
+
+#include <algorithm>
+
+#include "call_task_executor.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+// level 0 holds the next 256 ticks one by one, each upper level is 64 times coarser, about 7.7 days in total
+constexpr uint32_t LEVEL_BITS[] = { 8, 6, 6, 6 };
+constexpr uint32_t LEVEL_COUNT = sizeof(LEVEL_BITS) / sizeof(LEVEL_BITS[0]);
+constexpr uint32_t MAX_RANGE_BITS = 26;
+constexpr int64_t MAX_DELAY_TICKS = (static_cast<int64_t>(1) << MAX_RANGE_BITS) - 1;
+constexpr int64_t MS_TO_US = 1000;
+
+uint32_t GetLevelShift(uint32_t level)
+{
+    uint32_t shift = 0;
+    for (uint32_t i = 0; i < level; i++) {
+        shift += LEVEL_BITS[i];
+    }
+    return shift;
+}
+
+uint32_t GetLevelSlots(uint32_t level)
+{
+    return static_cast<uint32_t>(1) << LEVEL_BITS[level];
+}
+} // namespace
+
+CallTimerWheel::CallTimerWheel()
+{
+    wheel_.resize(LEVEL_COUNT);
+    for (uint32_t level = 0; level < LEVEL_COUNT; level++) {
+        wheel_[level].resize(GetLevelSlots(level));
+    }
+    startMs_ = GetNowMs();
+}
+
+CallTimerWheel::~CallTimerWheel() {}
+
+int64_t CallTimerWheel::GetNowMs()
+{
+    return DelayedSingleton<CallTaskExecutor>::GetInstance()->GetNowMs();
+}
+
+int64_t CallTimerWheel::GetNowTick()
+{
+    return (GetNowMs() - startMs_) / TICK_MS;
+}
+
+uint64_t CallTimerWheel::Schedule(const std::string &name, int64_t delayMs, TimerTask task, int32_t callId)
+{
+    if (task == nullptr) {
+        TELEPHONY_LOGE("timer %{public}s has no task", name.c_str());
+        return INVALID_TIMER_ID;
+    }
+    std::vector<TimerTask> expiredTasks;
+    uint64_t timerId = INVALID_TIMER_ID;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        int64_t nowMs = GetNowMs() - startMs_;
+        AdvanceLocked(nowMs / TICK_MS, expiredTasks);
+        TimerKey key(name, callId);
+        auto keyIt = keyIndex_.find(key);
+        if (keyIt != keyIndex_.end()) {
+            EraseLocked(timers_.find(keyIt->second));
+        }
+        // round the deadline up so a timer never fires before its delay has passed
+        int64_t expireTick = (nowMs + std::max<int64_t>(delayMs, 0) + TICK_MS - 1) / TICK_MS;
+        expireTick = std::clamp(expireTick, currentTick_ + 1, currentTick_ + MAX_DELAY_TICKS);
+        timerId = ++lastTimerId_;
+        Timer &timer = timers_[timerId];
+        timer.key = key;
+        timer.task = std::move(task);
+        timer.expireTick = expireTick;
+        PlaceLocked(timerId, timer);
+        keyIndex_[key] = timerId;
+        ArmLocked();
+    }
+    // timers that went due before their wake task ran fire on the executor as in OnWake, never on the caller,
+    // which may hold its own locks while scheduling
+    if (!expiredTasks.empty()) {
+        DelayedSingleton<CallTaskExecutor>::GetInstance()->Submit([expiredTasks = std::move(expiredTasks)]() {
+            for (auto &expiredTask : expiredTasks) {
+                expiredTask();
+            }
+        });
+    }
+    return timerId;
+}
+
+bool CallTimerWheel::Cancel(uint64_t timerId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto it = timers_.find(timerId);
+    if (it == timers_.end()) {
+        return false;
+    }
+    EraseLocked(it);
+    return true;
+}
+
+bool CallTimerWheel::Cancel(const std::string &name, int32_t callId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto keyIt = keyIndex_.find(TimerKey(name, callId));
+    if (keyIt == keyIndex_.end()) {
+        return false;
+    }
+    EraseLocked(timers_.find(keyIt->second));
+    return true;
+}
+
+size_t CallTimerWheel::CancelCallTimers(int32_t callId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    size_t count = 0;
+    auto it = timers_.begin();
+    while (it != timers_.end()) {
+        auto current = it++;
+        if (current->second.key.second == callId) {
+            EraseLocked(current);
+            count++;
+        }
+    }
+    return count;
+}
+
+bool CallTimerWheel::IsScheduled(const std::string &name, int32_t callId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return keyIndex_.find(TimerKey(name, callId)) != keyIndex_.end();
+}
+
+size_t CallTimerWheel::GetTimerCount()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return timers_.size();
+}
+
+void CallTimerWheel::PlaceLocked(uint64_t timerId, Timer &timer)
+{
+    int64_t delta = std::max<int64_t>(timer.expireTick - currentTick_, 0);
+    uint32_t level = 0;
+    while (level + 1 < LEVEL_COUNT && delta >= (static_cast<int64_t>(1) << GetLevelShift(level + 1))) {
+        level++;
+    }
+    timer.level = level;
+    timer.slot = static_cast<uint32_t>(timer.expireTick >> GetLevelShift(level)) & (GetLevelSlots(level) - 1);
+    std::list<uint64_t> &slot = wheel_[level][timer.slot];
+    timer.position = slot.insert(slot.end(), timerId);
+}
+
+void CallTimerWheel::UnplaceLocked(Timer &timer)
+{
+    wheel_[timer.level][timer.slot].erase(timer.position);
+}
+
+void CallTimerWheel::EraseLocked(std::unordered_map<uint64_t, Timer>::iterator it)
+{
+    if (it == timers_.end()) {
+        return;
+    }
+    UnplaceLocked(it->second);
+    keyIndex_.erase(it->second.key);
+    timers_.erase(it);
+}
+
+void CallTimerWheel::CascadeLocked(uint32_t level, uint32_t slot)
+{
+    std::list<uint64_t> pending;
+    pending.swap(wheel_[level][slot]);
+    for (uint64_t timerId : pending) {
+        Timer &timer = timers_[timerId];
+        PlaceLocked(timerId, timer);
+    }
+}
+
+void CallTimerWheel::AdvanceLocked(int64_t nowTick, std::vector<TimerTask> &expiredTasks)
+{
+    while (currentTick_ < nowTick) {
+        int64_t nextTick = GetNextTickLocked();
+        if (nextTick < 0 || nextTick > nowTick) {
+            // every slot in between is empty, nothing is lost by jumping over it
+            currentTick_ = nowTick;
+            return;
+        }
+        currentTick_ = nextTick;
+        for (uint32_t level = LEVEL_COUNT - 1; level > 0; level--) {
+            uint32_t shift = GetLevelShift(level);
+            if ((currentTick_ & ((static_cast<int64_t>(1) << shift) - 1)) == 0) {
+                CascadeLocked(level, static_cast<uint32_t>(currentTick_ >> shift) & (GetLevelSlots(level) - 1));
+            }
+        }
+        std::list<uint64_t> pending;
+        pending.swap(wheel_[0][static_cast<uint32_t>(currentTick_) & (GetLevelSlots(0) - 1)]);
+        for (uint64_t timerId : pending) {
+            auto it = timers_.find(timerId);
+            if (it == timers_.end()) {
+                continue;
+            }
+            if (it->second.expireTick > currentTick_) {
+                PlaceLocked(timerId, it->second);
+                continue;
+            }
+            expiredTasks.push_back(std::move(it->second.task));
+            keyIndex_.erase(it->second.key);
+            timers_.erase(it);
+        }
+    }
+}
+
+int64_t CallTimerWheel::GetNextTickLocked()
+{
+    int64_t nextTick = -1;
+    for (uint32_t level = 0; level < LEVEL_COUNT; level++) {
+        uint32_t shift = GetLevelShift(level);
+        uint32_t slots = GetLevelSlots(level);
+        int64_t base = currentTick_ >> shift;
+        for (uint32_t offset = 1; offset <= slots; offset++) {
+            int64_t tick = (base + offset) << shift;
+            if (nextTick >= 0 && tick >= nextTick) {
+                break;
+            }
+            if (!wheel_[level][static_cast<uint32_t>(base + offset) & (slots - 1)].empty()) {
+                nextTick = tick;
+                break;
+            }
+        }
+    }
+    return nextTick;
+}
+
+void CallTimerWheel::ArmLocked()
+{
+    int64_t nextTick = GetNextTickLocked();
+    if (nextTick < 0 || (armedTick_ >= 0 && armedTick_ <= nextTick)) {
+        return;
+    }
+    armedTick_ = nextTick;
+    int64_t delayUs = std::max<int64_t>(startMs_ + nextTick * TICK_MS - GetNowMs(), 0) * MS_TO_US;
+    std::weak_ptr<CallTimerWheel> weakWheel = weak_from_this();
+    auto task = [weakWheel, nextTick]() {
+        auto wheel = weakWheel.lock();
+        if (wheel != nullptr) {
+            wheel->OnWake(nextTick);
+        }
+    };
+    DelayedSingleton<CallTaskExecutor>::GetInstance()->Submit(task, delayUs);
+}
+
+void CallTimerWheel::OnWake(int64_t wakeTick)
+{
+    std::vector<TimerTask> expiredTasks;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (armedTick_ == wakeTick) {
+            armedTick_ = -1;
+        }
+        AdvanceLocked(GetNowTick(), expiredTasks);
+        ArmLocked();
+    }
+    for (auto &task : expiredTasks) {
+        task();
+    }
+}
+
+void CallTimerWheel::Dump(std::string &result)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    std::vector<const Timer *> timers;
+    for (auto &it : timers_) {
+        timers.push_back(&it.second);
+    }
+    std::sort(timers.begin(), timers.end(),
+        [](const Timer *left, const Timer *right) { return left->expireTick < right->expireTick; });
+    int64_t nowMs = GetNowMs() - startMs_;
+    result.append("Call timers: ").append(std::to_string(timers.size())).append("\n");
+    for (const Timer *timer : timers) {
+        result.append("  ").append(timer->key.first);
+        if (timer->key.second != TIMER_NO_CALL_ID) {
+            result.append(" callId ").append(std::to_string(timer->key.second));
+        }
+        result.append(" remain ").append(std::to_string(std::max<int64_t>(timer->expireTick * TICK_MS - nowMs, 0)))
+            .append("ms\n");
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -15,6 +15,10 @@
 
 #include "incoming_flash_reminder.h"
 
+#include <dlfcn.h>
+
+#include "call_timer_wheel.h"
+#include "ffrt.h"
 #include "os_account_manager.h"
 #include "settings_datashare_helper.h"
 #include "telephony_errors.h"
@@ -39,13 +43,14 @@ enum class TelTorchMode {
 #ifdef ABILITY_SCREENLOCKMGR_SUPPORT
     using IsScreenLockedFunc = bool (*)();
 #endif
-constexpr uint32_t DELAY_SET_TORCH_EVENT = 1000000;
-constexpr uint32_t STOP_FLASH_REMIND_EVENT = 1000001;
-constexpr uint32_t START_FLASH_REMIND_EVENT = 1000002;
+constexpr const char *SET_TORCH_MODE_TIMER = "incoming_flash_set_torch_mode";
 const std::string FLASH_REMINDER_SWITCH_SUBSTRING = "INCOMING_CALL";
-IncomingFlashReminder::IncomingFlashReminder(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
-    std::function<void()> stopFlashRemindDone)
-    : AppExecFwk::EventHandler(runner), stopFlashRemindDone_(std::move(stopFlashRemindDone)) {}
+namespace {
+    ffrt::queue flashReminderQueue { "incoming_flash_reminder" };
+}
+
+IncomingFlashReminder::IncomingFlashReminder(std::function<void()> stopFlashRemindDone)
+    : stopFlashRemindDone_(std::move(stopFlashRemindDone)) {}
 
 IncomingFlashReminder::~IncomingFlashReminder()
 {
@@ -68,24 +73,6 @@ IncomingFlashReminder::~IncomingFlashReminder()
 #endif
 }
 
-void IncomingFlashReminder::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event)
-{
-    switch (event->GetInnerEventId()) {
-        case DELAY_SET_TORCH_EVENT:
-            HandleSetTorchMode();
-            break;
-        case STOP_FLASH_REMIND_EVENT:
-            HandleStopFlashRemind();
-            break;
-        case START_FLASH_REMIND_EVENT:
-            HandleStartFlashRemind();
-            break;
-        default:
-            TELEPHONY_LOGE("receive unknown event %{public}u", event->GetInnerEventId());
-            break;
-    }
-}
-
 bool IncomingFlashReminder::IsFlashRemindNecessary()
 {
     return IsScreenStatusSatisfied() && IsTorchReady();
@@ -169,7 +156,13 @@ bool IncomingFlashReminder::IsFlashReminderSwitchOn()
 
 void IncomingFlashReminder::StartFlashRemind()
 {
-    SendEvent(AppExecFwk::InnerEvent::Get(START_FLASH_REMIND_EVENT, 0));
+    std::weak_ptr<IncomingFlashReminder> weakReminder = weak_from_this();
+    flashReminderQueue.submit([weakReminder]() {
+        auto reminder = weakReminder.lock();
+        if (reminder != nullptr) {
+            reminder->HandleStartFlashRemind();
+        }
+    });
 }
 
 void IncomingFlashReminder::HandleStartFlashRemind()
@@ -193,7 +186,21 @@ void IncomingFlashReminder::HandleStartFlashRemind()
     }
 #endif
     isFlashRemindUsed_ = true;
-    SendEvent(AppExecFwk::InnerEvent::Get(DELAY_SET_TORCH_EVENT, 0));
+    HandleSetTorchMode();
+}
+
+void IncomingFlashReminder::ScheduleSetTorchMode(int64_t delayMs)
+{
+    std::weak_ptr<IncomingFlashReminder> weakReminder = weak_from_this();
+    // the wheel only wakes the toggle, the torch itself is driven on the reminder queue
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(SET_TORCH_MODE_TIMER, delayMs, [weakReminder]() {
+        flashReminderQueue.submit([weakReminder]() {
+            auto reminder = weakReminder.lock();
+            if (reminder != nullptr && reminder->isFlashRemindUsed_) {
+                reminder->HandleSetTorchMode();
+            }
+        });
+    });
 }
 
 void IncomingFlashReminder::HandleSetTorchMode()
@@ -216,14 +223,20 @@ void IncomingFlashReminder::HandleSetTorchMode()
         TelTorchMode::TORCH_MODE_OFF : TelTorchMode::TORCH_MODE_ON);
     result = static_cast<TelTorchMode>(setTorchMode(static_cast<int>(nextMode)));
 
-    SendEvent(AppExecFwk::InnerEvent::Get(DELAY_SET_TORCH_EVENT, 0), DELAY_SET_TORCH_MODE_TIME);
+    ScheduleSetTorchMode(DELAY_SET_TORCH_MODE_TIME);
     TELEPHONY_LOGI("set torch mode result: %{public}d", result);
 #endif
 }
 
 void IncomingFlashReminder::StopFlashRemind()
 {
-    SendEvent(AppExecFwk::InnerEvent::Get(STOP_FLASH_REMIND_EVENT, 0));
+    std::weak_ptr<IncomingFlashReminder> weakReminder = weak_from_this();
+    flashReminderQueue.submit([weakReminder]() {
+        auto reminder = weakReminder.lock();
+        if (reminder != nullptr) {
+            reminder->HandleStopFlashRemind();
+        }
+    });
 }
 
 void IncomingFlashReminder::HandleStopFlashRemind()
@@ -235,7 +248,7 @@ void IncomingFlashReminder::HandleStopFlashRemind()
         }
         return;
     }
-    RemoveEvent(DELAY_SET_TORCH_EVENT);
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Cancel(SET_TORCH_MODE_TIMER);
     isFlashRemindUsed_ = false;
 #ifdef ABILITY_CAMERA_FRAMEWORK_SUPPORT
     if (libAdapterHandler_ == nullptr) {
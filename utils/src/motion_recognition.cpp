@@ -23,11 +23,18 @@
 #include "audio_proxy.h"
 #include "call_base.h"
 #include "call_control_manager.h"
+#include "call_manager_metrics.h"
 #include "call_object_manager.h"
+#include "call_timer_wheel.h"
 #include "telephony_log_wrapper.h"
 
 namespace OHOS {
 namespace Telephony {
+namespace {
+// sensors released by the last call stay subscribed this long in case the next call needs them again
+constexpr int64_t MOTION_SENSOR_UNSUBSCRIBE_DELAY_MS = 2000;
+constexpr const char *MOTION_SENSOR_UNSUBSCRIBE_TIMER = "motion_sensor_unsubscribe";
+}
 
 #ifdef OHOS_SUBSCRIBE_MOTION_ENABLE
 /**
@@ -58,7 +65,15 @@ constexpr int32_t MOTION_TYPE_FLIP = 200;
 constexpr int32_t MOTION_TYPE_CLOSE_TO_EAR = 300;
 
 //来电铃声减弱总时长
-constexpr int32_t REDUCE_RING_TOTAL_LENGTH = 1500000;  //us
+constexpr int32_t REDUCE_RING_TOTAL_LENGTH_MS = 1500;
+constexpr const char *REDUCE_RING_TONE_VOLUME_TIMER = "reduce_ring_tone_volume";
+
+struct ReduceRingToneState {
+    int32_t currentVolume = 0;
+    float beginVolumeDb = 0.0f;
+    int32_t count = 0;
+    int32_t reduceCount = 0;
+};
 
 /**
 * @brief 翻转方向
@@ -75,6 +90,7 @@ bool MotionPickupSubscriber::isMotionPickupSubscribed_ = false;
 
 static void FlipMotionEventCallback(const Rosen::MotionSensorEvent &motionData);
 static void CloseToEarMotionEventCallback(const Rosen::MotionSensorEvent &motionData);
+static void ReduceRingToneVolumeStep(std::shared_ptr<ReduceRingToneState> state);
 #endif
 
 void MotionRecogntion::SubscribePickupSensor()
@@ -119,6 +135,165 @@ void MotionRecogntion::UnsubscribeCloseToEarSensor()
 #endif
 }
 
+MotionSensorSubscriptionManager::MotionSensorSubscriptionManager()
+{
+    sensorLoader_ = []() { return Rosen::LoadMotionSensor(); };
+}
+
+MotionSensorSubscriptionManager::~MotionSensorSubscriptionManager() {}
+
+bool MotionSensorSubscriptionManager::Acquire(MotionSensorType type, int32_t callId)
+{
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= SENSOR_TYPE_NUM) {
+        return false;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (isSubscribed_[index]) {
+        if (holders_[index].empty()) {
+            TELEPHONY_LOGI("reuse motion sensor %{public}u before unsubscribe", index);
+            CallManagerMetrics::GetInstance().Increase(MetricCounter::MOTION_SENSOR_REUSE);
+        }
+        holders_[index].insert(callId);
+        return true;
+    }
+    if (!LoadSensorLocked()) {
+        TELEPHONY_LOGE("LoadMotionSensor failed");
+        return false;
+    }
+    SubscribeLocked(type);
+    holders_[index].insert(callId);
+    return true;
+}
+
+void MotionSensorSubscriptionManager::Release(MotionSensorType type, int32_t callId)
+{
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= SENSOR_TYPE_NUM) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (holders_[index].erase(callId) > 0 && holders_[index].empty()) {
+        ScheduleUnsubscribeLocked();
+    }
+}
+
+void MotionSensorSubscriptionManager::ReleaseAll(MotionSensorType type)
+{
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= SENSOR_TYPE_NUM) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!holders_[index].empty()) {
+        holders_[index].clear();
+        ScheduleUnsubscribeLocked();
+    }
+}
+
+void MotionSensorSubscriptionManager::ReleaseCall(int32_t callId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    bool needUnsubscribe = false;
+    for (auto &holders : holders_) {
+        if (holders.erase(callId) > 0 && holders.empty()) {
+            needUnsubscribe = true;
+        }
+    }
+    if (needUnsubscribe) {
+        ScheduleUnsubscribeLocked();
+    }
+}
+
+size_t MotionSensorSubscriptionManager::GetHolderCount(MotionSensorType type)
+{
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= SENSOR_TYPE_NUM) {
+        return 0;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return holders_[index].size();
+}
+
+bool MotionSensorSubscriptionManager::LoadSensorLocked()
+{
+    if (isSensorLoaded_) {
+        return true;
+    }
+    if (sensorLoader_ == nullptr || !sensorLoader_()) {
+        return false;
+    }
+    TELEPHONY_LOGI("LoadMotionSensor success");
+    isSensorLoaded_ = true;
+    return true;
+}
+
+void MotionSensorSubscriptionManager::SubscribeLocked(MotionSensorType type)
+{
+    switch (type) {
+        case MotionSensorType::PICKUP:
+            MotionRecogntion::SubscribePickupSensor();
+            break;
+        case MotionSensorType::FLIP:
+            MotionRecogntion::SubscribeFlipSensor();
+            break;
+        case MotionSensorType::CLOSE_TO_EAR:
+            MotionRecogntion::SubscribeCloseToEarSensor();
+            break;
+        default:
+            return;
+    }
+    isSubscribed_[static_cast<uint32_t>(type)] = true;
+    CallManagerMetrics::GetInstance().Increase(MetricCounter::MOTION_SENSOR_SUBSCRIBE);
+}
+
+void MotionSensorSubscriptionManager::UnsubscribeLocked(MotionSensorType type)
+{
+    switch (type) {
+        case MotionSensorType::PICKUP:
+            MotionRecogntion::UnsubscribePickupSensor();
+            break;
+        case MotionSensorType::FLIP:
+            MotionRecogntion::UnsubscribeFlipSensor();
+            break;
+        case MotionSensorType::CLOSE_TO_EAR:
+            MotionRecogntion::UnsubscribeCloseToEarSensor();
+            break;
+        default:
+            return;
+    }
+    isSubscribed_[static_cast<uint32_t>(type)] = false;
+    CallManagerMetrics::GetInstance().Increase(MetricCounter::MOTION_SENSOR_UNSUBSCRIBE);
+}
+
+void MotionSensorSubscriptionManager::ScheduleUnsubscribeLocked()
+{
+    // rescheduling replaces the pending timer, so the window restarts from the latest release
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(MOTION_SENSOR_UNSUBSCRIBE_TIMER,
+        MOTION_SENSOR_UNSUBSCRIBE_DELAY_MS, []() {
+            ffrt::submit([]() {
+                DelayedSingleton<MotionSensorSubscriptionManager>::GetInstance()->OnUnsubscribeExpired();
+            });
+        });
+}
+
+void MotionSensorSubscriptionManager::OnUnsubscribeExpired()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    bool hasSubscribed = false;
+    for (uint32_t index = 0; index < SENSOR_TYPE_NUM; index++) {
+        if (isSubscribed_[index] && holders_[index].empty()) {
+            UnsubscribeLocked(static_cast<MotionSensorType>(index));
+        }
+        hasSubscribed = hasSubscribed || isSubscribed_[index];
+    }
+    if (!hasSubscribed && isSensorLoaded_) {
+        TELEPHONY_LOGI("no motion sensor subscribed, unload motion plugin");
+        Rosen::UnloadMotionSensor();
+        isSensorLoaded_ = false;
+    }
+}
+
 #ifdef  OHOS_SUBSCRIBE_MOTION_ENABLE
 void FlipMotionEventCallback(const Rosen::MotionSensorEvent &motionData)
 {
@@ -141,7 +316,10 @@ void FlipMotionEventCallback(const Rosen::MotionSensorEvent &motionData)
             if (motionData.status != 0) {
                 break;
             }
-            MotionRecogntion::UnsubscribePickupSensor();
+            ffrt::submit([]() {
+                DelayedSingleton<MotionSensorSubscriptionManager>::GetInstance()->ReleaseAll(
+                    MotionSensorType::PICKUP);
+            });
             if (controlManager == nullptr || controlManager->GetReduceRingToneVolume()) {
                 break;
             }
@@ -158,7 +336,6 @@ void FlipMotionEventCallback(const Rosen::MotionSensorEvent &motionData)
 
 void MotionRecogntion::ReduceRingToneVolume()
 {
-    int32_t count = 0;
     int32_t currentVolume = DelayedSingleton<AudioProxy>::GetInstance()->GetVolume(
         AudioStandard::AudioVolumeType::STREAM_RING);
     if (currentVolume <= 1) {
@@ -170,17 +347,38 @@ void MotionRecogntion::ReduceRingToneVolume()
         TELEPHONY_LOGE("GetSystemRingVolumeInDb fail");
         return;
     }
-    int32_t reduceCount = currentVolume - 1;
-    while (count < reduceCount) {
-        count++;
-        float endVolumeDb = DelayedSingleton<AudioProxy>::GetInstance()->GetSystemRingVolumeInDb(currentVolume - count);
-        if (endVolumeDb == 0.0f || beginVolumeDb <= endVolumeDb) {
-            TELEPHONY_LOGE("GetSystemRingVolumeInDb fail or beginVolumeDb unexpected");
-            return;
-        }
-        DelayedSingleton<AudioControlManager>::GetInstance()->SetRingToneVolume(endVolumeDb / beginVolumeDb);
-        ffrt_usleep(REDUCE_RING_TOTAL_LENGTH / reduceCount);
+    auto state = std::make_shared<ReduceRingToneState>();
+    state->currentVolume = currentVolume;
+    state->beginVolumeDb = beginVolumeDb;
+    state->reduceCount = currentVolume - 1;
+    ReduceRingToneVolumeStep(state);
+}
+
+void ReduceRingToneVolumeStep(std::shared_ptr<ReduceRingToneState> state)
+{
+    state->count++;
+    float endVolumeDb =
+        DelayedSingleton<AudioProxy>::GetInstance()->GetSystemRingVolumeInDb(state->currentVolume - state->count);
+    if (endVolumeDb == 0.0f || state->beginVolumeDb <= endVolumeDb) {
+        TELEPHONY_LOGE("GetSystemRingVolumeInDb fail or beginVolumeDb unexpected");
+        return;
+    }
+    DelayedSingleton<AudioControlManager>::GetInstance()->SetRingToneVolume(endVolumeDb / state->beginVolumeDb);
+    if (state->count >= state->reduceCount) {
+        return;
     }
+    // step from a timer instead of sleeping on an ffrt worker, stop once the ringing call is gone
+    DelayedSingleton<CallTimerWheel>::GetInstance()->Schedule(REDUCE_RING_TONE_VOLUME_TIMER,
+        REDUCE_RING_TOTAL_LENGTH_MS / state->reduceCount, [state]() {
+            ffrt::submit([state]() {
+                auto controlManager = DelayedSingleton<CallControlManager>::GetInstance();
+                if (controlManager == nullptr || !controlManager->GetReduceRingToneVolume()) {
+                    TELEPHONY_LOGI("reduce ring tone volume stopped");
+                    return;
+                }
+                ReduceRingToneVolumeStep(state);
+            });
+        });
 }
 
 void CloseToEarMotionEventCallback(const Rosen::MotionSensorEvent &motionData)
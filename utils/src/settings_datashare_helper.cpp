@@ -16,6 +16,7 @@
 #include "settings_datashare_helper.h"
 
 #include "call_dialog.h"
+#include "call_manager_metrics.h"
 #include "datashare_helper.h"
 #include "datashare_predicates.h"
 #include "iservice_registry.h"
@@ -60,10 +61,14 @@ std::shared_ptr<DataShare::DataShareHelper> SettingsDataShareHelper::CreateDataS
 int32_t SettingsDataShareHelper::Query(Uri& uri, const std::string& key, std::string& value)
 {
     TELEPHONY_LOGW("start Query");
+    CallManagerMetrics &metrics = CallManagerMetrics::GetInstance();
+    metrics.Increase(MetricCounter::DATASHARE_QUERY);
+    CallManagerMetricsTimer metricsTimer(MetricHistogram::DATASHARE_QUERY_LATENCY);
     std::shared_ptr<DataShare::DataShareHelper> settingHelper =
         CreateDataShareHelper(TELEPHONY_CALL_MANAGER_SYS_ABILITY_ID);
     if (settingHelper == nullptr) {
         TELEPHONY_LOGE("query error, datashareHelper_ is nullptr");
+        metrics.Increase(MetricCounter::DATASHARE_QUERY_FAILED);
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
 
@@ -73,6 +78,7 @@ int32_t SettingsDataShareHelper::Query(Uri& uri, const std::string& key, std::st
     auto result = settingHelper->Query(uri, predicates, columns);
     if (result == nullptr) {
         TELEPHONY_LOGE("query error, result is nullptr");
+        metrics.Increase(MetricCounter::DATASHARE_QUERY_FAILED);
         settingHelper->Release();
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
@@ -87,6 +93,7 @@ int32_t SettingsDataShareHelper::Query(Uri& uri, const std::string& key, std::st
 
     if (result->GoToFirstRow() != DataShare::E_OK) {
         TELEPHONY_LOGE("query error, go to first row error");
+        metrics.Increase(MetricCounter::DATASHARE_QUERY_FAILED);
         result->Close();
         settingHelper->Release();
         return TELEPHONY_ERR_DATABASE_READ_FAIL;